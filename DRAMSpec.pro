@@ -31,6 +31,7 @@
 # Authors: Matthias Jung, Andr'e Lucas Chinazzo
 
 CONFIG += c++11
+LIBS += -pthread
 
 mac {
     CONFIG -= app_bundle
@@ -52,11 +53,41 @@ HEADERS += core/Bank.h
 HEADERS += core/Channel.h
 HEADERS += core/Timing.h
 HEADERS += core/Current.h
+HEADERS += core/ModelError.h
+HEADERS += core/Dual.h
+HEADERS += core/Interval.h
 
 HEADERS += utils/utils.h
 HEADERS += parser/ArgumentsParser.h
 HEADERS += parser/TechnologyValues.h
 HEADERS += parser/DramSpec.h
+HEADERS += parser/ResultFormatter.h
+HEADERS += parser/DramResult.h
+HEADERS += parser/OutputWriter.h
+HEADERS += parser/RunStatistics.h
+HEADERS += parser/ShardMerger.h
+HEADERS += parser/CheckpointJournal.h
+HEADERS += parser/ResultCache.h
+HEADERS += parser/EvaluationService.h
+HEADERS += parser/SocketServer.h
+HEADERS += parser/StreamEvaluator.h
+HEADERS += parser/ConfigurationSource.h
+HEADERS += parser/TechnologyLibrary.h
+HEADERS += parser/ParetoExplorer.h
+HEADERS += parser/BatchEvaluator.h
+HEADERS += parser/Nsga2.h
+HEADERS += parser/GoalSeeker.h
+HEADERS += parser/FloorplanOptimizer.h
+HEADERS += parser/SubarraySizer.h
+HEADERS += parser/SensitivityAnalyzer.h
+HEADERS += parser/ToleranceAnalyzer.h
+HEADERS += parser/StreamingStatistics.h
+HEADERS += parser/MonteCarloSimulator.h
+HEADERS += parser/SobolAnalyzer.h
+HEADERS += parser/DesignSampler.h
+HEADERS += utils/BoundedQueue.h
+HEADERS += library/DramSpecLibrary.h
+HEADERS += library/dramspec.h
 
 # Expanded BOOST/UNITS
 HEADERS += expandedBoostUnits/BaseDimensions/clock.h
@@ -93,12 +124,39 @@ SOURCES += core/Bank.cpp
 SOURCES += core/Channel.cpp
 SOURCES += core/Timing.cpp
 SOURCES += core/Current.cpp
+SOURCES += core/ModelError.cpp
 
 #DRAMSpec other source files
 SOURCES += utils/utils.cpp
 SOURCES += parser/ArgumentsParser.cpp
 SOURCES += parser/TechnologyValues.cpp
 SOURCES += parser/DramSpec.cpp
+SOURCES += parser/ResultFormatter.cpp
+SOURCES += parser/DramResult.cpp
+SOURCES += parser/OutputWriter.cpp
+SOURCES += parser/RunStatistics.cpp
+SOURCES += parser/ShardMerger.cpp
+SOURCES += parser/CheckpointJournal.cpp
+SOURCES += parser/ResultCache.cpp
+SOURCES += parser/EvaluationService.cpp
+SOURCES += parser/SocketServer.cpp
+SOURCES += parser/StreamEvaluator.cpp
+SOURCES += parser/ConfigurationSource.cpp
+SOURCES += parser/TechnologyLibrary.cpp
+SOURCES += parser/ParetoExplorer.cpp
+SOURCES += parser/BatchEvaluator.cpp
+SOURCES += parser/Nsga2.cpp
+SOURCES += parser/GoalSeeker.cpp
+SOURCES += parser/FloorplanOptimizer.cpp
+SOURCES += parser/SubarraySizer.cpp
+SOURCES += parser/SensitivityAnalyzer.cpp
+SOURCES += parser/ToleranceAnalyzer.cpp
+SOURCES += parser/StreamingStatistics.cpp
+SOURCES += parser/MonteCarloSimulator.cpp
+SOURCES += parser/SobolAnalyzer.cpp
+SOURCES += parser/DesignSampler.cpp
+SOURCES += library/DramSpecLibrary.cpp
+SOURCES += library/DramSpecCInterface.cpp
 
 #Choose output directories
 # and source files to be compiled
@@ -137,6 +195,29 @@ CONFIG(debug, debug|release) {
     SOURCES += unit_tests/unit_tests/ChannelTest.cpp
     SOURCES += unit_tests/unit_tests/TimingTest.cpp
     SOURCES += unit_tests/unit_tests/CurrentTest.cpp
+    SOURCES += unit_tests/unit_tests/ResultFormatterTest.cpp
+    SOURCES += unit_tests/unit_tests/OutputWriterTest.cpp
+    SOURCES += unit_tests/unit_tests/ShardMergerTest.cpp
+    SOURCES += unit_tests/unit_tests/CheckpointJournalTest.cpp
+    SOURCES += unit_tests/unit_tests/ResultCacheTest.cpp
+    SOURCES += unit_tests/unit_tests/EvaluationServiceTest.cpp
+    SOURCES += unit_tests/unit_tests/StreamEvaluatorTest.cpp
+    SOURCES += unit_tests/unit_tests/ConfigurationSourceTest.cpp
+    SOURCES += unit_tests/unit_tests/DramSpecLibraryTest.cpp
+    SOURCES += unit_tests/unit_tests/DramSpecCInterfaceTest.cpp
+    SOURCES += unit_tests/unit_tests/TechnologyLibraryTest.cpp
+    SOURCES += unit_tests/unit_tests/ParetoExplorerTest.cpp
+    SOURCES += unit_tests/unit_tests/BatchEvaluatorTest.cpp
+    SOURCES += unit_tests/unit_tests/Nsga2Test.cpp
+    SOURCES += unit_tests/unit_tests/GoalSeekerTest.cpp
+    SOURCES += unit_tests/unit_tests/FloorplanOptimizerTest.cpp
+    SOURCES += unit_tests/unit_tests/SubarraySizerTest.cpp
+    SOURCES += unit_tests/unit_tests/SensitivityAnalyzerTest.cpp
+    SOURCES += unit_tests/unit_tests/ToleranceAnalyzerTest.cpp
+    SOURCES += unit_tests/unit_tests/StreamingStatisticsTest.cpp
+    SOURCES += unit_tests/unit_tests/MonteCarloSimulatorTest.cpp
+    SOURCES += unit_tests/unit_tests/SobolAnalyzerTest.cpp
+    SOURCES += unit_tests/unit_tests/DesignSamplerTest.cpp
     #SOURCES += unit_tests/unit_tests/DramSpecTest.cpp
 
     SOURCES += unit_tests/unitTestRunner.cpp
@@ -152,5 +233,6 @@ OTHER_FILES += README.md
 OTHER_FILES += IODescription.md
 OTHER_FILES += runTests.sh
 OTHER_FILES += buildDRAMSpec.sh
+OTHER_FILES += libdramspec.pro
 OTHER_FILES += .gitignore
 
@@ -39,11 +39,15 @@
 
 
 #include "Bank.h"
+#include "Dual.h"
+#include "Interval.h"
 
+template<typename Scalar>
 void
-Bank::bankInitialize()
+BasicBank<Scalar>::bankInitialize()
 {
   bankStorage = 0*drs::bits;
+  givenVerticalTiles = INVALID_VALUE;
   bankWidth = 0*drs::micrometers;
   bankHeight = 0*drs::micrometers;
 
@@ -55,30 +59,54 @@ Bank::bankInitialize()
 
 }
 
+template<typename Scalar>
 void
-Bank::bankStorageCalc()
+BasicBank<Scalar>::bankStorageCalc()
 {
   bankStorage =  SCALE_QUANTITY(channelSize, drs::bit_unit) / nBanks;
 }
 
-void
-Bank::bankTilesPlacementAssess()
+template<typename Scalar>
+ModelError
+BasicBank<Scalar>::bankInputError() const
 {
   if ( isPowerOfTwo(nTilesPerBank) == false ) {
-      std::string exceptionMsgThrown("[ERROR] ");
-      exceptionMsgThrown.append("Total number of tiles per bank ");
-      exceptionMsgThrown.append("must be a power of two.");
-      throw exceptionMsgThrown;
+      return TILES_POWER_OF_TWO_ERROR;
+  }
+
+  if ( givenVerticalTiles != INVALID_VALUE
+       && ( isPowerOfTwo(givenVerticalTiles) == false
+            || givenVerticalTiles > nTilesPerBank ) ) {
+      return TILES_DIRECTION_ERROR;
   }
 
-  // Defining default tiles placement on bank
-  nVerticalTiles = pow(2, floor(log(nTilesPerBank)/log(4.0)) );
+  return NO_MODEL_ERROR;
+}
+
+template<typename Scalar>
+void
+BasicBank<Scalar>::bankTilesPlacementAssess()
+{
+  ModelError error = bankInputError();
+  if ( error != NO_MODEL_ERROR ) {
+      throw std::string(modelErrorMessage(error));
+  }
+
+  // Defining default tiles placement on bank,
+  // executed when the number of tiles in vertical direction is not given
+  if ( givenVerticalTiles == INVALID_VALUE ) {
+      nVerticalTiles = pow(2, floor(log(nTilesPerBank)/log(4.0)) );
+  }
+  else {
+      nVerticalTiles = givenVerticalTiles;
+  }
   nHorizontalTiles = nTilesPerBank / nVerticalTiles;
 
 }
 
+template<typename Scalar>
 void
-Bank::bankLenghtCalc()
+BasicBank<Scalar>::bankLenghtCalc()
 {
   bankWidth = nHorizontalTiles
                * (tileWidth + 1.0 * rowDecoderWidth);
@@ -88,8 +116,9 @@ Bank::bankLenghtCalc()
 
 }
 
+template<typename Scalar>
 void
-Bank::bankLogicAssess()
+BasicBank<Scalar>::bankLogicAssess()
 {
 
   effectivePageStorage = (SCALE_QUANTITY(pageStorage, drs::bit_unit)
@@ -106,8 +135,9 @@ Bank::bankLogicAssess()
   nColumnAddressLines = ceil(log2(nBankLogicalColumns));
 }
 
+template<typename Scalar>
 void
-Bank::bankCompute()
+BasicBank<Scalar>::bankCompute()
 {
   bankStorageCalc();
   try{
@@ -118,3 +148,7 @@ Bank::bankCompute()
   bankLenghtCalc();
   bankLogicAssess();
 }
+
+template class BasicBank<double>;
+template class BasicBank<Dual>;
+template class BasicBank<Interval>;
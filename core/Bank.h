@@ -50,50 +50,91 @@ namespace si=boost::units::si;
 namespace inf=boost::units::information;
 namespace drs=boost::units::dramspec;
 
-class Bank : public Tile
+template<typename Scalar>
+class BasicBank : public BasicTile<Scalar>
 {
   public:
-    Bank() : //Empty constructor for test proposes
-        Tile()
+    typedef typename BasicTile<Scalar>::Inputs Inputs;
+
+    using BasicTile<Scalar>::channelSize;
+    using BasicTile<Scalar>::nBanks;
+    using BasicTile<Scalar>::nTilesPerBank;
+    using BasicTile<Scalar>::pageSpanningFactor;
+    using BasicTile<Scalar>::pageStorage;
+    using BasicTile<Scalar>::interface;
+    using BasicTile<Scalar>::rowDecoderWidth;
+    using BasicTile<Scalar>::colDecoderHeight;
+    using BasicTile<Scalar>::tileWidth;
+    using BasicTile<Scalar>::tileHeight;
+
+    BasicBank() : //Empty constructor for test proposes
+        BasicTile<Scalar>()
+    {
+        bankInitialize();
+    }
+
+    BasicBank(const std::string& technologyFileName,
+              const std::string& architectureFileName):
+        BasicTile<Scalar>(technologyFileName, architectureFileName)
     {
         bankInitialize();
+        bankCompute();
     }
 
-    Bank(const std::string& technologyFileName,
-         const std::string& architectureFileName):
-        Tile(technologyFileName, architectureFileName)
+    BasicBank(const Inputs& technologyValues):
+        BasicTile<Scalar>(technologyValues)
     {
         bankInitialize();
         bankCompute();
     }
 
+    // Computes on an already computed tile, with the given number of
+    //  tiles in vertical direction (INVALID_VALUE: default placement)
+    BasicBank(const BasicTile<Scalar>& tile, double nVerticalTiles):
+        BasicTile<Scalar>(tile)
+    {
+        bankInitialize();
+        givenVerticalTiles = nVerticalTiles;
+        try {
+            bankCompute();
+        }catch (string exceptionMsgThrown){
+            throw exceptionMsgThrown;
+        }
+    }
+
     // Size in number of bits of a single bank
-    bu::quantity<drs::bit_unit> bankStorage;
+    bu::quantity<drs::bit_unit, Scalar> bankStorage;
 
     // Tiles placement on bank
     double nVerticalTiles;
     double nHorizontalTiles;
+    // Tiles in vertical direction asked for (INVALID_VALUE: default)
+    double givenVerticalTiles;
 
     // Width in micrometer of a single bank
-    bu::quantity<drs::micrometer_unit> bankWidth;
+    bu::quantity<drs::micrometer_unit, Scalar> bankWidth;
     // Height in micrometer of a single bank
-    bu::quantity<drs::micrometer_unit> bankHeight;
+    bu::quantity<drs::micrometer_unit, Scalar> bankHeight;
 
     // Total page size accounting all tiles
-    bu::quantity<drs::bit_unit> effectivePageStorage;
-    double nBankLogicalRows;
-    double nRowAddressLines;
-    double nBankLogicalColumns;
-    double nColumnAddressLines;
+    bu::quantity<drs::bit_unit, Scalar> effectivePageStorage;
+    Scalar nBankLogicalRows;
+    Scalar nRowAddressLines;
+    Scalar nBankLogicalColumns;
+    Scalar nColumnAddressLines;
 
     void bankInitialize();
 
     void bankCompute();
     void bankStorageCalc();
+    // First inconsistency of the tiles placement (NO_MODEL_ERROR if none)
+    ModelError bankInputError() const;
     void bankTilesPlacementAssess();
     void bankLenghtCalc();
     void bankLogicAssess();
 
 };
 
+typedef BasicBank<double> Bank;
+
 #endif // BANK_H
@@ -39,9 +39,12 @@
 
 
 #include "Channel.h"
+#include "Dual.h"
+#include "Interval.h"
 
+template<typename Scalar>
 void
-Channel::channelInitialize()
+BasicChannel<Scalar>::channelInitialize()
 {
     channelStorage = 0*drs::gibibit;
     channelWidth = 0*drs::micrometer;
@@ -49,20 +52,52 @@ Channel::channelInitialize()
     channelArea = 0*drs::square_millimeter;
 }
 
+template<typename Scalar>
 void
-Channel::channelStorageCalc()
+BasicChannel<Scalar>::channelStorageCalc()
 {
     channelStorage = channelSize;
 }
 
-void
-Channel::channelBanksPlacementAssess()
+template<typename Scalar>
+ModelError
+BasicChannel<Scalar>::channelInputError() const
 {
     if ( isPowerOfTwo(nBanks) == false ) {
-        std::string exceptionMsgThrown("[ERROR] ");
-        exceptionMsgThrown.append("Total number of banks ");
-        exceptionMsgThrown.append("must be a power of two.");
-        throw exceptionMsgThrown;
+        return BANKS_POWER_OF_TWO_ERROR;
+    }
+
+    // Only one direction defined
+    if ( nHorizontalBanks == INVALID_VALUE
+         && nVerticalBanks != INVALID_VALUE ) {
+        if ( isPowerOfTwo(nVerticalBanks) == false
+             || nVerticalBanks > nBanks ) {
+            return BANKS_DIRECTION_ERROR;
+        }
+    }
+    else if ( nVerticalBanks == INVALID_VALUE
+              && nHorizontalBanks != INVALID_VALUE ) {
+        if ( isPowerOfTwo(nHorizontalBanks) == false
+             || nVerticalBanks > nBanks ) {
+            return BANKS_DIRECTION_ERROR;
+        }
+    }
+    // Both directions defined
+    else if ( nHorizontalBanks != INVALID_VALUE
+              && nBanks != nHorizontalBanks * nVerticalBanks ) {
+        return BANKS_MISMATCH_ERROR;
+    }
+
+    return NO_MODEL_ERROR;
+}
+
+template<typename Scalar>
+void
+BasicChannel<Scalar>::channelBanksPlacementAssess()
+{
+    ModelError error = channelInputError();
+    if ( error != NO_MODEL_ERROR ) {
+        throw std::string(modelErrorMessage(error));
     }
 
     // Defining default bank placement on channel,
@@ -79,45 +114,17 @@ Channel::channelBanksPlacementAssess()
     // define the other one.
     else if ( nHorizontalBanks == INVALID_VALUE )
     {
-        if ( isPowerOfTwo(nVerticalBanks) == false
-             || nVerticalBanks > nBanks ) {
-            std::string exceptionMsgThrown("[ERROR] ");
-            exceptionMsgThrown.append("Number of banks in either direction ");
-            exceptionMsgThrown.append("must be a power of two and ");
-            exceptionMsgThrown.append("less than or equal to the ");
-            exceptionMsgThrown.append("total number of banks.");
-            throw exceptionMsgThrown;
-        }
-
         nHorizontalBanks = nBanks / nVerticalBanks;
     }
     else if ( nVerticalBanks == INVALID_VALUE )
     {
-        if ( isPowerOfTwo(nHorizontalBanks) == false
-             || nVerticalBanks > nBanks ) {
-            std::string exceptionMsgThrown("[ERROR] ");
-            exceptionMsgThrown.append("Number of banks in either direction ");
-            exceptionMsgThrown.append("must be a power of two and ");
-            exceptionMsgThrown.append("less than or equal to the ");
-            exceptionMsgThrown.append("total number of banks.");
-            throw exceptionMsgThrown;
-        }
-
         nVerticalBanks = nBanks / nHorizontalBanks ;
     }
-
-    // If number of banks in both directions is defined
-    // make sure it matched with the defined total number of banks
-    else if ( nBanks != nHorizontalBanks * nVerticalBanks ) {
-        std::string exceptionMsgThrown("[ERROR] ");
-        exceptionMsgThrown.append("Total number of banks does not match with ");
-        exceptionMsgThrown.append("the number of banks in both directions.");
-        throw exceptionMsgThrown;
-    }
 }
 
+template<typename Scalar>
 void
-Channel::channelLenghtCalc()
+BasicChannel<Scalar>::channelLenghtCalc()
 {
     channelWidth = nHorizontalBanks * bankWidth;
 
@@ -130,15 +137,17 @@ Channel::channelLenghtCalc()
 }
 
 
+template<typename Scalar>
 void
-Channel::channelAreaCalc()
+BasicChannel<Scalar>::channelAreaCalc()
 {
     channelArea =  SCALE_QUANTITY(channelWidth, drs::millimeter_unit)
                    * SCALE_QUANTITY(channelHeight, drs::millimeter_unit);
 }
 
+template<typename Scalar>
 void
-Channel::channelCompute()
+BasicChannel<Scalar>::channelCompute()
 {
     channelStorageCalc();
 
@@ -151,3 +160,7 @@ Channel::channelCompute()
 
     channelAreaCalc();
 }
+
+template class BasicChannel<double>;
+template class BasicChannel<Dual>;
+template class BasicChannel<Interval>;
@@ -51,38 +51,77 @@ namespace si=boost::units::si;
 namespace inf=boost::units::information;
 namespace drs=boost::units::dramspec;
 
-class Channel : public Bank
+template<typename Scalar>
+class BasicChannel : public BasicBank<Scalar>
 {
   public:
-    Channel() : //Empty constructor for test proposes
-        Bank()
+    typedef typename BasicBank<Scalar>::Inputs Inputs;
+
+    using BasicBank<Scalar>::channelSize;
+    using BasicBank<Scalar>::nBanks;
+    using BasicBank<Scalar>::nVerticalBanks;
+    using BasicBank<Scalar>::nHorizontalBanks;
+    using BasicBank<Scalar>::is3D;
+    using BasicBank<Scalar>::bankWidth;
+    using BasicBank<Scalar>::bankHeight;
+    using BasicBank<Scalar>::DQDriverHeight;
+    using BasicBank<Scalar>::TSVHeight;
+
+    BasicChannel() : //Empty constructor for test proposes
+        BasicBank<Scalar>()
     {
         channelInitialize();
     }
 
-    Channel(const string& technologyFileName,
-         const string& architectureFileName) :
-        Bank(technologyFileName, architectureFileName)
+    BasicChannel(const string& technologyFileName,
+                 const string& architectureFileName) :
+        BasicBank<Scalar>(technologyFileName, architectureFileName)
     {
         channelInitialize();
         channelCompute();
     }
 
+    BasicChannel(const Inputs& technologyValues) :
+        BasicBank<Scalar>(technologyValues)
+    {
+        channelInitialize();
+        channelCompute();
+    }
+
+    // Computes on an already computed bank, with the given number of
+    //  banks in vertical direction (INVALID_VALUE: placement of the inputs)
+    BasicChannel(const BasicBank<Scalar>& bank, double nVerticalBanks) :
+        BasicBank<Scalar>(bank)
+    {
+        channelInitialize();
+        if ( nVerticalBanks != INVALID_VALUE ) {
+            this->nVerticalBanks = nVerticalBanks;
+            nHorizontalBanks = INVALID_VALUE;
+        }
+        try {
+            channelCompute();
+        }catch (string exceptionMsgThrown){
+            throw exceptionMsgThrown;
+        }
+    }
+
     // Size in number of bits of the channel
-    bu::quantity<drs::gibibit_unit> channelStorage;
+    bu::quantity<drs::gibibit_unit, Scalar> channelStorage;
 
     // Width in micrometer of the channel
-    bu::quantity<drs::micrometer_unit> channelWidth;
+    bu::quantity<drs::micrometer_unit, Scalar> channelWidth;
     // Height in micrometer of the channel
-    bu::quantity<drs::micrometer_unit> channelHeight;
+    bu::quantity<drs::micrometer_unit, Scalar> channelHeight;
 
     // Area in micrometer squared of the channel
-    bu::quantity<drs::square_millimeter_unit> channelArea;
+    bu::quantity<drs::square_millimeter_unit, Scalar> channelArea;
 
     void channelInitialize();
 
     void channelStorageCalc();
 
+    // First inconsistency of the banks placement (NO_MODEL_ERROR if none)
+    ModelError channelInputError() const;
     void channelBanksPlacementAssess();
 
     void channelLenghtCalc();
@@ -93,4 +132,6 @@ class Channel : public Bank
 
 };
 
+typedef BasicChannel<double> Channel;
+
 #endif // CHANNEL_H
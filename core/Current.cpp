@@ -39,12 +39,15 @@
 
 
 #include "Current.h"
+#include "Dual.h"
+#include "Interval.h"
 #include <math.h>
 #include <iostream>
 #include <fstream>
 
+template<typename Scalar>
 void
-Current::currentInitialize()
+BasicCurrent<Scalar>::currentInitialize()
 {
   // Fixed value by Christian
   IDD2nPercentageIfNotDll = 0.6;
@@ -104,8 +107,9 @@ Current::currentInitialize()
   includeIOTerminationCurrent = false;
 }
 
+template<typename Scalar>
 void
-Current::IDD2NCalc()
+BasicCurrent<Scalar>::IDD2NCalc()
 {
 
   // Precharge background current
@@ -123,8 +127,33 @@ Current::IDD2NCalc()
 
 }
 
+// Share of the fully shared resources in IDD3n - IDD2n (rho), given the
+//  other terms of the difference. On intervals (see Interval.h) the
+//  difference would not cancel IDD2n, and could reach zero, so it is
+//  summed from its terms.
+static double
+fullySharedShare(double fullyShared, double idd3n, double idd2n, double)
+{
+    return fullyShared / (idd3n - idd2n);
+}
+
+static Dual
+fullySharedShare(const Dual& fullyShared, const Dual& idd3n,
+                 const Dual& idd2n, const Dual&)
+{
+    return fullyShared / (idd3n - idd2n);
+}
+
+static Interval
+fullySharedShare(const Interval& fullyShared, const Interval&,
+                 const Interval&, const Interval& otherActiveTerms)
+{
+    return fullyShared / (fullyShared + otherActiveTerms);
+}
+
+template<typename Scalar>
 void
-Current::IXX3NCalc()
+BasicCurrent<Scalar>::IXX3NCalc()
 {
   // Active background current:
   // TODO: Missing leakage model for 1-bank active
@@ -143,7 +172,11 @@ Current::IXX3NCalc()
   // Jung, M. et al, "A New BankSensitive DRAMPower Model for Efficient
   // Design Space Exploration", 2016
   // Background current calculation
-  rho = fullySharedResourcesCurrent / (IDD3n - IDD2n);
+  rho = fullySharedShare(fullySharedResourcesCurrent.value(),
+                         IDD3n.value(), IDD2n.value(),
+                         ( nBanks * semiSharedResourcesCurrent
+                             / nBanksPerSemiSharedResource
+                           + nBanks * activeBankLeakage ).value());
 
   if ( hasExternalVpp ) {
     // First estimation based on datasheet values
@@ -157,8 +190,9 @@ Current::IXX3NCalc()
 }
 
 
+template<typename Scalar>
 void
-Current::IXX0Calc()
+BasicCurrent<Scalar>::IXX0Calc()
 {
   nActiveSubarrays = effectivePageStorage / subArrayRowStorage;
 
@@ -178,7 +212,7 @@ Current::IXX0Calc()
                        * nLocalBitlines;
 
   rowAddrsLinesCharge =
-          SCALE_QUANTITY(wireCapacitance, drs::nanofarad_per_millimeter_unit)
+          technologyConstants.wireCapacitancePerMillimeter
           * SCALE_QUANTITY(tileHeight, drs::millimeter_unit)
           * nRowAddressLines
           * vdd;
@@ -216,8 +250,9 @@ Current::IXX0Calc()
 
 }
 
+template<typename Scalar>
 void
-Current::IXX1Calc()
+BasicCurrent<Scalar>::IXX1Calc()
 {
 
   nLDQs = interface * prefetch;
@@ -227,7 +262,7 @@ Current::IXX1Calc()
 
   // Charges of SSA
   SSACharge = nLDQs
-              * SCALE_QUANTITY(Issa, drs::ampere_per_bit_unit)
+              * technologyConstants.Issa
               * SSAActiveTime;
 
   // nCSLs includes CSLEN and !CSLEN lines (+ 2),
@@ -278,11 +313,12 @@ Current::IXX1Calc()
 
 }
 
+template<typename Scalar>
 void
-Current::IDD4RCalc()
+BasicCurrent<Scalar>::IDD4RCalc()
 {
   colAddrsLinesCharge =
-          SCALE_QUANTITY(wireCapacitance, drs::nanofarad_per_millimeter_unit)
+          technologyConstants.wireCapacitancePerMillimeter
           * SCALE_QUANTITY(bankWidth, drs::millimeter_unit)
           * nColumnAddressLines
           * vdd;
@@ -314,12 +350,7 @@ Current::IDD4RCalc()
                                         drs::milliampere_per_bit_unit);
     }
     else {
-      std::string exceptionMsgThrown("[ERROR] ");
-      exceptionMsgThrown.append("Custom interface size ");
-      exceptionMsgThrown.append("(greater than 128 bits or ");
-      exceptionMsgThrown.append("not a power of two) ");
-      exceptionMsgThrown.append("model is not yet implemented!");
-      throw exceptionMsgThrown;
+      throw std::string(modelErrorMessage(INTERFACE_SIZE_ERROR));
     }
   }
   else {
@@ -337,8 +368,9 @@ Current::IDD4RCalc()
 
 }
 
+template<typename Scalar>
 void
-Current::IDD4WCalc()
+BasicCurrent<Scalar>::IDD4WCalc()
 {
   // Termination current for writting must include DQS/!DQS pairs
   //  as well as DM lines charges (one for each 8 bits of data lines).
@@ -357,8 +389,9 @@ Current::IDD4WCalc()
 
 }
 
+template<typename Scalar>
 void
-Current::IXX5BCalc()
+BasicCurrent<Scalar>::IXX5BCalc()
 {
   if ( hasExternalVpp ) {
     iDDRefreshCharge = IDD0TotalCharge
@@ -397,8 +430,9 @@ Current::IXX5BCalc()
   }
 }
 
+template<typename Scalar>
 void
-Current::currentCompute()
+BasicCurrent<Scalar>::currentCompute()
 {
   try{
     IDD2NCalc();
@@ -412,3 +446,62 @@ Current::currentCompute()
       throw exceptionMsgThrown;
   }
 }
+
+template<typename Scalar>
+ModelError
+BasicCurrent<Scalar>::inputError(const bool IOTerminationCurrentFlag) const
+{
+  // Same order as the checks of the evaluation
+  ModelError error = tileInputError();
+  if ( error == NO_MODEL_ERROR ) {
+    error = bankInputError();
+  }
+  if ( error == NO_MODEL_ERROR ) {
+    error = channelInputError();
+  }
+  if ( error == NO_MODEL_ERROR ) {
+    error = timingInputError();
+  }
+  if ( error == NO_MODEL_ERROR && IOTerminationCurrentFlag
+       && interface > 128 * drs::bits ) {
+    error = INTERFACE_SIZE_ERROR;
+  }
+  return error;
+}
+
+template<typename Scalar>
+void
+BasicCurrent<Scalar>::evaluate(const bool IOTerminationCurrentFlag)
+{
+  // Same steps as the constructors from TechnologyValues
+  try {
+    if ( !technologyConstants.isValid ) {
+      deriveTechnologyConstants();
+    }
+    subArrayInitialize();
+    subArrayCompute();
+    driverUpdate();
+
+    tileInitialize();
+    tileCompute();
+
+    bankInitialize();
+    bankCompute();
+
+    channelInitialize();
+    channelCompute();
+
+    timingInitialize();
+    timingCompute();
+
+    currentInitialize();
+    includeIOTerminationCurrent = IOTerminationCurrentFlag;
+    currentCompute();
+  } catch(string exceptionMsgThrown) {
+    throw exceptionMsgThrown;
+  }
+}
+
+template class BasicCurrent<double>;
+template class BasicCurrent<Dual>;
+template class BasicCurrent<Interval>;
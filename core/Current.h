@@ -46,19 +46,108 @@
 
 #include "Timing.h"
 
-class Current : public Timing
+template<typename Scalar>
+class BasicCurrent : public BasicTiming<Scalar>
 {
     public:
-      Current() : //Empty constructor for test proposes
-          Timing()
+      typedef typename BasicTiming<Scalar>::Inputs Inputs;
+
+      using BasicTiming<Scalar>::CSLCapacitance;
+      using BasicTiming<Scalar>::DQWireCapacitance;
+      using BasicTiming<Scalar>::IddOcdRcvSlope;
+      using BasicTiming<Scalar>::bankCompute;
+      using BasicTiming<Scalar>::bankInitialize;
+      using BasicTiming<Scalar>::bankInputError;
+      using BasicTiming<Scalar>::bankWidth;
+      using BasicTiming<Scalar>::channelCompute;
+      using BasicTiming<Scalar>::channelInitialize;
+      using BasicTiming<Scalar>::channelInputError;
+      using BasicTiming<Scalar>::clkPeriod;
+      using BasicTiming<Scalar>::deriveTechnologyConstants;
+      using BasicTiming<Scalar>::dramCoreFreq;
+      using BasicTiming<Scalar>::dramFreq;
+      using BasicTiming<Scalar>::driverUpdate;
+      using BasicTiming<Scalar>::effectivePageStorage;
+      using BasicTiming<Scalar>::fullySharedResourcesCurrent;
+      using BasicTiming<Scalar>::globalDatalineCapacitance;
+      using BasicTiming<Scalar>::globalWordlineCapacitance;
+      using BasicTiming<Scalar>::hasExternalVpp;
+      using BasicTiming<Scalar>::idd2nFreqSlope;
+      using BasicTiming<Scalar>::idd2nOffset;
+      using BasicTiming<Scalar>::idd2nRefTemp;
+      using BasicTiming<Scalar>::idd2nTempAlpha;
+      using BasicTiming<Scalar>::idd2nTempBeta;
+      using BasicTiming<Scalar>::interface;
+      using BasicTiming<Scalar>::isDLL;
+      using BasicTiming<Scalar>::localBitlineCapacitance;
+      using BasicTiming<Scalar>::localWordlineCapacitance;
+      using BasicTiming<Scalar>::nBanks;
+      using BasicTiming<Scalar>::nBanksPerSemiSharedResource;
+      using BasicTiming<Scalar>::nColumnAddressLines;
+      using BasicTiming<Scalar>::nHorizontalTiles;
+      using BasicTiming<Scalar>::nRowAddressLines;
+      using BasicTiming<Scalar>::nRowsRefreshedPerARCmd;
+      using BasicTiming<Scalar>::nSubArraysPerArrayBlock;
+      using BasicTiming<Scalar>::nTilesPerBank;
+      using BasicTiming<Scalar>::pageStorage;
+      using BasicTiming<Scalar>::prefetch;
+      using BasicTiming<Scalar>::semiSharedResourcesCurrent;
+      using BasicTiming<Scalar>::subArrayCompute;
+      using BasicTiming<Scalar>::subArrayInitialize;
+      using BasicTiming<Scalar>::subArrayRowStorage;
+      using BasicTiming<Scalar>::tccd;
+      using BasicTiming<Scalar>::technologyConstants;
+      using BasicTiming<Scalar>::temperature;
+      using BasicTiming<Scalar>::tileCompute;
+      using BasicTiming<Scalar>::tileHeight;
+      using BasicTiming<Scalar>::tileInitialize;
+      using BasicTiming<Scalar>::tileInputError;
+      using BasicTiming<Scalar>::timingCompute;
+      using BasicTiming<Scalar>::timingInitialize;
+      using BasicTiming<Scalar>::timingInputError;
+      using BasicTiming<Scalar>::trc_clk;
+      using BasicTiming<Scalar>::trfc_clk;
+      using BasicTiming<Scalar>::vdd;
+      using BasicTiming<Scalar>::vpp;
+      using BasicTiming<Scalar>::vppPumpsEfficiency;
+
+      BasicCurrent() : //Empty constructor for test proposes
+          BasicTiming<Scalar>()
       {
           currentInitialize();
       }
 
-      Current(const string& technologyFileName,
-              const string& architectureFileName,
-              const bool IOTerminationCurrentFlag) :
-          Timing(technologyFileName, architectureFileName)
+      BasicCurrent(const string& technologyFileName,
+                   const string& architectureFileName,
+                   const bool IOTerminationCurrentFlag) :
+          BasicTiming<Scalar>(technologyFileName, architectureFileName)
+      {
+          currentInitialize();
+          includeIOTerminationCurrent = IOTerminationCurrentFlag;
+          try {
+              currentCompute();
+          }catch (string exceptionMsgThrown){
+              throw exceptionMsgThrown;
+          }
+      }
+
+      BasicCurrent(const Inputs& technologyValues,
+                   const bool IOTerminationCurrentFlag) :
+          BasicTiming<Scalar>(technologyValues)
+      {
+          currentInitialize();
+          includeIOTerminationCurrent = IOTerminationCurrentFlag;
+          try {
+              currentCompute();
+          }catch (string exceptionMsgThrown){
+              throw exceptionMsgThrown;
+          }
+      }
+
+      // Computes on already computed timings
+      BasicCurrent(const BasicTiming<Scalar>& timing,
+                   const bool IOTerminationCurrentFlag) :
+          BasicTiming<Scalar>(timing)
       {
           currentInitialize();
           includeIOTerminationCurrent = IOTerminationCurrentFlag;
@@ -71,62 +160,62 @@ class Current : public Timing
 
     // !! Hard-coded values converted to variables !!
     double IDD2nPercentageIfNotDll;
-    bu::quantity<drs::milliampere_unit> activeBankLeakage;
-    bu::quantity<drs::nanosecond_unit> SSAActiveTime;
-    bu::quantity<drs::bit_unit> bitProCSL;
+    bu::quantity<drs::milliampere_unit, Scalar> activeBankLeakage;
+    bu::quantity<drs::nanosecond_unit, Scalar> SSAActiveTime;
+    bu::quantity<drs::bit_unit, Scalar> bitProCSL;
 
     // Intermediate values added as variables for code cleanness
-    double nActiveSubarrays;
-    double nLocalBitlines;
-    bu::quantity<drs::milliampere_unit> IDD3nOneACTBank;
-    bu::quantity<drs::milliampere_unit> IPP3nOneACTBank;
-    bu::quantity<drs::nanocoulomb_unit> rowAddrsLinesCharge;
-    bu::quantity<drs::nanocoulomb_unit> IDD0TotalCharge;
-    bu::quantity<drs::nanocoulomb_unit> IPP0TotalCharge;
-    bu::quantity<drs::nanosecond_unit> effectiveTrc;
-    bu::quantity<drs::ampere_unit> IDD0ChargingCurrent;
-    bu::quantity<drs::ampere_unit> IPP0ChargingCurrent;
-    bu::quantity<drs::nanocoulomb_unit> IDD1TotalCharge;
-    bu::quantity<drs::ampere_unit> IDD1ChargingCurrent;
-    bu::quantity<drs::nanocoulomb_unit> colAddrsLinesCharge;
-    bu::quantity<drs::nanocoulomb_unit> IDD4TotalCharge;
-    bu::quantity<drs::milliampere_unit> ioTermRdCurrent;
-    bu::quantity<drs::ampere_unit> IDD4ChargingCurrent;
-    bu::quantity<drs::milliampere_unit> ioTermWrCurrent;
-    bu::quantity<drs::nanocoulomb_unit> iDDRefreshCharge;
-    bu::quantity<drs::nanocoulomb_unit> iPPRefreshCharge;
-    bu::quantity<drs::nanosecond_unit> effectiveTrfc;
-    bu::quantity<drs::ampere_unit> IDD5bChargingCurrent;
-    bu::quantity<drs::ampere_unit> IPP5bChargingCurrent;
+    Scalar nActiveSubarrays;
+    Scalar nLocalBitlines;
+    bu::quantity<drs::milliampere_unit, Scalar> IDD3nOneACTBank;
+    bu::quantity<drs::milliampere_unit, Scalar> IPP3nOneACTBank;
+    bu::quantity<drs::nanocoulomb_unit, Scalar> rowAddrsLinesCharge;
+    bu::quantity<drs::nanocoulomb_unit, Scalar> IDD0TotalCharge;
+    bu::quantity<drs::nanocoulomb_unit, Scalar> IPP0TotalCharge;
+    bu::quantity<drs::nanosecond_unit, Scalar> effectiveTrc;
+    bu::quantity<drs::ampere_unit, Scalar> IDD0ChargingCurrent;
+    bu::quantity<drs::ampere_unit, Scalar> IPP0ChargingCurrent;
+    bu::quantity<drs::nanocoulomb_unit, Scalar> IDD1TotalCharge;
+    bu::quantity<drs::ampere_unit, Scalar> IDD1ChargingCurrent;
+    bu::quantity<drs::nanocoulomb_unit, Scalar> colAddrsLinesCharge;
+    bu::quantity<drs::nanocoulomb_unit, Scalar> IDD4TotalCharge;
+    bu::quantity<drs::milliampere_unit, Scalar> ioTermRdCurrent;
+    bu::quantity<drs::ampere_unit, Scalar> IDD4ChargingCurrent;
+    bu::quantity<drs::milliampere_unit, Scalar> ioTermWrCurrent;
+    bu::quantity<drs::nanocoulomb_unit, Scalar> iDDRefreshCharge;
+    bu::quantity<drs::nanocoulomb_unit, Scalar> iPPRefreshCharge;
+    bu::quantity<drs::nanosecond_unit, Scalar> effectiveTrfc;
+    bu::quantity<drs::ampere_unit, Scalar> IDD5bChargingCurrent;
+    bu::quantity<drs::ampere_unit, Scalar> IPP5bChargingCurrent;
 
     // Main variables
-    bu::quantity<drs::milliampere_unit> IDD0;
-    bu::quantity<drs::milliampere_unit> IPP0;
-    bu::quantity<drs::milliampere_unit> IDD1;
-    bu::quantity<drs::milliampere_unit> IPP1;
-    bu::quantity<drs::milliampere_unit> IDD4R;
-    bu::quantity<drs::milliampere_unit> IDD4W;
-    bu::quantity<drs::milliampere_unit> IDD2n;
+    bu::quantity<drs::milliampere_unit, Scalar> IDD0;
+    bu::quantity<drs::milliampere_unit, Scalar> IPP0;
+    bu::quantity<drs::milliampere_unit, Scalar> IDD1;
+    bu::quantity<drs::milliampere_unit, Scalar> IPP1;
+    bu::quantity<drs::milliampere_unit, Scalar> IDD4R;
+    bu::quantity<drs::milliampere_unit, Scalar> IDD4W;
+    bu::quantity<drs::milliampere_unit, Scalar> IDD2n;
     //Rho parameter - refer to:
     // Jung, M. et al, "A New BankSensitive DRAMPower Model for Efficient
     // Design Space Exploration", 2016
-    double rho;
-    bu::quantity<drs::milliampere_unit> IDD3n;
-    bu::quantity<drs::milliampere_unit> IPP3n;
-    bu::quantity<drs::milliampere_unit> IDD5b;
-    bu::quantity<drs::milliampere_unit> IPP5b;
-
-    bu::quantity<drs::nanocoulomb_unit> masterWordlineCharge;
-    bu::quantity<drs::nanocoulomb_unit> localWordlineCharge;
-    bu::quantity<drs::nanocoulomb_unit> localBitlineCharge;
-    bu::quantity<drs::bit_unit> nLDQs;
-    bu::quantity<drs::nanocoulomb_unit> SSACharge;
-    double nCSLs;
-    bu::quantity<drs::nanocoulomb_unit> CSLCharge;
-    bu::quantity<drs::nanocoulomb_unit> masterDatalineCharge;
-    bu::quantity<drs::nanocoulomb_unit> DQWireCharge;
-    bu::quantity<drs::nanocoulomb_unit> readingCharge;
-    bu::quantity<drs::microampere_per_bit_unit> IddOcdRcv;
+    Scalar rho;
+    bu::quantity<drs::milliampere_unit, Scalar> IDD3n;
+    bu::quantity<drs::milliampere_unit, Scalar> IPP3n;
+    bu::quantity<drs::milliampere_unit, Scalar> IDD5b;
+    bu::quantity<drs::milliampere_unit, Scalar> IPP5b;
+
+    bu::quantity<drs::nanocoulomb_unit, Scalar> masterWordlineCharge;
+    bu::quantity<drs::nanocoulomb_unit, Scalar> localWordlineCharge;
+    bu::quantity<drs::nanocoulomb_unit, Scalar> localBitlineCharge;
+    bu::quantity<drs::bit_unit, Scalar> nLDQs;
+    bu::quantity<drs::nanocoulomb_unit, Scalar> SSACharge;
+    Scalar nCSLs;
+    bu::quantity<drs::nanocoulomb_unit, Scalar> CSLCharge;
+    bu::quantity<drs::nanocoulomb_unit, Scalar> masterDatalineCharge;
+    bu::quantity<drs::nanocoulomb_unit, Scalar> DQWireCharge;
+    bu::quantity<drs::nanocoulomb_unit, Scalar> readingCharge;
+    bu::quantity<drs::microampere_per_bit_unit, Scalar> IddOcdRcv;
 
     bool includeIOTerminationCurrent;
 
@@ -155,8 +244,20 @@ class Current : public Timing
 
     void currentCompute();
 
+    // First input error the evaluation would throw (NO_MODEL_ERROR if
+    //  none), found without evaluating, throwing or allocating
+    ModelError inputError(const bool IOTerminationCurrentFlag) const;
+
+    // Evaluates again, in place, from the current (e.g. newly assigned)
+    //  input values. The storage of the previous evaluation is reused,
+    //  so inputs passing inputError() are evaluated without allocating.
+    void evaluate(const bool IOTerminationCurrentFlag);
+
     //function for printing Currents
     void printCurrent();
 
 };
+
+typedef BasicCurrent<double> Current;
+
 #endif
@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#ifndef DUAL_H
+#define DUAL_H
+
+// Number carrying its derivatives by a set of input parameters (forward
+//  mode automatic differentiation). The model evaluated on Dual inputs
+//  (see BasicCurrent) gives every result and its derivatives by all
+//  parameters in one pass.
+// Steps (ceil, floor) are constant between their jumps, their derivative
+//  is taken as 0 everywhere, i.e. also at a jump, where there is none.
+//  Clock cycle counts are the exception: they round up through
+//  relaxedCeil (see BasicTiming::clkTiming).
+// Comparisons compare the values only.
+
+#include <cmath>
+#include <ostream>
+#include <vector>
+
+#include <boost/units/quantity.hpp>
+
+namespace bu=boost::units;
+
+using namespace std;
+
+class Dual
+{
+  public:
+    Dual() : value(0) {}
+    Dual(double value) : value(value) {}
+    // Input parameter parameterID, of nParameters
+    Dual(double value, unsigned int parameterID, unsigned int nParameters)
+        : value(value), derivatives(nParameters, 0.0)
+    {
+        derivatives[parameterID] = 1.0;
+    }
+
+    double value;
+    // Derivatives by the parameters, empty for a constant
+    vector<double> derivatives;
+
+    double derivative(unsigned int parameterID) const
+    {
+        return parameterID < derivatives.size() ? derivatives[parameterID]
+                                                : 0.0;
+    }
+
+    Dual& operator+=(const Dual& other);
+    Dual& operator-=(const Dual& other);
+    Dual& operator*=(const Dual& other);
+    Dual& operator/=(const Dual& other);
+
+    // Derivatives of a * x + b * y
+    static vector<double> combine(double a, const vector<double>& x,
+                                  double b, const vector<double>& y)
+    {
+        vector<double> result(x.size() > y.size() ? x.size() : y.size(),
+                              0.0);
+        for ( unsigned int it = 0; it < x.size(); it++ ) {
+            result[it] = a * x[it];
+        }
+        for ( unsigned int it = 0; it < y.size(); it++ ) {
+            result[it] += b * y[it];
+        }
+        return result;
+    }
+};
+
+inline Dual operator-(const Dual& x)
+{
+    Dual result(-x.value);
+    result.derivatives = Dual::combine(-1.0, x.derivatives,
+                                       0.0, vector<double>());
+    return result;
+}
+
+inline Dual operator+(const Dual& x, const Dual& y)
+{
+    Dual result(x.value + y.value);
+    result.derivatives = Dual::combine(1.0, x.derivatives,
+                                       1.0, y.derivatives);
+    return result;
+}
+
+inline Dual operator-(const Dual& x, const Dual& y)
+{
+    Dual result(x.value - y.value);
+    result.derivatives = Dual::combine(1.0, x.derivatives,
+                                       -1.0, y.derivatives);
+    return result;
+}
+
+inline Dual operator*(const Dual& x, const Dual& y)
+{
+    Dual result(x.value * y.value);
+    result.derivatives = Dual::combine(y.value, x.derivatives,
+                                       x.value, y.derivatives);
+    return result;
+}
+
+inline Dual operator/(const Dual& x, const Dual& y)
+{
+    Dual result(x.value / y.value);
+    result.derivatives = Dual::combine(1.0 / y.value, x.derivatives,
+                                       -result.value / y.value,
+                                       y.derivatives);
+    return result;
+}
+
+inline Dual& Dual::operator+=(const Dual& other)
+{
+    return *this = *this + other;
+}
+
+inline Dual& Dual::operator-=(const Dual& other)
+{
+    return *this = *this - other;
+}
+
+inline Dual& Dual::operator*=(const Dual& other)
+{
+    return *this = *this * other;
+}
+
+inline Dual& Dual::operator/=(const Dual& other)
+{
+    return *this = *this / other;
+}
+
+inline bool operator==(const Dual& x, const Dual& y)
+{ return x.value == y.value; }
+inline bool operator!=(const Dual& x, const Dual& y)
+{ return x.value != y.value; }
+inline bool operator<(const Dual& x, const Dual& y)
+{ return x.value < y.value; }
+inline bool operator>(const Dual& x, const Dual& y)
+{ return x.value > y.value; }
+inline bool operator<=(const Dual& x, const Dual& y)
+{ return x.value <= y.value; }
+inline bool operator>=(const Dual& x, const Dual& y)
+{ return x.value >= y.value; }
+
+// f(x), given f(x.value) and f'(x.value)
+inline Dual chain(const Dual& x, double value, double slope)
+{
+    Dual result(value);
+    result.derivatives = Dual::combine(slope, x.derivatives,
+                                       0.0, vector<double>());
+    return result;
+}
+
+inline Dual ceil(const Dual& x) { return Dual(std::ceil(x.value)); }
+inline Dual floor(const Dual& x) { return Dual(std::floor(x.value)); }
+
+// ceil with the derivative of its argument, as if the rounding were
+//  continuous (a relaxation of the step, not its derivative)
+inline Dual relaxedCeil(const Dual& x)
+{
+    return chain(x, std::ceil(x.value), 1);
+}
+
+inline Dual exp(const Dual& x)
+{
+    double value = std::exp(x.value);
+    return chain(x, value, value);
+}
+
+inline Dual log(const Dual& x)
+{
+    return chain(x, std::log(x.value), 1.0 / x.value);
+}
+
+inline Dual log2(const Dual& x)
+{
+    return chain(x, std::log2(x.value), 1.0 / (x.value * std::log(2.0)));
+}
+
+inline ostream& operator<<(ostream& output, const Dual& x)
+{
+    return output << x.value;
+}
+
+// Numbers times quantities of Dual value (Boost.Units only multiplies
+//  and divides quantities by numbers of their own value type)
+template<class Unit>
+inline bu::quantity<Unit, Dual>
+operator*(double x, const bu::quantity<Unit, Dual>& y)
+{
+    return bu::quantity<Unit, Dual>::from_value(x * y.value());
+}
+
+template<class Unit>
+inline bu::quantity<Unit, Dual>
+operator*(const bu::quantity<Unit, Dual>& x, double y)
+{
+    return bu::quantity<Unit, Dual>::from_value(x.value() * y);
+}
+
+template<class Unit>
+inline bu::quantity<Unit, Dual>
+operator/(const bu::quantity<Unit, Dual>& x, double y)
+{
+    return bu::quantity<Unit, Dual>::from_value(x.value() / y);
+}
+
+template<class Unit>
+inline typename bu::power_typeof_helper<bu::quantity<Unit, Dual>,
+                                        bu::static_rational<-1> >::type
+operator/(double x, const bu::quantity<Unit, Dual>& y)
+{
+    typedef typename bu::power_typeof_helper<
+                bu::quantity<Unit, Dual>, bu::static_rational<-1> >::type
+            Inverse;
+    return Inverse::from_value(x / y.value());
+}
+
+// Quantities of double value times Dual numbers (e.g. a constant of the
+//  model times a factor of the inputs)
+template<class Unit>
+inline bu::quantity<Unit, Dual>
+operator*(const bu::quantity<Unit, double>& x, const Dual& y)
+{
+    return bu::quantity<Unit, Dual>::from_value(x.value() * y);
+}
+
+template<class Unit>
+inline bu::quantity<Unit, Dual>
+operator*(const Dual& x, const bu::quantity<Unit, double>& y)
+{
+    return bu::quantity<Unit, Dual>::from_value(x * y.value());
+}
+
+template<class Unit>
+inline bu::quantity<Unit, Dual>
+operator/(const bu::quantity<Unit, double>& x, const Dual& y)
+{
+    return bu::quantity<Unit, Dual>::from_value(x.value() / y);
+}
+
+#endif // DUAL_H
@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef INTERVAL_H
+#define INTERVAL_H
+
+// Interval holding a number which is only known to be between a lower and
+//  an upper bound. The model evaluated on Interval inputs (see
+//  BasicCurrent) gives bounds of every result over all inputs in the
+//  intervals in one pass (interval arithmetic).
+// The bounds are rounded outwards: the exact rounding error of each
+//  operation (TwoSum, fma) tells in which direction the rounded bound
+//  lies, which is then moved by one ulp, so the exact result is never
+//  lost. exp and log, which are not correctly rounded, are widened by one
+//  ulp on both sides. Steps (ceil, floor) are monotone, they map the
+//  bounds.
+// The bounds hold for the whole box of inputs, but need not be tight: a
+//  number used twice (e.g. x - x) is taken as two independent ones.
+// A comparison is only answered if it holds for all numbers of the
+//  intervals, a branch of the model which depends on the numbers throws
+//  instead. So does a division by an interval holding 0.
+
+#include <cmath>
+#include <ostream>
+#include <string>
+
+#include <boost/units/quantity.hpp>
+
+namespace bu=boost::units;
+
+using namespace std;
+
+class Interval
+{
+  public:
+    Interval() : lower(0), upper(0) {}
+    Interval(double value) : lower(value), upper(value) {}
+    Interval(double lower, double upper) : lower(lower), upper(upper) {}
+
+    double lower;
+    double upper;
+
+    Interval& operator+=(const Interval& other);
+    Interval& operator-=(const Interval& other);
+    Interval& operator*=(const Interval& other);
+    Interval& operator/=(const Interval& other);
+
+    // Comparison whose answer is not the same for all numbers of the
+    //  intervals, i.e. a branch of the model taken for part of them: throws
+    static bool undecided();
+
+    // Bounds of a rounded result, given the sign of its exact error
+    //  (exact result - rounded result)
+    static double roundedDown(double rounded, double error)
+    {
+        return error < 0 ? nextafter(rounded, -HUGE_VAL) : rounded;
+    }
+    static double roundedUp(double rounded, double error)
+    {
+        return error > 0 ? nextafter(rounded, HUGE_VAL) : rounded;
+    }
+
+    // Exact error of x + y (TwoSum)
+    static double sumError(double x, double y, double sum)
+    {
+        double yVirtual = sum - x;
+        double xVirtual = sum - yVirtual;
+        return ( x - xVirtual ) + ( y - yVirtual );
+    }
+    // Bounds of x + y, x * y and x / y, for isUpper the upper one
+    static double sum(double x, double y, bool isUpper)
+    {
+        double rounded = x + y;
+        double error = sumError(x, y, rounded);
+        return isUpper ? roundedUp(rounded, error)
+                       : roundedDown(rounded, error);
+    }
+    static double product(double x, double y, bool isUpper)
+    {
+        double rounded = x * y;
+        double error = fma(x, y, -rounded);
+        return isUpper ? roundedUp(rounded, error)
+                       : roundedDown(rounded, error);
+    }
+    static double quotient(double x, double y, bool isUpper)
+    {
+        double rounded = x / y;
+        // x - rounded * y, the error times y
+        double remainder = fma(-rounded, y, x);
+        double error = y < 0 ? -remainder : remainder;
+        return isUpper ? roundedUp(rounded, error)
+                       : roundedDown(rounded, error);
+    }
+};
+
+inline Interval operator-(const Interval& x)
+{
+    return Interval(-x.upper, -x.lower);
+}
+
+inline Interval operator+(const Interval& x, const Interval& y)
+{
+    return Interval(Interval::sum(x.lower, y.lower, false),
+                    Interval::sum(x.upper, y.upper, true));
+}
+
+inline Interval operator-(const Interval& x, const Interval& y)
+{
+    return x + (-y);
+}
+
+inline Interval operator*(const Interval& x, const Interval& y)
+{
+    const double xBounds[2] = { x.lower, x.upper };
+    const double yBounds[2] = { y.lower, y.upper };
+    Interval result(HUGE_VAL, -HUGE_VAL);
+    for ( int xIt = 0; xIt < 2; xIt++ ) {
+        for ( int yIt = 0; yIt < 2; yIt++ ) {
+            result.lower = fmin(result.lower, Interval::product(
+                                    xBounds[xIt], yBounds[yIt], false));
+            result.upper = fmax(result.upper, Interval::product(
+                                    xBounds[xIt], yBounds[yIt], true));
+        }
+    }
+    return result;
+}
+
+inline Interval operator/(const Interval& x, const Interval& y)
+{
+    if ( y.lower <= 0 && y.upper >= 0 ) {
+        throw string("[ERROR] A divisor of the model reaches zero.\n");
+    }
+    const double xBounds[2] = { x.lower, x.upper };
+    const double yBounds[2] = { y.lower, y.upper };
+    Interval result(HUGE_VAL, -HUGE_VAL);
+    for ( int xIt = 0; xIt < 2; xIt++ ) {
+        for ( int yIt = 0; yIt < 2; yIt++ ) {
+            result.lower = fmin(result.lower, Interval::quotient(
+                                    xBounds[xIt], yBounds[yIt], false));
+            result.upper = fmax(result.upper, Interval::quotient(
+                                    xBounds[xIt], yBounds[yIt], true));
+        }
+    }
+    return result;
+}
+
+inline Interval& Interval::operator+=(const Interval& other)
+{
+    return *this = *this + other;
+}
+
+inline Interval& Interval::operator-=(const Interval& other)
+{
+    return *this = *this - other;
+}
+
+inline Interval& Interval::operator*=(const Interval& other)
+{
+    return *this = *this * other;
+}
+
+inline Interval& Interval::operator/=(const Interval& other)
+{
+    return *this = *this / other;
+}
+
+inline bool Interval::undecided()
+{
+    throw string("[ERROR] A branch of the model is taken for part of the "
+                 "intervals only, split them at it.\n");
+}
+
+inline bool operator<(const Interval& x, const Interval& y)
+{
+    if ( x.upper < y.lower ) {
+        return true;
+    }
+    if ( x.lower >= y.upper ) {
+        return false;
+    }
+    return Interval::undecided();
+}
+
+inline bool operator<=(const Interval& x, const Interval& y)
+{
+    if ( x.upper <= y.lower ) {
+        return true;
+    }
+    if ( x.lower > y.upper ) {
+        return false;
+    }
+    return Interval::undecided();
+}
+
+inline bool operator>(const Interval& x, const Interval& y)
+{ return y < x; }
+inline bool operator>=(const Interval& x, const Interval& y)
+{ return y <= x; }
+
+inline bool operator==(const Interval& x, const Interval& y)
+{
+    if ( x.lower == x.upper && y.lower == y.upper ) {
+        return x.lower == y.lower;
+    }
+    if ( x.upper < y.lower || y.upper < x.lower ) {
+        return false;
+    }
+    return Interval::undecided();
+}
+
+inline bool operator!=(const Interval& x, const Interval& y)
+{ return !( x == y ); }
+
+inline Interval ceil(const Interval& x)
+{
+    return Interval(std::ceil(x.lower), std::ceil(x.upper));
+}
+
+inline Interval floor(const Interval& x)
+{
+    return Interval(std::floor(x.lower), std::floor(x.upper));
+}
+
+// f(x) of a monotone increasing f, not correctly rounded: one ulp wider
+inline Interval widened(double lower, double upper)
+{
+    return Interval(nextafter(lower, -HUGE_VAL), nextafter(upper, HUGE_VAL));
+}
+
+inline Interval exp(const Interval& x)
+{
+    Interval result = widened(std::exp(x.lower), std::exp(x.upper));
+    result.lower = fmax(result.lower, 0.0);
+    return result;
+}
+
+inline Interval log(const Interval& x)
+{
+    return widened(std::log(x.lower), std::log(x.upper));
+}
+
+inline Interval log2(const Interval& x)
+{
+    return widened(std::log2(x.lower), std::log2(x.upper));
+}
+
+inline ostream& operator<<(ostream& output, const Interval& x)
+{
+    return output << "[" << x.lower << ", " << x.upper << "]";
+}
+
+// Numbers times quantities of Interval value (Boost.Units only multiplies
+//  and divides quantities by numbers of their own value type)
+template<class Unit>
+inline bu::quantity<Unit, Interval>
+operator*(double x, const bu::quantity<Unit, Interval>& y)
+{
+    return bu::quantity<Unit, Interval>::from_value(x * y.value());
+}
+
+template<class Unit>
+inline bu::quantity<Unit, Interval>
+operator*(const bu::quantity<Unit, Interval>& x, double y)
+{
+    return bu::quantity<Unit, Interval>::from_value(x.value() * y);
+}
+
+template<class Unit>
+inline bu::quantity<Unit, Interval>
+operator/(const bu::quantity<Unit, Interval>& x, double y)
+{
+    return bu::quantity<Unit, Interval>::from_value(x.value() / y);
+}
+
+template<class Unit>
+inline typename bu::power_typeof_helper<bu::quantity<Unit, Interval>,
+                                        bu::static_rational<-1> >::type
+operator/(double x, const bu::quantity<Unit, Interval>& y)
+{
+    typedef typename bu::power_typeof_helper<
+                bu::quantity<Unit, Interval>, bu::static_rational<-1> >::type
+            Inverse;
+    return Inverse::from_value(x / y.value());
+}
+
+// Quantities of double value times Interval numbers
+template<class Unit>
+inline bu::quantity<Unit, Interval>
+operator*(const bu::quantity<Unit, double>& x, const Interval& y)
+{
+    return bu::quantity<Unit, Interval>::from_value(x.value() * y);
+}
+
+template<class Unit>
+inline bu::quantity<Unit, Interval>
+operator*(const Interval& x, const bu::quantity<Unit, double>& y)
+{
+    return bu::quantity<Unit, Interval>::from_value(x * y.value());
+}
+
+template<class Unit>
+inline bu::quantity<Unit, Interval>
+operator/(const bu::quantity<Unit, double>& x, const Interval& y)
+{
+    return bu::quantity<Unit, Interval>::from_value(x.value() / y);
+}
+
+#endif // INTERVAL_H
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#include "ModelError.h"
+
+const char*
+modelErrorMessage(ModelError error)
+{
+    switch ( error ) {
+    case NO_MODEL_ERROR:
+        return "";
+    case ONE_TILE_PAGE_SPANNING_ERROR:
+        return "[ERROR] If architecture has 1 tile per bank, "
+               "the page spanning factor across the tile must be 1.";
+    case TWO_TILES_PAGE_SPANNING_ERROR:
+        return "[ERROR] If architecture has 2 tile per bank, "
+               "the page spanning factor across the tile must be 1 or 0.5.";
+    case FOUR_TILES_PAGE_SPANNING_ERROR:
+        return "[ERROR] If architecture has 4 tile per bank, "
+               "the page spanning factor across the tile "
+               "must be 1, 0.5 or 0.25.";
+    case TILES_PER_BANK_ERROR:
+        return "[ERROR] Architecture must have 1, 2 or 4 tile per bank.";
+    case BITLINE_ARCHITECTURE_ERROR:
+        return "[ERROR] Bitline architecture must be "
+               "either \'OPEN\' or \'FOLDED\'.";
+    case TILES_POWER_OF_TWO_ERROR:
+        return "[ERROR] Total number of tiles per bank "
+               "must be a power of two.";
+    case TILES_DIRECTION_ERROR:
+        return "[ERROR] Number of tiles in either direction "
+               "must be a power of two and less than or equal to the "
+               "number of tiles per bank.";
+    case BANKS_POWER_OF_TWO_ERROR:
+        return "[ERROR] Total number of banks must be a power of two.";
+    case BANKS_DIRECTION_ERROR:
+        return "[ERROR] Number of banks in either direction "
+               "must be a power of two and less than or equal to the "
+               "total number of banks.";
+    case BANKS_MISMATCH_ERROR:
+        return "[ERROR] Total number of banks does not match with "
+               "the number of banks in both directions.";
+    case TEMPERATURE_RANGE_ERROR:
+        return "[ERROR] Operating temperature is defined "
+               "only from 0 to 95 degrees Celsius.";
+    case INTERFACE_SIZE_ERROR:
+        return "[ERROR] Custom interface size "
+               "(greater than 128 bits or not a power of two) "
+               "model is not yet implemented!";
+    }
+    return "[ERROR] Unknown model error.";
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+
+#ifndef MODELERROR_H
+#define MODELERROR_H
+
+// Configurations rejected by the model.
+// The model throws the message of an error as a string. The checks are
+//  also available without throwing (see Current::inputError), for callers
+//  which must not allocate per evaluation, e.g. the C interface.
+enum ModelError
+{
+    NO_MODEL_ERROR = 0,
+    ONE_TILE_PAGE_SPANNING_ERROR,
+    TWO_TILES_PAGE_SPANNING_ERROR,
+    FOUR_TILES_PAGE_SPANNING_ERROR,
+    TILES_PER_BANK_ERROR,
+    BITLINE_ARCHITECTURE_ERROR,
+    TILES_POWER_OF_TWO_ERROR,
+    TILES_DIRECTION_ERROR,
+    BANKS_POWER_OF_TWO_ERROR,
+    BANKS_DIRECTION_ERROR,
+    BANKS_MISMATCH_ERROR,
+    TEMPERATURE_RANGE_ERROR,
+    INTERFACE_SIZE_ERROR
+};
+
+// Message of an error, starting with "[ERROR] "
+const char* modelErrorMessage(ModelError error);
+
+#endif // MODELERROR_H
@@ -39,20 +39,24 @@
 
 
 #include "SubArray.h"
+#include "Dual.h"
+#include "Interval.h"
 
 namespace si=boost::units::si;
 namespace drs=boost::units::dramspec;
 
+template<typename Scalar>
 void
-SubArray::subArrayInitialize()
+BasicSubArray<Scalar>::subArrayInitialize()
 {
     subArrayRowStorage = 0*drs::bits;
     subArrayWidth = 0*drs::micrometers;
     subArrayHeight = 0*drs::micrometers;
 }
 
+template<typename Scalar>
 void
-SubArray::subArrayStorageCalc()
+BasicSubArray<Scalar>::subArrayStorageCalc()
 {
     subArrayRowStorage = (cellsPerLWL - cellsPerLWLRedundancy)
                          * drs::bits;
@@ -64,16 +68,18 @@ SubArray::subArrayStorageCalc()
                       / drs::bits;
 }
 
+template<typename Scalar>
 void
-SubArray::subArrayLengthCalc()
+BasicSubArray<Scalar>::subArrayLengthCalc()
 {
     subArrayWidth = cellsPerLWL * cellWidth + LWLDriverWidth;
 
     subArrayHeight = cellsPerLBL * cellHeight + BLSenseAmpHeight;
 }
 
+template<typename Scalar>
 void
-SubArray::subArrayCompute()
+BasicSubArray<Scalar>::subArrayCompute()
 {
     try {
         subArrayStorageCalc();
@@ -83,8 +89,9 @@ SubArray::subArrayCompute()
     subArrayLengthCalc();
 }
 
+template<typename Scalar>
 void
-SubArray::driverUpdate()
+BasicSubArray<Scalar>::driverUpdate()
 {
 
     // TODO: CHANGE FOR A ABSOLUTE VALUE
@@ -133,3 +140,7 @@ SubArray::driverUpdate()
         WRDriverResistance = WRDriverResistance - 200*drs::ohms;
     }
 }
+
+template class BasicSubArray<double>;
+template class BasicSubArray<Dual>;
+template class BasicSubArray<Interval>;
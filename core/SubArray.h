@@ -51,18 +51,52 @@ namespace si=boost::units::si;
 namespace inf=boost::units::information;
 namespace drs=boost::units::dramspec;
 
-class SubArray : public TechnologyValues
+// Inputs of the model evaluated on Scalar numbers: the values as read for
+//  double, their values only for other scalar types (e.g. Dual)
+template<typename Scalar>
+struct ModelInputs
+{
+    typedef TechnologyInputs<Scalar> type;
+};
+
+template<>
+struct ModelInputs<double>
+{
+    typedef TechnologyValues type;
+};
+
+// The model is generic over the type of its numbers, SubArray, ...,
+//  Current evaluate it on double.
+template<typename Scalar>
+class BasicSubArray : public ModelInputs<Scalar>::type
 {
   public:
-    SubArray() : //Empty constructor for test proposes
-        TechnologyValues()
+    typedef typename ModelInputs<Scalar>::type Inputs;
+
+    using Inputs::cellsPerLWL;
+    using Inputs::cellsPerLWLRedundancy;
+    using Inputs::cellsPerLBL;
+    using Inputs::cellsPerLBLRedundancy;
+    using Inputs::cellWidth;
+    using Inputs::cellHeight;
+    using Inputs::LWLDriverWidth;
+    using Inputs::BLSenseAmpHeight;
+    using Inputs::pageStorage;
+    using Inputs::GWLDriverResistance;
+    using Inputs::LWLDriverResistance;
+    using Inputs::WRDriverResistance;
+    using Inputs::technologyConstants;
+    using Inputs::deriveTechnologyConstants;
+
+    BasicSubArray() : //Empty constructor for test proposes
+        Inputs()
     {
         subArrayInitialize();
     }
 
-    SubArray(const string& technologyFileName,
-             const string& architectureFileName) :
-        TechnologyValues(technologyFileName, architectureFileName)
+    BasicSubArray(const string& technologyFileName,
+                  const string& architectureFileName) :
+        Inputs(TechnologyValues(technologyFileName, architectureFileName))
     {
         subArrayInitialize();
         try {
@@ -73,20 +107,37 @@ class SubArray : public TechnologyValues
         driverUpdate();
     }
 
+    // Computes from already read (and possibly modified) input values
+    BasicSubArray(const Inputs& technologyValues) :
+        Inputs(technologyValues)
+    {
+        // Usually derived once, when the technology was read
+        if ( !technologyConstants.isValid ) {
+            deriveTechnologyConstants();
+        }
+        subArrayInitialize();
+        try {
+            subArrayCompute();
+        }catch (string exceptionMsgThrown){
+            throw exceptionMsgThrown;
+        }
+        driverUpdate();
+    }
+
     // Size in number of bits of a single subarray
-    bu::quantity<drs::bit_unit> subArrayStorage;
+    bu::quantity<drs::bit_unit, Scalar> subArrayStorage;
 
     // Size in number of bits of a single physical row of a subarray
-    bu::quantity<drs::bit_unit> subArrayRowStorage;
+    bu::quantity<drs::bit_unit, Scalar> subArrayRowStorage;
 
     // Size in number of bits of a single column physical of a subarray
-    bu::quantity<drs::bit_unit> subArrayColumnStorage;
+    bu::quantity<drs::bit_unit, Scalar> subArrayColumnStorage;
 
     //the width of the subarray which should be calculated
-    bu::quantity<drs::micrometer_unit> subArrayWidth;
+    bu::quantity<drs::micrometer_unit, Scalar> subArrayWidth;
 
     //the height of the subarray which should be calculated
-    bu::quantity<drs::micrometer_unit>  subArrayHeight;
+    bu::quantity<drs::micrometer_unit, Scalar>  subArrayHeight;
 
     void subArrayInitialize();
 
@@ -98,4 +149,7 @@ class SubArray : public TechnologyValues
 
     void driverUpdate();
 };
+
+typedef BasicSubArray<double> SubArray;
+
 #endif//SUBARRAY_H
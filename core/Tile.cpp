@@ -39,9 +39,12 @@
 
 
 #include "Tile.h"
+#include "Dual.h"
+#include "Interval.h"
 
+template<typename Scalar>
 void
-Tile::tileInitialize()
+BasicTile<Scalar>::tileInitialize()
 {
     tileStorage = 0*drs::bits;
     tileWidth = 0*drs::micrometers;
@@ -52,28 +55,25 @@ Tile::tileInitialize()
 
 }
 
+template<typename Scalar>
 void
-Tile::tileStorageCalc()
+BasicTile<Scalar>::tileStorageCalc()
 {
-    bu::quantity<drs::bit_unit> bankStorage(channelSize/nBanks);
+    bu::quantity<drs::bit_unit, Scalar> bankStorage(channelSize/nBanks);
 
     tileStorage = bankStorage/nTilesPerBank;
 
 }
 
-void
-Tile::checkTileDataConsistency()
+template<typename Scalar>
+ModelError
+BasicTile<Scalar>::tileInputError() const
 {
     // Check input consistency with respect to tilesPerBank & pageSpanningFactor
     if ( nTilesPerBank == 1.0 ) {
         if (   pageSpanningFactor != 1.0 )
         {
-            std::string exceptionMsgThrown("[ERROR] ");
-            exceptionMsgThrown.append("If architecture has ");
-            exceptionMsgThrown.append("1 tile per bank, ");
-            exceptionMsgThrown.append("the page spanning factor ");
-            exceptionMsgThrown.append("across the tile must be 1.");
-            throw exceptionMsgThrown;
+            return ONE_TILE_PAGE_SPANNING_ERROR;
         }
     }
 
@@ -82,12 +82,7 @@ Tile::checkTileDataConsistency()
                && pageSpanningFactor != 0.5
                )
         {
-            std::string exceptionMsgThrown("[ERROR] ");
-            exceptionMsgThrown.append("If architecture has ");
-            exceptionMsgThrown.append("2 tile per bank, ");
-            exceptionMsgThrown.append("the page spanning factor ");
-            exceptionMsgThrown.append("across the tile must be 1 or 0.5.");
-            throw exceptionMsgThrown;
+            return TWO_TILES_PAGE_SPANNING_ERROR;
         }
     }
 
@@ -96,25 +91,34 @@ Tile::checkTileDataConsistency()
             && pageSpanningFactor != 0.5
             && pageSpanningFactor != 0.25 )
         {
-            std::string exceptionMsgThrown("[ERROR] ");
-            exceptionMsgThrown.append("If architecture has ");
-            exceptionMsgThrown.append("4 tile per bank, ");
-            exceptionMsgThrown.append("the page spanning factor ");
-            exceptionMsgThrown.append("across the tile must be 1, 0.5 or 0.25.");
-            throw exceptionMsgThrown;
+            return FOUR_TILES_PAGE_SPANNING_ERROR;
         }
     }
 
     else {
-        std::string exceptionMsgThrown("[ERROR] ");
-        exceptionMsgThrown.append("Architecture must have ");
-        exceptionMsgThrown.append("1, 2 or 4 tile per bank.");
-        throw exceptionMsgThrown;
+        return TILES_PER_BANK_ERROR;
+    }
+
+    if ( BLArchitecture != "OPEN" && BLArchitecture != "FOLDED" ) {
+        return BITLINE_ARCHITECTURE_ERROR;
     }
+
+    return NO_MODEL_ERROR;
 }
 
+template<typename Scalar>
 void
-Tile::tileLenghtCalc()
+BasicTile<Scalar>::checkTileDataConsistency()
+{
+    ModelError error = tileInputError();
+    if ( error != NO_MODEL_ERROR ) {
+        throw std::string(modelErrorMessage(error));
+    }
+}
+
+template<typename Scalar>
+void
+BasicTile<Scalar>::tileLenghtCalc()
 {
     nSubArraysPerArrayBlock = ceil(
                                     SCALE_QUANTITY(pageStorage, drs::bit_unit)
@@ -153,16 +157,14 @@ Tile::tileLenghtCalc()
     }
 
     else {
-        std::string exceptionMsgThrown("[ERROR] ");
-        exceptionMsgThrown.append("Bitline architecture must be ");
-        exceptionMsgThrown.append("either \'OPEN\' or \'FOLDED\'.");
-        throw exceptionMsgThrown;
+        throw std::string(modelErrorMessage(BITLINE_ARCHITECTURE_ERROR));
     }
 
 }
 
+template<typename Scalar>
 void
-Tile::tileCompute()
+BasicTile<Scalar>::tileCompute()
 {
     tileStorageCalc();
 
@@ -175,3 +177,6 @@ Tile::tileCompute()
 
 }
 
+template class BasicTile<double>;
+template class BasicTile<Dual>;
+template class BasicTile<Interval>;
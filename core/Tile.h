@@ -45,24 +45,54 @@
 //being the tile a grouping of subarrays which are a grouping of cells.
 
 #include "SubArray.h"
+#include "ModelError.h"
 
 namespace bu=boost::units;
 namespace si=boost::units::si;
 namespace inf=boost::units::information;
 namespace drs=boost::units::dramspec;
 
-class Tile : public SubArray
+template<typename Scalar>
+class BasicTile : public BasicSubArray<Scalar>
 {
   public:
-    Tile() : //Empty constructor for test proposes
-        SubArray()
+    typedef typename BasicSubArray<Scalar>::Inputs Inputs;
+
+    using BasicSubArray<Scalar>::channelSize;
+    using BasicSubArray<Scalar>::nBanks;
+    using BasicSubArray<Scalar>::nTilesPerBank;
+    using BasicSubArray<Scalar>::pageSpanningFactor;
+    using BasicSubArray<Scalar>::BLArchitecture;
+    using BasicSubArray<Scalar>::pageStorage;
+    using BasicSubArray<Scalar>::subArrayToPageFactor;
+    using BasicSubArray<Scalar>::subArrayRowStorage;
+    using BasicSubArray<Scalar>::subArrayStorage;
+    using BasicSubArray<Scalar>::subArrayWidth;
+    using BasicSubArray<Scalar>::subArrayHeight;
+    using BasicSubArray<Scalar>::LWLDriverWidth;
+    using BasicSubArray<Scalar>::BLSenseAmpHeight;
+    using BasicSubArray<Scalar>::colDecoderHeight;
+
+    BasicTile() : //Empty constructor for test proposes
+        BasicSubArray<Scalar>()
     {
         tileInitialize();
     }
 
-    Tile(const string& technologyFileName,
-         const string& architectureFileName):
-        SubArray(technologyFileName, architectureFileName)
+    BasicTile(const string& technologyFileName,
+              const string& architectureFileName):
+        BasicSubArray<Scalar>(technologyFileName, architectureFileName)
+    {
+        tileInitialize();
+        try {
+            tileCompute();
+        }catch (string exceptionMsgThrown){
+            throw exceptionMsgThrown;
+        }
+    }
+
+    BasicTile(const Inputs& technologyValues):
+        BasicSubArray<Scalar>(technologyValues)
     {
         tileInitialize();
         try {
@@ -73,22 +103,24 @@ class Tile : public SubArray
     }
 
     // Size in number of bits of a single tile
-    bu::quantity<drs::bit_unit> tileStorage;
+    bu::quantity<drs::bit_unit, Scalar> tileStorage;
 
     // Width in micrometer of a single tile
-    bu::quantity<drs::micrometer_unit> tileWidth;
+    bu::quantity<drs::micrometer_unit, Scalar> tileWidth;
     // Height in micrometer of a single tile
-    bu::quantity<drs::micrometer_unit> tileHeight;
+    bu::quantity<drs::micrometer_unit, Scalar> tileHeight;
 
     // Number of subarrays per tile in the wordline direction
-    double nSubArraysPerArrayBlock;
+    Scalar nSubArraysPerArrayBlock;
     // Number of subarrays per tile in the bitline direction
-    double nArrayBlocksPerTile;
+    Scalar nArrayBlocksPerTile;
 
     void tileInitialize();
 
     void tileStorageCalc();
 
+    // First inconsistency of the tile inputs (NO_MODEL_ERROR if none)
+    ModelError tileInputError() const;
     void checkTileDataConsistency();
     void tileLenghtCalc();
 
@@ -96,4 +128,6 @@ class Tile : public SubArray
 
 };
 
+typedef BasicTile<double> Tile;
+
 #endif // TILE_H
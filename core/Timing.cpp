@@ -39,12 +39,21 @@
 
 
 #include "Timing.h"
+#include "Dual.h"
+#include "Interval.h"
 #include <math.h>
 #include <iostream>
 #include <fstream>
 
+// Number of time constants a signal takes to reach a percentage of its
+//  final value, see timeToPercentage
+static const double tauTo63Percent = timeToPercentage(63);
+static const double tauTo90Percent = timeToPercentage(90);
+static const double tauTo99Percent = timeToPercentage(99);
+
+template<typename Scalar>
 void
-Timing::timingInitialize()
+BasicTiming<Scalar>::timingInitialize()
 {
 
     cellDelay = 0*drs::nanoseconds;
@@ -119,8 +128,9 @@ Timing::timingInitialize()
 
 }
 
+template<typename Scalar>
 void
-Timing::trcdCalc()
+BasicTiming<Scalar>::trcdCalc()
 {
     // Trcd is divided as following:
     // the first part is for wordline driver delay estimated as 2 ns
@@ -133,19 +143,17 @@ Timing::trcdCalc()
     // resistance of cells in wordline direction
 
     // Calculating tau for cell celltau ( in ns )
-    cellDelay = timeToPercentage(90)
-              * SCALE_QUANTITY(capacitancePerCell, drs::nanofarad_unit)
-              * SCALE_QUANTITY(resistancePerCell, drs::ohm_unit);
+    cellDelay = technologyConstants.cellDelay;
 
     localWordlineResistance = LWLDriverResistance
                               + (cellsPerLWL *  resistancePerWLCell);
 
     // Calculating wordline total capacitance
     localWordlineCapacitance = cellsPerLWL
-            * SCALE_QUANTITY(capacitancePerWLCell, drs::nanofarad_unit);
+            * technologyConstants.capacitancePerWLCell;
 
     // Calculating wltau( in ns )
-    localWordlineDelay = timeToPercentage(90)
+    localWordlineDelay = tauTo90Percent
             * localWordlineCapacitance
             * localWordlineResistance;
 
@@ -154,10 +162,10 @@ Timing::trcdCalc()
 
     // Calculating bitline total capacitance
     localBitlineCapacitance = cellsPerLBL
-          * SCALE_QUANTITY(capacitancePerBLCell, drs::nanofarad_unit);
+          * technologyConstants.capacitancePerBLCell;
 
     // Calculating the bltau( in ns )
-    localBitlineDelay = timeToPercentage(90)
+    localBitlineDelay = tauTo90Percent
             * localBitlineResistance
             * localBitlineCapacitance;
 
@@ -172,14 +180,14 @@ Timing::trcdCalc()
     globalWordlineCapacitance =
            SCALE_QUANTITY(40 * drs::femtofarads, drs::nanofarad_unit)
             * nSubArraysPerArrayBlock
-           + SCALE_QUANTITY(wireCapacitance, drs::nanofarad_per_millimeter_unit)
+           + technologyConstants.wireCapacitancePerMillimeter
             * SCALE_QUANTITY(tileWidth, drs::millimeter_unit);
 
     // Calculating delay through global wordline driver and wiring
     globalWordlineDelay = driverEnableDelay
-        + timeToPercentage(90) * GWLDriverResistance
+        + tauTo90Percent * GWLDriverResistance
           * globalWordlineCapacitance
-        + timeToPercentage(63) * globalWordlineResistance
+        + tauTo63Percent * globalWordlineResistance
           * globalWordlineCapacitance;
     
     // Calculating trcd
@@ -188,10 +196,10 @@ Timing::trcdCalc()
             + cellDelay
             + localBitlineDelay;
 
-    cellDelay99p = timeToPercentage(99) / timeToPercentage(90)
+    cellDelay99p = tauTo99Percent / tauTo90Percent
                    * cellDelay;
 
-    localBitlineDelay99p = timeToPercentage(99) / timeToPercentage(90)
+    localBitlineDelay99p = tauTo99Percent / tauTo90Percent
                            * localBitlineDelay;
 
     ACTtoRefreshCellDelay = globalWordlineDelay + localWordlineDelay
@@ -200,22 +208,23 @@ Timing::trcdCalc()
 
 }
 
+template<typename Scalar>
 void
-Timing::trasCalc()
+BasicTiming<Scalar>::trasCalc()
 {
 
     CSLResistance = SCALE_QUANTITY(bankHeight, drs::millimeter_unit)
                       * wireResistance;
 
     CSLCapacitance = SCALE_QUANTITY(bankHeight, drs::millimeter_unit)
-                      * SCALE_QUANTITY(wireCapacitance, drs::nanofarad_per_millimeter_unit)
-                     + SCALE_QUANTITY(CSLLoadCapacitance, drs::nanofarad_unit);
+                      * technologyConstants.wireCapacitancePerMillimeter
+                     + technologyConstants.CSLLoadCapacitance;
 
     // delay through CSL
     tcsl = driverEnableDelay
-           + timeToPercentage(90) * CSLDriverResistance
+           + tauTo90Percent * CSLDriverResistance
             * CSLCapacitance
-           + timeToPercentage(63) * CSLResistance
+           + tauTo63Percent * CSLResistance
             * CSLCapacitance;
 
 
@@ -223,13 +232,13 @@ Timing::trasCalc()
                       * wireResistance;
 
     globalDatalineCapacitance = SCALE_QUANTITY(bankHeight, drs::millimeter_unit)
-                      * SCALE_QUANTITY(wireCapacitance, drs::nanofarad_per_millimeter_unit);
+                      * technologyConstants.wireCapacitancePerMillimeter;
 
     // delay through global dataline
     tgdl = driverEnableDelay
-           + timeToPercentage(90) * GDLDriverResistance
+           + tauTo90Percent * GDLDriverResistance
              * globalDatalineCapacitance
-           + timeToPercentage(63) * globalDatalineResistance
+           + tauTo63Percent * globalDatalineResistance
              * globalDatalineCapacitance;
 
 
@@ -252,13 +261,13 @@ Timing::trasCalc()
                         * wireResistance;
 
     DQWireCapacitance = DQWireLength
-                      * SCALE_QUANTITY(wireCapacitance, drs::nanofarad_per_micrometer_unit);
+                      * technologyConstants.wireCapacitancePerMicrometer;
 
     // delay through global dataline
     tdq = driverEnableDelay
-           + timeToPercentage(90) * DQDriverResistance
+           + tauTo90Percent * DQDriverResistance
              * DQWireCapacitance
-           + timeToPercentage(63) * DQWireResistance
+           + tauTo63Percent * DQWireResistance
              * DQWireCapacitance;
     
     // Calculating tccd:
@@ -285,8 +294,9 @@ Timing::trasCalc()
 
 }
 
+template<typename Scalar>
 void
-Timing::trpCalc()
+BasicTiming<Scalar>::trpCalc()
 {
     //calculating trp
     //trp = Master wordline delay ( discharging ) + local wordline delay
@@ -294,15 +304,17 @@ Timing::trpCalc()
     trp =  localWordlineDelay + localBitlineDelay + equalizerDelay;
 }
 
+template<typename Scalar>
 void
-Timing::trcCalc()
+BasicTiming<Scalar>::trcCalc()
 {
     //calculating trc
     trc = tras + trp;
 }
 
+template<typename Scalar>
 void
-Timing::tckCalc()
+BasicTiming<Scalar>::tckCalc()
 {
     maxCoreFreq = drs::clock / SCALE_QUANTITY(tccd, drs::microsecond_unit);
 
@@ -323,8 +335,23 @@ Timing::tckCalc()
      tckCore = 1*drs::clock * coreClkPeriod;
 }
 
+template<typename Scalar>
+ModelError
+BasicTiming<Scalar>::timingInputError() const
+{
+    // Same operating temperature ranges as trefICalc and trfcCalc
+    if ( (temperature > 0*bu::celsius::degrees
+          && temperature < 85*bu::celsius::degrees)
+         || (temperature > 85*bu::celsius::degrees
+             && temperature < 95*bu::celsius::degrees) ) {
+        return NO_MODEL_ERROR;
+    }
+    return TEMPERATURE_RANGE_ERROR;
+}
+
+template<typename Scalar>
 void
-Timing::trefICalc()
+BasicTiming<Scalar>::trefICalc()
 {
 
     // Normal op temp
@@ -342,16 +369,14 @@ Timing::trefICalc()
     // Outside temp range
     else
     {
-      std::string exceptionMsgThrown("[ERROR] ");
-      exceptionMsgThrown.append("Operating temperature is defined ");
-      exceptionMsgThrown.append("only from 0 to 95 degrees Celsius.");
-      throw exceptionMsgThrown;
+      throw std::string(modelErrorMessage(TEMPERATURE_RANGE_ERROR));
     }
 
 }
 
+template<typename Scalar>
 void
-Timing::trfcCalc()
+BasicTiming<Scalar>::trfcCalc()
 {
     // Normal op temp
     if (temperature > 0*bu::celsius::degrees
@@ -372,10 +397,7 @@ Timing::trfcCalc()
     // Outside temp range
     else
     {
-      std::string exceptionMsgThrown("[ERROR] ");
-      exceptionMsgThrown.append("Operating temperature is defined ");
-      exceptionMsgThrown.append("only from 0 to 95 degrees Celsius.");
-      throw exceptionMsgThrown;
+      throw std::string(modelErrorMessage(TEMPERATURE_RANGE_ERROR));
     }
 
     // Assuming ACT-PRE-ACT-PRE... cycles until the needs number of rows are refreshed
@@ -386,8 +408,57 @@ Timing::trfcCalc()
 
 }
 
+// Whether x is greater than y, for intervals for some of their numbers
+static bool
+mayBeGreater(double x, double y)
+{
+    return x > y;
+}
+
+static bool
+mayBeGreater(const Dual& x, const Dual& y)
+{
+    return x > y;
+}
+
+static bool
+mayBeGreater(const Interval& x, const Interval& y)
+{
+    return x.upper > y.lower;
+}
+
+// Rounding of a time in clock periods up to whole clock cycles. On dual
+//  numbers the cycles keep the derivative of time / clock period, so the
+//  results computed from them (e.g. IDD0 through the cycles of tRC)
+//  follow the timings instead of having no derivative by them.
+static double
+cycleCeil(double cycles)
+{
+    return ceil(cycles);
+}
+
+static Dual
+cycleCeil(const Dual& cycles)
+{
+    return relaxedCeil(cycles);
+}
+
+static Interval
+cycleCeil(const Interval& cycles)
+{
+    return ceil(cycles);
+}
+
+template<class Unit, typename Scalar>
+static bu::quantity<Unit, Scalar>
+clockCycles(const bu::quantity<Unit, Scalar>& cycles)
+{
+    return bu::quantity<Unit, Scalar>::from_value(cycleCeil(cycles.value()));
+}
+
+template<typename Scalar>
 void
-Timing::clkTiming()
+BasicTiming<Scalar>::clkTiming()
 {
 
     // Calculating trl (delay in ns):
@@ -395,52 +466,52 @@ Timing::clkTiming()
     trl = tcas + additionalLatencyTrl * clkPeriod;
 
     //trcd in clk cycles
-    trcd_clk = ceil(trcd/clkPeriod);
+    trcd_clk = clockCycles(trcd/clkPeriod);
 
     //tcl in clk cycles
-    tcas_clk = ceil(tcas/clkPeriod);
+    tcas_clk = clockCycles(tcas/clkPeriod);
 
     //tcl_act in clk cycles
-    tcas_coreClk = ceil(tcas/coreClkPeriod);
+    tcas_coreClk = clockCycles(tcas/coreClkPeriod);
 
     //tras in clk cycles
-    tras_clk = ceil(tras/clkPeriod);
+    tras_clk = clockCycles(tras/clkPeriod);
 
     //trp in clk cycles
-    trp_clk = ceil(trp/clkPeriod);
+    trp_clk = clockCycles(trp/clkPeriod);
 
     //trc in clk cycles
-    trc_clk = ceil(trc/clkPeriod);
+    trc_clk = clockCycles(trc/clkPeriod);
     
     //trl in clk cycles
-    trl_clk = ceil(trl/clkPeriod);
+    trl_clk = clockCycles(trl/clkPeriod);
 
     //trl_act in clk cycles
-    trl_coreClk = ceil(trl/coreClkPeriod);
+    trl_coreClk = clockCycles(trl/coreClkPeriod);
 
     //twl in clk cycles
     twl_clk = trl_clk - 1*drs::clock;
 
     //trtp in clk cycles
-    trtp_clk = ceil(trtp/clkPeriod);
+    trtp_clk = clockCycles(trtp/clkPeriod);
 
     //tccd in clk cycles
-    tccd_clk = ceil(tccd/clkPeriod);
+    tccd_clk = clockCycles(tccd/clkPeriod);
 
     //tccd_act in clk cycles
-    tccd_coreClk = ceil(tccd/coreClkPeriod);
+    tccd_coreClk = clockCycles(tccd/coreClkPeriod);
 
     //twr in clk cycles
-    twr_clk = ceil(twr/clkPeriod);
+    twr_clk = clockCycles(twr/clkPeriod);
 
     //trfc in clk cycles
-    trfc_clk = ceil(trfc/clkPeriod);
+    trfc_clk = clockCycles(trfc/clkPeriod);
     
     //trefI in clk cycles
-    trefI_clk = ceil(trefI/clkPeriod);
+    trefI_clk = clockCycles(trefI/clkPeriod);
 
     // If frequency is too high,  warn the user but do all calculations anyway
-    if( dramCoreFreq > maxCoreFreq ) {
+    if( mayBeGreater(dramCoreFreq.value(), maxCoreFreq.value()) ) {
         warning.append("[WARNING] ");
         warning.append("Specified frequency ");
         warning.append("too high for DRAM Design. ");
@@ -452,8 +523,9 @@ Timing::clkTiming()
 
 }
 
+template<typename Scalar>
 void
-Timing::timingCompute()
+BasicTiming<Scalar>::timingCompute()
 {
     try {
         trcdCalc();
@@ -471,8 +543,9 @@ Timing::timingCompute()
 
 }
 
+template<typename Scalar>
 void
-Timing::printTimings()
+BasicTiming<Scalar>::printTimings()
 {
 
     std::cout << "\nTime variables:\n";
@@ -494,3 +567,7 @@ Timing::printTimings()
     PRINT_VAR(trefI);
 
 }
+
+template class BasicTiming<double>;
+template class BasicTiming<Dual>;
+template class BasicTiming<Interval>;
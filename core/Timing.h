@@ -51,18 +51,85 @@ namespace si=boost::units::si;
 namespace inf=boost::units::information;
 namespace drs=boost::units::dramspec;
 
-class Timing : public Channel
+template<typename Scalar>
+class BasicTiming : public BasicChannel<Scalar>
 {
   public:
-    Timing() : //Empty constructor for test proposes
-        Channel()
+    typedef typename BasicChannel<Scalar>::Inputs Inputs;
+
+    using BasicChannel<Scalar>::CSLDriverResistance;
+    using BasicChannel<Scalar>::DQDriverResistance;
+    using BasicChannel<Scalar>::DQtoTSVWireLength;
+    using BasicChannel<Scalar>::GDLDriverResistance;
+    using BasicChannel<Scalar>::GWLDriverResistance;
+    using BasicChannel<Scalar>::IODelay;
+    using BasicChannel<Scalar>::LWLDriverResistance;
+    using BasicChannel<Scalar>::SSAPrechargeDelay;
+    using BasicChannel<Scalar>::TSVHeight;
+    using BasicChannel<Scalar>::additionalLatencyTrl;
+    using BasicChannel<Scalar>::bankHeight;
+    using BasicChannel<Scalar>::bankWidth;
+    using BasicChannel<Scalar>::cellsPerLBL;
+    using BasicChannel<Scalar>::cellsPerLWL;
+    using BasicChannel<Scalar>::channelWidth;
+    using BasicChannel<Scalar>::cmdDecoderDelay;
+    using BasicChannel<Scalar>::colDecoderHeight;
+    using BasicChannel<Scalar>::dramCoreFreq;
+    using BasicChannel<Scalar>::dramFreq;
+    using BasicChannel<Scalar>::dramType;
+    using BasicChannel<Scalar>::driverEnableDelay;
+    using BasicChannel<Scalar>::equalizerDelay;
+    using BasicChannel<Scalar>::inOutSSADelay;
+    using BasicChannel<Scalar>::is3D;
+    using BasicChannel<Scalar>::nBankLogicalRows;
+    using BasicChannel<Scalar>::nBanks;
+    using BasicChannel<Scalar>::nHorizontalBanks;
+    using BasicChannel<Scalar>::nSubArraysPerArrayBlock;
+    using BasicChannel<Scalar>::prefetch;
+    using BasicChannel<Scalar>::refreshMode;
+    using BasicChannel<Scalar>::resistancePerBLCell;
+    using BasicChannel<Scalar>::resistancePerWLCell;
+    using BasicChannel<Scalar>::retentionTime;
+    using BasicChannel<Scalar>::tWRMargin;
+    using BasicChannel<Scalar>::technologyConstants;
+    using BasicChannel<Scalar>::temperature;
+    using BasicChannel<Scalar>::tileWidth;
+    using BasicChannel<Scalar>::trefIBase;
+    using BasicChannel<Scalar>::warning;
+    using BasicChannel<Scalar>::wireResistance;
+
+    BasicTiming() : //Empty constructor for test proposes
+        BasicChannel<Scalar>()
     {
         timingInitialize();
     }
 
-    Timing(const string& technologyFileName,
-           const string& architectureFileName) :
-        Channel(technologyFileName, architectureFileName)
+    BasicTiming(const string& technologyFileName,
+                const string& architectureFileName) :
+        BasicChannel<Scalar>(technologyFileName, architectureFileName)
+    {
+        timingInitialize();
+        try {
+            timingCompute();
+        }catch (string exceptionMsgThrown){
+            throw exceptionMsgThrown;
+        }
+    }
+
+    BasicTiming(const Inputs& technologyValues) :
+        BasicChannel<Scalar>(technologyValues)
+    {
+        timingInitialize();
+        try {
+            timingCompute();
+        }catch (string exceptionMsgThrown){
+            throw exceptionMsgThrown;
+        }
+    }
+
+    // Computes on an already computed channel
+    explicit BasicTiming(const BasicChannel<Scalar>& channel) :
+        BasicChannel<Scalar>(channel)
     {
         timingInitialize();
         try {
@@ -73,146 +140,146 @@ class Timing : public Channel
     }
   
     //Delay of cell
-    bu::quantity<drs::nanosecond_unit> cellDelay;
+    bu::quantity<drs::nanosecond_unit, Scalar> cellDelay;
 
     //Resistance of local wordline
-    bu::quantity<drs::ohm_unit> localWordlineResistance;
+    bu::quantity<drs::ohm_unit, Scalar> localWordlineResistance;
     //Capacitace of local wordline
-    bu::quantity<drs::nanofarad_unit> localWordlineCapacitance;
+    bu::quantity<drs::nanofarad_unit, Scalar> localWordlineCapacitance;
     //Delay of local wordline
-    bu::quantity<drs::nanosecond_unit> localWordlineDelay;
+    bu::quantity<drs::nanosecond_unit, Scalar> localWordlineDelay;
 
     //Resistance of local bitline
-    bu::quantity<drs::ohm_unit> localBitlineResistance;
+    bu::quantity<drs::ohm_unit, Scalar> localBitlineResistance;
     //Capacitace of local bitline
-    bu::quantity<drs::nanofarad_unit> localBitlineCapacitance;
+    bu::quantity<drs::nanofarad_unit, Scalar> localBitlineCapacitance;
     //Delay of local bitline
-    bu::quantity<drs::nanosecond_unit> localBitlineDelay;
+    bu::quantity<drs::nanosecond_unit, Scalar> localBitlineDelay;
 
     //Resistance of global wordline
-    bu::quantity<drs::ohm_unit> globalWordlineResistance;
+    bu::quantity<drs::ohm_unit, Scalar> globalWordlineResistance;
     //Capacitace of global wordline
-    bu::quantity<drs::nanofarad_unit> globalWordlineCapacitance;
+    bu::quantity<drs::nanofarad_unit, Scalar> globalWordlineCapacitance;
     //Delay through global wordline driver and wiring
-    bu::quantity<drs::nanosecond_unit> globalWordlineDelay;
+    bu::quantity<drs::nanosecond_unit, Scalar> globalWordlineDelay;
 
     //t_rcd: ACT to internal read or write delay time
-    bu::quantity<drs::nanosecond_unit> trcd;
+    bu::quantity<drs::nanosecond_unit, Scalar> trcd;
 
     //Delay of the cell for 99% (recharge)
-    bu::quantity<drs::nanosecond_unit> cellDelay99p;
+    bu::quantity<drs::nanosecond_unit, Scalar> cellDelay99p;
 
     //Delay of the bitline for 99% (recharge)
-    bu::quantity<drs::nanosecond_unit> localBitlineDelay99p;
+    bu::quantity<drs::nanosecond_unit, Scalar> localBitlineDelay99p;
 
     //Delay for internal ACT cmd to effective refresh of the cell
-    bu::quantity<drs::nanosecond_unit> ACTtoRefreshCellDelay;
+    bu::quantity<drs::nanosecond_unit, Scalar> ACTtoRefreshCellDelay;
 
     //Resistance of CSL wire
-    bu::quantity<drs::ohm_unit> CSLResistance;
+    bu::quantity<drs::ohm_unit, Scalar> CSLResistance;
     //Capacitace of CSL wire
-    bu::quantity<drs::nanofarad_unit> CSLCapacitance;
+    bu::quantity<drs::nanofarad_unit, Scalar> CSLCapacitance;
     //Delay through CSL driver and wiring
-    bu::quantity<drs::nanosecond_unit> tcsl;
+    bu::quantity<drs::nanosecond_unit, Scalar> tcsl;
 
     //Resistance of global dataline wire
-    bu::quantity<drs::ohm_unit> globalDatalineResistance;
+    bu::quantity<drs::ohm_unit, Scalar> globalDatalineResistance;
     //Capacitace of global dataline wire
-    bu::quantity<drs::nanofarad_unit> globalDatalineCapacitance;
+    bu::quantity<drs::nanofarad_unit, Scalar> globalDatalineCapacitance;
     //Delay through global dataline driver and wiring
-    bu::quantity<drs::nanosecond_unit> tgdl;
+    bu::quantity<drs::nanosecond_unit, Scalar> tgdl;
 
     //DQ wire length
-    bu::quantity<drs::micrometer_unit> DQWireLength;
+    bu::quantity<drs::micrometer_unit, Scalar> DQWireLength;
     //Resistance of DQ wire
-    bu::quantity<si::resistance> DQWireResistance;
+    bu::quantity<si::resistance, Scalar> DQWireResistance;
     //Capacitace of DQ wire
-    bu::quantity<drs::nanofarad_unit> DQWireCapacitance;
+    bu::quantity<drs::nanofarad_unit, Scalar> DQWireCapacitance;
     //Delay through DQ driver and wiring
-    bu::quantity<drs::nanosecond_unit> tdq;
+    bu::quantity<drs::nanosecond_unit, Scalar> tdq;
 
 
     //tcl = tcas - Column Access Strobe delay
-    bu::quantity<drs::nanosecond_unit> tcas;
+    bu::quantity<drs::nanosecond_unit, Scalar> tcas;
 
     //trl = tcas + tal - Read (Latency) delay
-    bu::quantity<drs::nanosecond_unit> trl;
+    bu::quantity<drs::nanosecond_unit, Scalar> trl;
 
     //trtp - Read to Precharge delay
-    bu::quantity<drs::nanosecond_unit> trtp;
+    bu::quantity<drs::nanosecond_unit, Scalar> trtp;
 
     //tccd - Column-to-Column delay
-    bu::quantity<drs::nanosecond_unit> tccd;
+    bu::quantity<drs::nanosecond_unit, Scalar> tccd;
 
 
     //tras - Row Access Strobe delay
-    bu::quantity<drs::nanosecond_unit> tras;
+    bu::quantity<drs::nanosecond_unit, Scalar> tras;
 
     //twr - Write Recovery delay
-    bu::quantity<drs::nanosecond_unit> twr;
+    bu::quantity<drs::nanosecond_unit, Scalar> twr;
 
     //trp - Row Precharge delay
-    bu::quantity<drs::nanosecond_unit> trp;
+    bu::quantity<drs::nanosecond_unit, Scalar> trp;
 
     //trc - Row Cycle delay
-    bu::quantity<drs::nanosecond_unit> trc;
+    bu::quantity<drs::nanosecond_unit, Scalar> trc;
 
     //tck - One clock cycle time
-    bu::quantity<drs::nanosecond_unit> tck;
+    bu::quantity<drs::nanosecond_unit, Scalar> tck;
 
     //tck - One core clock cycle time
-    bu::quantity<drs::nanosecond_unit> tckCore;
+    bu::quantity<drs::nanosecond_unit, Scalar> tckCore;
 
     //trefI - Refresh Interval delay
-    bu::quantity<drs::nanosecond_unit> trefI;
+    bu::quantity<drs::nanosecond_unit, Scalar> trefI;
 
     //Number of rows refreshed per auto-refresh command (total, not per bank)
-    double nRowsRefreshedPerARCmd;
+    Scalar nRowsRefreshedPerARCmd;
 
     //trfc - Refresh Cycle delay
-    bu::quantity<drs::nanosecond_unit> trfc;
+    bu::quantity<drs::nanosecond_unit, Scalar> trfc;
 
     //Maximum core frequency
-    bu::quantity<drs::megahertz_clock_unit> maxCoreFreq;
+    bu::quantity<drs::megahertz_clock_unit, Scalar> maxCoreFreq;
 
     //Ratio between bus and core frequencies
     double clockFactor;
 
     //Clock period
-    bu::quantity<drs::nanosecond_per_clock_unit> clkPeriod;
+    bu::quantity<drs::nanosecond_per_clock_unit, Scalar> clkPeriod;
     //Core clock period
-    bu::quantity<drs::nanosecond_per_clock_unit> coreClkPeriod;
+    bu::quantity<drs::nanosecond_per_clock_unit, Scalar> coreClkPeriod;
 
     //trcd in number of clocks
-    bu::quantity<drs::clock_unit> trcd_clk;
+    bu::quantity<drs::clock_unit, Scalar> trcd_clk;
     //tcas in number of clocks
-    bu::quantity<drs::clock_unit> tcas_clk;
+    bu::quantity<drs::clock_unit, Scalar> tcas_clk;
     //tcas in number of core clocks
-    bu::quantity<drs::clock_unit> tcas_coreClk;
+    bu::quantity<drs::clock_unit, Scalar> tcas_coreClk;
     //tras in number of clocks
-    bu::quantity<drs::clock_unit> tras_clk;
+    bu::quantity<drs::clock_unit, Scalar> tras_clk;
     //trp in number of clocks
-    bu::quantity<drs::clock_unit> trp_clk;
+    bu::quantity<drs::clock_unit, Scalar> trp_clk;
     //trc in number of clocks
-    bu::quantity<drs::clock_unit> trc_clk;
+    bu::quantity<drs::clock_unit, Scalar> trc_clk;
     //trl in number of clocks
-    bu::quantity<drs::clock_unit> trl_clk;
+    bu::quantity<drs::clock_unit, Scalar> trl_clk;
     //trl in number of core clocks
-    bu::quantity<drs::clock_unit> trl_coreClk;
+    bu::quantity<drs::clock_unit, Scalar> trl_coreClk;
     //twl in number of clocks
-    bu::quantity<drs::clock_unit> twl_clk;
+    bu::quantity<drs::clock_unit, Scalar> twl_clk;
     //trtp in number of clocks
-    bu::quantity<drs::clock_unit> trtp_clk;
+    bu::quantity<drs::clock_unit, Scalar> trtp_clk;
     //tccd in number of clocks
-    bu::quantity<drs::clock_unit> tccd_clk;
+    bu::quantity<drs::clock_unit, Scalar> tccd_clk;
     //tccd in number of core clocks
-    bu::quantity<drs::clock_unit> tccd_coreClk;
+    bu::quantity<drs::clock_unit, Scalar> tccd_coreClk;
     //twr in number of clocks
-    bu::quantity<drs::clock_unit> twr_clk;
+    bu::quantity<drs::clock_unit, Scalar> twr_clk;
     //trfc in number of clocks
-    bu::quantity<drs::clock_unit> trfc_clk;
+    bu::quantity<drs::clock_unit, Scalar> trfc_clk;
     //trefI in number of clocks
-    bu::quantity<drs::clock_unit> trefI_clk;
+    bu::quantity<drs::clock_unit, Scalar> trefI_clk;
 
     void timingInitialize();
 
@@ -226,6 +293,9 @@ class Timing : public Channel
 
     void tckCalc();
 
+    // Operating temperature out of range (NO_MODEL_ERROR if in range)
+    ModelError timingInputError() const;
+
     void trfcCalc();
 
     void trefICalc();
@@ -237,4 +307,6 @@ class Timing : public Channel
     void printTimings();
 };
 
+typedef BasicTiming<double> Timing;
+
 #endif
@@ -43,6 +43,9 @@
 
 #include <boost/units/static_constant.hpp>
 #include <boost/units/unit.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/type_traits/conditional.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
 #include "expanded_make_system.hpp"
 
 #include <boost/units/base_units/si/meter.hpp>
@@ -63,8 +66,21 @@
 // Conversion between SCALED UNITS
 // 'from' is a quantity,
 // while 'to' is a unit dimension
+// The value type of 'from' is kept (e.g. Dual), numbers become double.
 #define SCALE_QUANTITY(from, to) \
-    (static_cast<bu::quantity< to >> (from))
+    (scaleQuantity< to >(from))
+
+template<class ToUnit, class FromUnit, class Y>
+inline boost::units::quantity<ToUnit,
+                              typename boost::conditional<
+                                  boost::is_arithmetic<Y>::value,
+                                  double, Y>::type>
+scaleQuantity(const boost::units::quantity<FromUnit, Y>& from)
+{
+    typedef typename boost::conditional<boost::is_arithmetic<Y>::value,
+                                        double, Y>::type Value;
+    return static_cast<boost::units::quantity<ToUnit, Value> >(from);
+}
 
 // Macro to round up quantities at a given decimal place
 #define ROUND_UP(number, nDecimalPlaces) \
@@ -0,0 +1,87 @@
+# Copyright (c) 2017, University of Kaiserslautern
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+# TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+# PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+# OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+# PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+# LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+# NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+# SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Authors: Matthias Jung, Andr'e Lucas Chinazzo
+
+# libdramspec: the DRAM model with its in-memory interfaces, C++
+# (library/DramSpecLibrary.h) and C (library/dramspec.h), for use by
+# other programs in-process.
+# Leaves out the argument parsing, output files and caches of the
+# command line tool.
+
+TEMPLATE = lib
+CONFIG += c++11 staticlib
+
+TARGET = dramspec
+DESTDIR = build/lib
+OBJECTS_DIR = build/lib/.obj
+
+mac {
+    INCLUDEPATH += /opt/boost/include
+}
+
+# See DRAMSpec.pro
+INCLUDEPATH += /users/chinazzo/libs/boost_1_63_0
+
+QMAKE_CXXFLAGS += -Wextra -Wall
+
+HEADERS += library/DramSpecLibrary.h
+HEADERS += library/dramspec.h
+
+HEADERS += core/SubArray.h
+HEADERS += core/Tile.h
+HEADERS += core/Bank.h
+HEADERS += core/Channel.h
+HEADERS += core/Timing.h
+HEADERS += core/Current.h
+HEADERS += core/ModelError.h
+HEADERS += core/Dual.h
+HEADERS += core/Interval.h
+
+HEADERS += utils/utils.h
+HEADERS += parser/TechnologyValues.h
+HEADERS += parser/DramResult.h
+HEADERS += parser/TechnologyLibrary.h
+
+SOURCES += library/DramSpecLibrary.cpp
+SOURCES += library/DramSpecCInterface.cpp
+
+SOURCES += core/SubArray.cpp
+SOURCES += core/Tile.cpp
+SOURCES += core/Bank.cpp
+SOURCES += core/Channel.cpp
+SOURCES += core/Timing.cpp
+SOURCES += core/Current.cpp
+SOURCES += core/ModelError.cpp
+
+SOURCES += utils/utils.cpp
+SOURCES += parser/TechnologyValues.cpp
+SOURCES += parser/TechnologyLibrary.cpp
+SOURCES += parser/DramResult.cpp
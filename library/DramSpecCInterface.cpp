@@ -0,0 +1,414 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "dramspec.h"
+#include "DramSpecLibrary.h"
+
+#include <cmath>
+#include <limits>
+#include <new>
+#include <vector>
+
+static_assert(DRAMSPEC_N_CLOCK_COUNTS
+              == DramResult::TREFI_CLK - DramResult::TRCD_CLK + 1,
+              "Clock counts of the C interface differ from DramResult");
+static_assert(DRAMSPEC_N_DOUBLES + DRAMSPEC_N_CLOCK_COUNTS
+              == DramResult::N_VALUES,
+              "Results of the C interface differ from DramResult");
+
+struct dramspec_context
+{
+    ExtendedDocument techDocument;
+    ExtendedDocument archDocument;
+    string techName;
+    string archName;
+    bool isTechnologyLoaded;
+    bool isArchitectureLoaded;
+    bool IOTerminationCurrentFlag;
+
+    // Inputs of both descriptions, the base of every point
+    TechnologyValues inputs;
+
+    // Kept between calls, so evaluating does not allocate for them.
+    // Every point is evaluated in place in the same model.
+    Current model;
+    vector<const TechnologyField*> pointFields;
+    DramResult result;
+
+    string lastError;
+};
+
+// Capacity reserved for the messages, enough for those of the model
+static const size_t errorCapacity = 256;
+
+static bool
+isClockCount(int valueID)
+{
+    return valueID >= DramResult::TRCD_CLK && valueID <= DramResult::TREFI_CLK;
+}
+
+static dramspec_status
+setError(dramspec_context* context, dramspec_status status,
+         const string& message)
+{
+    context->lastError = message;
+    // Messages of the model end with a line break, not needed here
+    while ( !context->lastError.empty()
+            && context->lastError[context->lastError.size()-1] == '\n' ) {
+        context->lastError.erase(context->lastError.size()-1);
+    }
+    return status;
+}
+
+// Reads the inputs of the context again from its loaded descriptions
+static void
+rebuildInputs(dramspec_context* context)
+{
+    context->inputs = TechnologyValues();
+    context->inputs.techFileName = context->techName;
+    context->inputs.archFileName = context->archName;
+    if ( context->isTechnologyLoaded ) {
+        context->inputs.readTechnology(context->techDocument);
+    }
+    if ( context->isArchitectureLoaded ) {
+        context->inputs.readArchitecture(context->archDocument);
+    }
+    // Derived once here instead of for every point, unless a point
+    //  replaces a technology parameter
+    if ( context->isTechnologyLoaded && context->isArchitectureLoaded ) {
+        context->inputs.deriveTechnologyConstants();
+    }
+}
+
+// Common part of loading and parsing a description
+static dramspec_status
+loadDescription(dramspec_context* context, bool isTechnology,
+                const char* text, bool isFileName)
+{
+    if ( context == NULL ) {
+        return DRAMSPEC_ERROR_INVALID_ARGUMENT;
+    }
+    if ( text == NULL ) {
+        return setError(context, DRAMSPEC_ERROR_INVALID_ARGUMENT,
+                        "[ERROR] No description given.");
+    }
+
+    ExtendedDocument& document = isTechnology ? context->techDocument
+                                              : context->archDocument;
+    string& name = isTechnology ? context->techName : context->archName;
+    bool& isLoaded = isTechnology ? context->isTechnologyLoaded
+                                  : context->isArchitectureLoaded;
+
+    try {
+        context->lastError.clear();
+        isLoaded = false;
+        if ( isFileName ) {
+            name = text;
+            TechnologyValues::readJSONFile(name,
+                    isTechnology ? "technology" : "architecture", document);
+        }
+        else {
+            name = isTechnology ? DramSpecLibrary::technologyName
+                                : DramSpecLibrary::architectureName;
+            document.base.reset();
+            DramSpecLibrary::parseDescription(text, name.c_str(),
+                                              document.document);
+        }
+        isLoaded = true;
+        rebuildInputs(context);
+    } catch(string exceptionMsgThrown) {
+        isLoaded = false;
+        return setError(context, DRAMSPEC_ERROR_INPUT, exceptionMsgThrown);
+    } catch(bad_alloc&) {
+        isLoaded = false;
+        return setError(context, DRAMSPEC_ERROR_OUT_OF_MEMORY,
+                        "[ERROR] Out of memory.");
+    } catch(...) {
+        isLoaded = false;
+        return setError(context, DRAMSPEC_ERROR_INTERNAL,
+                        "[ERROR] Unexpected internal error.");
+    }
+    return DRAMSPEC_OK;
+}
+
+// Evaluates one point into its slots of the result arrays.
+// The model of the context is evaluated in place, and a configuration
+//  rejected by the model is found by its error code before evaluating,
+//  so that nothing is allocated (and nothing is thrown) per point.
+static dramspec_status
+evaluatePoint(dramspec_context* context, size_t nParameters,
+              const double* parameterValues,
+              double* doubles, uint32_t* clockCounts)
+{
+    // Values are checked as -D overrides are
+    for ( size_t it = 0; it < nParameters; it++ ) {
+        const TechnologyField& field = *context->pointFields[it];
+        if ( !TechnologyValues::isAllowedNumber(field, parameterValues[it]) ) {
+            if ( !context->lastError.empty() ) {
+                return DRAMSPEC_ERROR_INVALID_ARGUMENT;
+            }
+            try {
+                TechnologyValues::checkNumber(field, parameterValues[it]);
+            } catch(string exceptionMsgThrown) {
+                return setError(context, DRAMSPEC_ERROR_INVALID_ARGUMENT,
+                                exceptionMsgThrown);
+            }
+        }
+    }
+
+    TechnologyValues& pointInputs = context->model;
+    pointInputs = context->inputs;
+    for ( size_t it = 0; it < nParameters; it++ ) {
+        context->pointFields[it]->setNumber(pointInputs, parameterValues[it]);
+    }
+
+    ModelError error
+            = context->model.inputError(context->IOTerminationCurrentFlag);
+    if ( error != NO_MODEL_ERROR ) {
+        // The message of the first failed point is kept
+        if ( context->lastError.empty() ) {
+            context->lastError.assign(modelErrorMessage(error));
+        }
+        return DRAMSPEC_ERROR_MODEL;
+    }
+
+    try {
+        context->model.evaluate(context->IOTerminationCurrentFlag);
+        context->result.collect(context->model);
+    } catch(string exceptionMsgThrown) {
+        // Errors not found by inputError() are reported the slow way
+        if ( !context->lastError.empty() ) {
+            return DRAMSPEC_ERROR_MODEL;
+        }
+        return setError(context, DRAMSPEC_ERROR_MODEL, exceptionMsgThrown);
+    }
+
+    size_t doubleIndex = 0;
+    size_t clockIndex = 0;
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        double value = context->result.values[valueID];
+        if ( isClockCount(valueID) ) {
+            // E.g. the cycles of tREFI at a very high frequency
+            if ( !isfinite(value) || value < 0 || value > UINT32_MAX ) {
+                if ( context->lastError.empty() ) {
+                    context->lastError.assign("[ERROR] Clock count ");
+                    context->lastError.append(DramResult::names[valueID]);
+                    context->lastError.append(" does not fit 32 bits.");
+                }
+                return DRAMSPEC_ERROR_MODEL;
+            }
+            clockCounts[clockIndex++] = uint32_t(llround(value));
+        }
+        else {
+            doubles[doubleIndex++] = value;
+        }
+    }
+    return DRAMSPEC_OK;
+}
+
+extern "C" {
+
+uint32_t
+dramspec_abi_version(void)
+{
+    return DRAMSPEC_ABI_VERSION;
+}
+
+dramspec_context*
+dramspec_create(void)
+{
+    try {
+        dramspec_context* context = new dramspec_context;
+        context->isTechnologyLoaded = false;
+        context->isArchitectureLoaded = false;
+        context->IOTerminationCurrentFlag = false;
+        context->lastError.reserve(errorCapacity);
+        return context;
+    } catch(...) {
+        return NULL;
+    }
+}
+
+void
+dramspec_destroy(dramspec_context* context)
+{
+    delete context;
+}
+
+const char*
+dramspec_last_error(const dramspec_context* context)
+{
+    return context == NULL ? "" : context->lastError.c_str();
+}
+
+dramspec_status
+dramspec_load_technology_file(dramspec_context* context, const char* fileName)
+{
+    return loadDescription(context, true, fileName, true);
+}
+
+dramspec_status
+dramspec_load_architecture_file(dramspec_context* context,
+                                const char* fileName)
+{
+    return loadDescription(context, false, fileName, true);
+}
+
+dramspec_status
+dramspec_parse_technology(dramspec_context* context, const char* description)
+{
+    return loadDescription(context, true, description, false);
+}
+
+dramspec_status
+dramspec_parse_architecture(dramspec_context* context, const char* description)
+{
+    return loadDescription(context, false, description, false);
+}
+
+void
+dramspec_set_io_termination(dramspec_context* context, int isEnabled)
+{
+    if ( context != NULL ) {
+        context->IOTerminationCurrentFlag = isEnabled != 0;
+    }
+}
+
+const char*
+dramspec_double_name(size_t index)
+{
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        if ( !isClockCount(valueID) && index-- == 0 ) {
+            return DramResult::names[valueID];
+        }
+    }
+    return NULL;
+}
+
+const char*
+dramspec_clock_count_name(size_t index)
+{
+    if ( index >= DRAMSPEC_N_CLOCK_COUNTS ) {
+        return NULL;
+    }
+    return DramResult::names[DramResult::TRCD_CLK + index];
+}
+
+dramspec_status
+dramspec_evaluate_batch(dramspec_context* context,
+                        size_t nPoints,
+                        size_t nParameters,
+                        const char* const* parameterNames,
+                        const double* parameterValues,
+                        double* doubles,
+                        uint32_t* clockCounts,
+                        dramspec_status* pointStatus)
+{
+    if ( context == NULL ) {
+        return DRAMSPEC_ERROR_INVALID_ARGUMENT;
+    }
+    context->lastError.clear();
+
+    if ( (nPoints > 0 && (doubles == NULL || clockCounts == NULL))
+         || (nPoints > 0 && nParameters > 0
+             && (parameterNames == NULL || parameterValues == NULL)) ) {
+        return setError(context, DRAMSPEC_ERROR_INVALID_ARGUMENT,
+                        "[ERROR] Missing parameter or result array.");
+    }
+    if ( !context->isTechnologyLoaded || !context->isArchitectureLoaded ) {
+        return setError(context, DRAMSPEC_ERROR_NOT_LOADED,
+                        "[ERROR] Technology and architecture descriptions "
+                        "have to be loaded before evaluating.");
+    }
+
+    try {
+        // Parameters are looked up once per batch
+        context->pointFields.clear();
+        for ( size_t it = 0; it < nParameters; it++ ) {
+            const TechnologyField* field
+                    = parameterNames[it] == NULL ? NULL
+                      : TechnologyValues::findField(parameterNames[it]);
+            if ( field == NULL || field->isString ) {
+                string exceptionMsgThrown("[ERROR] ");
+                exceptionMsgThrown.append("No numeric input parameter \"");
+                exceptionMsgThrown.append(parameterNames[it] == NULL ?
+                                              "" : parameterNames[it]);
+                exceptionMsgThrown.append("\".");
+                return setError(context, DRAMSPEC_ERROR_INVALID_ARGUMENT,
+                                exceptionMsgThrown);
+            }
+            context->pointFields.push_back(field);
+        }
+
+        dramspec_status batchStatus = DRAMSPEC_OK;
+        for ( size_t point = 0; point < nPoints; point++ ) {
+            double* pointDoubles = doubles + point*DRAMSPEC_N_DOUBLES;
+            uint32_t* pointClockCounts
+                    = clockCounts + point*DRAMSPEC_N_CLOCK_COUNTS;
+
+            dramspec_status status = evaluatePoint(context, nParameters,
+                                        parameterValues + point*nParameters,
+                                        pointDoubles, pointClockCounts);
+            if ( status != DRAMSPEC_OK ) {
+                for ( size_t it = 0; it < DRAMSPEC_N_DOUBLES; it++ ) {
+                    pointDoubles[it] = numeric_limits<double>::quiet_NaN();
+                }
+                for ( size_t it = 0; it < DRAMSPEC_N_CLOCK_COUNTS; it++ ) {
+                    pointClockCounts[it] = 0;
+                }
+                if ( batchStatus == DRAMSPEC_OK ) {
+                    batchStatus = status;
+                }
+            }
+            if ( pointStatus != NULL ) {
+                pointStatus[point] = status;
+            }
+        }
+        return batchStatus;
+    } catch(bad_alloc&) {
+        return setError(context, DRAMSPEC_ERROR_OUT_OF_MEMORY,
+                        "[ERROR] Out of memory.");
+    } catch(...) {
+        return setError(context, DRAMSPEC_ERROR_INTERNAL,
+                        "[ERROR] Unexpected internal error.");
+    }
+}
+
+} // extern "C"
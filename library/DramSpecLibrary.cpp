@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "DramSpecLibrary.h"
+
+const char* const DramSpecLibrary::technologyName = "(technology description)";
+const char* const DramSpecLibrary::architectureName = "(architecture description)";
+
+void
+DramSpecLibrary::parseDescription(const string& description,
+                                  const char* descriptionName,
+                                  rapidjson::Document& jsonDoc)
+{
+    jsonDoc.Parse(description.c_str());
+    if ( jsonDoc.HasParseError() || !jsonDoc.IsObject() ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Could not parse ");
+        exceptionMsgThrown.append(descriptionName);
+        exceptionMsgThrown.append(" as a JSON document.\n");
+        throw exceptionMsgThrown;
+    }
+}
+
+TechnologyValues
+DramSpecLibrary::readInputs(const string& technologyDescription,
+                            const string& architectureDescription)
+{
+    TechnologyValues inputs;
+    inputs.techFileName = technologyName;
+    inputs.archFileName = architectureName;
+
+    try {
+        rapidjson::Document techDocument;
+        parseDescription(technologyDescription, technologyName, techDocument);
+        inputs.readTechnology(techDocument);
+
+        rapidjson::Document archDocument;
+        parseDescription(architectureDescription, architectureName,
+                         archDocument);
+        inputs.readArchitecture(archDocument);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    return inputs;
+}
+
+DramResult
+DramSpecLibrary::evaluate(const TechnologyValues& inputs,
+                          bool IOTerminationCurrentFlag)
+{
+    DramResult result;
+    result.technologyFileName = inputs.techFileName;
+    result.architectureFileName = inputs.archFileName;
+
+    try {
+        Current dram(inputs, IOTerminationCurrentFlag);
+        result.collect(dram);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    return result;
+}
+
+DramResult
+DramSpecLibrary::evaluate(const string& technologyDescription,
+                          const string& architectureDescription,
+                          bool IOTerminationCurrentFlag)
+{
+    try {
+        return evaluate(readInputs(technologyDescription,
+                                   architectureDescription),
+                        IOTerminationCurrentFlag);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef DRAMSPECLIBRARY_H
+#define DRAMSPECLIBRARY_H
+
+#include <string>
+
+#include "../parser/TechnologyValues.h"
+#include "../parser/DramResult.h"
+#include "../core/Current.h"
+
+using namespace std;
+
+// In-process interface of libdramspec.
+// Technology and architecture descriptions are given as text in the JSON
+//  format of the input files (see README), the results are returned as a
+//  DramResult. Nothing is read from or written to files, nothing is
+//  printed and no state is kept between calls, so evaluations may run
+//  concurrently from any number of threads.
+// Errors are thrown as strings, as in the rest of DRAMSpec.
+class DramSpecLibrary
+{
+public:
+    // Names given to the descriptions in error messages
+    static const char* const technologyName;
+    static const char* const architectureName;
+
+    static TechnologyValues readInputs(const string& technologyDescription,
+                                       const string& architectureDescription);
+
+    static DramResult evaluate(const TechnologyValues& inputs,
+                               bool IOTerminationCurrentFlag = false);
+    static DramResult evaluate(const string& technologyDescription,
+                               const string& architectureDescription,
+                               bool IOTerminationCurrentFlag = false);
+
+    static void parseDescription(const string& description,
+                                 const char* descriptionName,
+                                 rapidjson::Document& jsonDoc);
+};
+
+#endif // DRAMSPECLIBRARY_H
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef DRAMSPEC_C_H
+#define DRAMSPEC_C_H
+
+// C interface of libdramspec, for C programs and foreign function
+//  interfaces. No exception crosses it: every call reports its outcome
+//  by a status code, with a message available from dramspec_last_error().
+// A context holds one technology and one architecture description and
+//  evaluates batches of points, each point replacing some of its numeric
+//  input parameters. Results are written into arrays of the caller.
+// A context must not be used by several threads at the same time,
+//  separate contexts are independent.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Increased whenever this interface changes incompatibly
+#define DRAMSPEC_ABI_VERSION 1
+
+// Results per point: the clock counts (the [cc] results) as unsigned
+//  integers, all other results as doubles, both in output order
+#define DRAMSPEC_N_DOUBLES 35
+#define DRAMSPEC_N_CLOCK_COUNTS 14
+
+typedef enum {
+    DRAMSPEC_OK = 0,
+    DRAMSPEC_ERROR_INVALID_ARGUMENT = 1, // NULL pointer, unknown parameter,
+                                         //  value the parameter does not take
+    DRAMSPEC_ERROR_NOT_LOADED = 2,       // Description missing
+    DRAMSPEC_ERROR_INPUT = 3,            // Description unreadable or invalid
+    DRAMSPEC_ERROR_MODEL = 4,            // Configuration rejected by the model
+    DRAMSPEC_ERROR_OUT_OF_MEMORY = 5,
+    DRAMSPEC_ERROR_INTERNAL = 6
+} dramspec_status;
+
+typedef struct dramspec_context dramspec_context;
+
+uint32_t dramspec_abi_version(void);
+
+// NULL if out of memory
+dramspec_context* dramspec_create(void);
+void dramspec_destroy(dramspec_context* context);
+
+// Message of the last failed call on the context ("" if none), valid
+//  until the next call on it
+const char* dramspec_last_error(const dramspec_context* context);
+
+// Descriptions in the JSON format of the input files (see README)
+dramspec_status dramspec_load_technology_file(dramspec_context* context,
+                                              const char* fileName);
+dramspec_status dramspec_load_architecture_file(dramspec_context* context,
+                                                const char* fileName);
+dramspec_status dramspec_parse_technology(dramspec_context* context,
+                                          const char* description);
+dramspec_status dramspec_parse_architecture(dramspec_context* context,
+                                            const char* description);
+
+// Same as the -term option of the command line tool (default off)
+void dramspec_set_io_termination(dramspec_context* context, int isEnabled);
+
+// Names of the results (e.g. "tRCD[ns]", "tRCD[cc]"), NULL if out of range
+const char* dramspec_double_name(size_t index);
+const char* dramspec_clock_count_name(size_t index);
+
+// Evaluates nPoints points. Point p replaces the input parameters
+//  parameterNames[0..nParameters-1] (JSON member names, e.g. "Vpp[V]")
+//  by parameterValues[p*nParameters + i]; nParameters may be 0.
+// Its results are written to doubles[p*DRAMSPEC_N_DOUBLES + ...] and
+//  clockCounts[p*DRAMSPEC_N_CLOCK_COUNTS + ...], and its status to
+//  pointStatus[p] unless pointStatus is NULL. Results of a failed point
+//  are NaN and 0, also of a point whose clock counts do not fit 32 bits
+//  (DRAMSPEC_ERROR_MODEL).
+// Returns DRAMSPEC_OK if all points were evaluated, else the status of
+//  the first failed point (or of the arguments).
+dramspec_status dramspec_evaluate_batch(dramspec_context* context,
+                                        size_t nPoints,
+                                        size_t nParameters,
+                                        const char* const* parameterNames,
+                                        const double* parameterValues,
+                                        double* doubles,
+                                        uint32_t* clockCounts,
+                                        dramspec_status* pointStatus);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DRAMSPEC_C_H
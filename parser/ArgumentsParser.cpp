@@ -39,6 +39,7 @@
 
 
 #include "ArgumentsParser.h"
+#include "ConfigurationSource.h"
 
 using namespace std;
 
@@ -52,6 +53,16 @@ ArgumentsParser::ArgumentsParser(int argc, char** argv)
     nConfigurations = 0;
     IOTerminationCurrentFlag = false;
     printInternalTimings = false;
+    printRunStatistics = false;
+    resumeRun = false;
+    shardIndex = 0;
+    nShards = 1;
+    streamRun = false;
+    crossRun = false;
+    floorplanRun = false;
+    sensitivityRun = false;
+    nJobs = 0;
+    hasExpandableFileNames = false;
 }
 
 void ArgumentsParser::runArgParser()
@@ -73,7 +84,7 @@ void ArgumentsParser::runArgParser()
     // Normal run
     if( cpargv[argvID] == "-t") {
         argvID++;
-        if(!getTechFileName()) {
+        if(!getFileNames(true)) {
             string exceptionMsgThrown("[ERROR] ");
             exceptionMsgThrown.append("Unexpected argument \'");
             exceptionMsgThrown.append(cpargv[argvID]);
@@ -84,7 +95,7 @@ void ArgumentsParser::runArgParser()
     }
     else if( cpargv[argvID] == "-p") {
         argvID++;
-        if(!getArchFileName()) {
+        if(!getFileNames(false)) {
             string exceptionMsgThrown("[ERROR] ");
             exceptionMsgThrown.append("Unexpected argument \'");
             exceptionMsgThrown.append(cpargv[argvID]);
@@ -93,15 +104,19 @@ void ArgumentsParser::runArgParser()
             throw exceptionMsgThrown;
        }
     }
-    else if( cpargv[argvID] == "-term") {
-        IOTerminationCurrentFlag = true;
-        argvID++;
+    else if( getOption() ) {
         runArgParser();
     }
-    else if( cpargv[argvID] == "-internaltimings") {
-        printInternalTimings = true;
+    else if( cpargv[argvID] == "-merge") {
         argvID++;
-        runArgParser();
+        if(!getMergeFileName()) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Unexpected argument \'");
+            exceptionMsgThrown.append(cpargv[argvID]);
+            exceptionMsgThrown.append("\'\n");
+            exceptionMsgThrown.append(helpMessage);
+            throw exceptionMsgThrown;
+        }
     }
     else {
         string exceptionMsgThrown("[ERROR] ");
@@ -112,6 +127,180 @@ void ArgumentsParser::runArgParser()
         throw exceptionMsgThrown;
     }
 
+    // Only the -t and -p lists can be crossed
+    if ( crossRun && ( !mergeFileName.empty() || !serveSocketPath.empty()
+                       || streamRun || !manifestFileName.empty()
+                       || !exploreFileName.empty()
+                       || !solveFileName.empty()
+                       || !subarrayFileName.empty()
+                       || !toleranceFileName.empty()
+                       || !monteCarloFileName.empty()
+                       || !sobolFileName.empty()
+                       || !sampleFileName.empty() ) ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Flag -cross can only be combined ");
+        exceptionMsgThrown.append("with technology and architecture files.\n");
+        exceptionMsgThrown.append(helpMessage);
+        throw exceptionMsgThrown;
+    }
+
+    // Placements and sensitivities are computed for the configurations
+    //  given up front
+    if ( ( floorplanRun || sensitivityRun )
+         && ( !mergeFileName.empty() || !serveSocketPath.empty()
+              || streamRun || !exploreFileName.empty()
+              || !solveFileName.empty() || !subarrayFileName.empty()
+              || !toleranceFileName.empty() || !monteCarloFileName.empty()
+              || !sobolFileName.empty() || !sampleFileName.empty()
+              || !compileLibraryFileName.empty()
+              || !technologyLibraryFileName.empty()
+              || nShards > 1 || resumeRun || !cacheDirectory.empty()
+              || ( floorplanRun && sensitivityRun ) ) ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Flag ");
+        exceptionMsgThrown.append( floorplanRun ? "-floorplan"
+                                                : "-sensitivity" );
+        exceptionMsgThrown.append(" can only be combined ");
+        exceptionMsgThrown.append("with configurations (-t and -p, -cross ");
+        exceptionMsgThrown.append("or -manifest).\n");
+        exceptionMsgThrown.append(helpMessage);
+        throw exceptionMsgThrown;
+    }
+
+    // Technologies are looked up by the runs of configurations only
+    if ( !technologyLibraryFileName.empty()
+         && ( !mergeFileName.empty() || !serveSocketPath.empty()
+              || streamRun || !exploreFileName.empty()
+              || !solveFileName.empty() || !subarrayFileName.empty()
+              || !toleranceFileName.empty() || !monteCarloFileName.empty()
+              || !sobolFileName.empty() || !sampleFileName.empty() ) ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Flag -techlib can not be combined with ");
+        exceptionMsgThrown.append("-merge, -serve, -stream, -explore, ");
+        exceptionMsgThrown.append("-solve, -subarray, -tolerance, ");
+        exceptionMsgThrown.append("-montecarlo, -sobol or -sample.\n");
+        exceptionMsgThrown.append(helpMessage);
+        throw exceptionMsgThrown;
+    }
+
+    // Compile run, only the technology files are read
+    if ( !compileLibraryFileName.empty() ) {
+        if ( technologyFileName.empty() || !architectureFileName.empty()
+             || !technologyLibraryFileName.empty() || crossRun
+             || !manifestFileName.empty() || !mergeFileName.empty()
+             || !serveSocketPath.empty() || streamRun
+             || !exploreFileName.empty() || !solveFileName.empty()
+             || !subarrayFileName.empty() || !toleranceFileName.empty()
+             || !monteCarloFileName.empty() || !sobolFileName.empty()
+             || !sampleFileName.empty() ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Flag -compiletech can only be ");
+            exceptionMsgThrown.append("combined with technology files.\n");
+            exceptionMsgThrown.append(helpMessage);
+            throw exceptionMsgThrown;
+        }
+        return;
+    }
+
+    // Merge, serve, stream, explore, solve, subarray, tolerance, Monte Carlo,
+    //  Sobol and sampling runs, no configuration is given up front
+    vector<string> runFlags;
+    if ( !mergeFileName.empty() ) {
+        runFlags.push_back("-merge");
+    }
+    if ( !serveSocketPath.empty() ) {
+        runFlags.push_back("-serve");
+    }
+    if ( streamRun ) {
+        runFlags.push_back("-stream");
+    }
+    if ( !exploreFileName.empty() ) {
+        runFlags.push_back("-explore");
+    }
+    if ( !solveFileName.empty() ) {
+        runFlags.push_back("-solve");
+    }
+    if ( !subarrayFileName.empty() ) {
+        runFlags.push_back("-subarray");
+    }
+    if ( !toleranceFileName.empty() ) {
+        runFlags.push_back("-tolerance");
+    }
+    if ( !monteCarloFileName.empty() ) {
+        runFlags.push_back("-montecarlo");
+    }
+    if ( !sobolFileName.empty() ) {
+        runFlags.push_back("-sobol");
+    }
+    if ( !sampleFileName.empty() ) {
+        runFlags.push_back("-sample");
+    }
+    if ( !runFlags.empty() ) {
+        if ( runFlags.size() > 1 ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Flags ");
+            exceptionMsgThrown.append(runFlags[0]);
+            exceptionMsgThrown.append(" and ");
+            exceptionMsgThrown.append(runFlags[1]);
+            exceptionMsgThrown.append(" can not be combined.\n");
+            exceptionMsgThrown.append(helpMessage);
+            throw exceptionMsgThrown;
+        }
+        if ( !technologyFileName.empty() || !architectureFileName.empty() ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Flag ");
+            exceptionMsgThrown.append(runFlags[0]);
+            exceptionMsgThrown.append(" can not be combined ");
+            exceptionMsgThrown.append("with technology or architecture files.\n");
+            exceptionMsgThrown.append(helpMessage);
+            throw exceptionMsgThrown;
+        }
+        return;
+    }
+
+    // Manifest run, the configurations are listed in the manifest
+    if ( !manifestFileName.empty() ) {
+        if ( !technologyFileName.empty() || !architectureFileName.empty() ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Flag -manifest can not be combined ");
+            exceptionMsgThrown.append("with technology or architecture files.\n");
+            exceptionMsgThrown.append(helpMessage);
+            throw exceptionMsgThrown;
+        }
+        return;
+    }
+
+    if ( technologyFileName.empty() && architectureFileName.empty() )
+    {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("No technology nor architecture ");
+        exceptionMsgThrown.append("file provided!\n");
+        exceptionMsgThrown.append(helpMessage);
+        throw exceptionMsgThrown;
+    }
+
+    // Cross run, the lists may have different lengths
+    if ( crossRun ) {
+        if ( technologyFileName.empty() || architectureFileName.empty() ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Flag -cross needs both technology ");
+            exceptionMsgThrown.append("and architecture files.\n");
+            exceptionMsgThrown.append(helpMessage);
+            throw exceptionMsgThrown;
+        }
+        if ( !hasExpandableFileNames ) {
+            nConfigurations = technologyFileName.size()
+                              * architectureFileName.size();
+        }
+        return;
+    }
+
+    // Lists with response files, directories or patterns are only
+    //  expanded while the configurations are run
+    if ( hasExpandableFileNames ) {
+        return;
+    }
+
     if( technologyFileName.size() == architectureFileName.size() )
     {
         nConfigurations = technologyFileName.size();
@@ -127,82 +316,250 @@ void ArgumentsParser::runArgParser()
         exceptionMsgThrown.append("). Could not proceed.");
         throw exceptionMsgThrown;
     }
-
-     if ( nConfigurations == 0 )
-     {
-         string exceptionMsgThrown("[ERROR] ");
-         exceptionMsgThrown.append("No technology nor architecture ");
-         exceptionMsgThrown.append("file provided!\n");
-         exceptionMsgThrown.append(helpMessage);
-         throw exceptionMsgThrown;
-
-     }
-
 }
 
 
-bool ArgumentsParser::getTechFileName()
+bool ArgumentsParser::getFileNames(bool isTechnologyList)
 {
-    while (argvID < cpargc) {
+    // Technology (-t) and architecture (-p) lists may alternate, with
+    //  option flags in between. Read in one pass (no recursion per file
+    //  name), lists may have hundreds of thousands of entries.
+    while ( argvID < cpargc ) {
+        const string& argument = cpargv[argvID];
 
-        if( cpargv[argvID] == "-p") {
+        if ( argument == (isTechnologyList ? "-p" : "-t") ) {
+            isTechnologyList = !isTechnologyList;
             argvID++;
-            if(!getArchFileName()) { return false; }
         }
-        else if( cpargv[argvID] == "-term") {
-            IOTerminationCurrentFlag = true;
-            argvID++;
-            if(!getTechFileName()) { return false; }
-        }
-        else if( cpargv[argvID] == "-internaltimings") {
-            printInternalTimings = true;
-            argvID++;
-            if(!getTechFileName()) { return false; }
+        else if( getOption() ) {
+            continue;
         }
-        else if (cpargv[argvID][0] == '-') {
+        else if ( argument[0] == '-' ) {
             return false;
         }
         else {
-            technologyFileName.push_back(cpargv[argvID]);
+            // File names, response files (@file), directories or patterns
+            if ( FileNameList::isExpandable(argument) ) {
+                hasExpandableFileNames = true;
+            }
+            if ( isTechnologyList ) {
+                technologyFileName.push_back(argument);
+            }
+            else {
+                architectureFileName.push_back(argument);
+            }
             argvID++;
-            if(!getTechFileName()) { return false; }
         }
+    }
 
+    return true;
+}
+
+bool ArgumentsParser::getMergeFileName()
+{
+    while (argvID < cpargc && cpargv[argvID][0] != '-') {
+        mergeFileName.push_back(cpargv[argvID]);
         argvID++;
     }
 
+    if ( mergeFileName.empty() ) {
+        return false;
+    }
+
+    // Remaining flags (e.g. -stats)
+    runArgParser();
     return true;
 }
 
-bool ArgumentsParser::getArchFileName()
+void ArgumentsParser::getShard()
 {
-    while (argvID < cpargc) {
+    // Expected format: i/n, with i < n
+    unsigned int index = 0;
+    unsigned int count = 0;
+    char slash = 0;
+    char trailing = 0;
+    bool isValid = false;
 
-        if( cpargv[argvID] == "-t") {
-            argvID++;
-            if(!getTechFileName()) { return false; }
-        }
-        else if( cpargv[argvID] == "-term") {
-            IOTerminationCurrentFlag = true;
-            argvID++;
-            if(!getArchFileName()) { return false; }
-        }
-        else if( cpargv[argvID] == "-internaltimings") {
-            printInternalTimings = true;
-            argvID++;
-            if(!getArchFileName()) { return false; }
-        }
-        else if (cpargv[argvID][0] == '-') {
-            return false;
-        }
-        else {
-            architectureFileName.push_back(cpargv[argvID]);
-            argvID++;
-            if(!getArchFileName()) { return false; }
+    if ( argvID < cpargc ) {
+        const string& shardArg = cpargv[argvID];
+        isValid = ( shardArg[0] >= '0' && shardArg[0] <= '9' )
+                  && sscanf(shardArg.c_str(), "%u%c%u%c",
+                            &index, &slash, &count, &trailing) == 3
+                  && slash == '/'
+                  && index < count;
+    }
+
+    if ( !isValid ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Flag -shard expects an argument i/n ");
+        exceptionMsgThrown.append("with 0 <= i < n");
+        if ( argvID < cpargc ) {
+            exceptionMsgThrown.append(", got \'");
+            exceptionMsgThrown.append(cpargv[argvID]);
+            exceptionMsgThrown.append("\'");
         }
+        exceptionMsgThrown.append(".\n");
+        throw exceptionMsgThrown;
+    }
+
+    shardIndex = index;
+    nShards = count;
+}
+
+void ArgumentsParser::getJobs()
+{
+    string jobsArg = getFlagArgument("-jobs", "a positive number");
+    unsigned int count = 0;
+    char trailing = 0;
+    if ( sscanf(jobsArg.c_str(), "%u%c", &count, &trailing) != 1
+         || count == 0 ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Flag -jobs expects a positive number");
+        exceptionMsgThrown.append(", got \'");
+        exceptionMsgThrown.append(jobsArg);
+        exceptionMsgThrown.append("\'.\n");
+        throw exceptionMsgThrown;
+    }
+    nJobs = count;
+}
+
+void ArgumentsParser::getParameterOverride(const string& definition)
+{
+    // Expected format: name=value, both not empty
+    size_t separator = definition.find('=');
+    if ( separator == string::npos || separator == 0
+         || separator + 1 == definition.size() ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Flag -D expects an override name=value");
+        exceptionMsgThrown.append(", got \'");
+        exceptionMsgThrown.append(definition);
+        exceptionMsgThrown.append("\'.\n");
+        throw exceptionMsgThrown;
+    }
+
+    parameterOverrides.push_back(make_pair(definition.substr(0, separator),
+                                           definition.substr(separator + 1)));
+}
+
+string ArgumentsParser::getFlagArgument(const string& flagName,
+                                        const string& argumentName)
+{
+    if ( argvID >= cpargc || cpargv[argvID].empty()
+         || cpargv[argvID][0] == '-' ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Flag ");
+        exceptionMsgThrown.append(flagName);
+        exceptionMsgThrown.append(" expects ");
+        exceptionMsgThrown.append(argumentName);
+        exceptionMsgThrown.append(".\n");
+        throw exceptionMsgThrown;
+    }
+
+    return cpargv[argvID];
+}
 
+bool ArgumentsParser::getOption()
+{
+    // Option flags may appear anywhere between the file lists
+    if( cpargv[argvID] == "-term") {
+        IOTerminationCurrentFlag = true;
+    }
+    else if( cpargv[argvID] == "-internaltimings") {
+        printInternalTimings = true;
+    }
+    else if( cpargv[argvID] == "-stats") {
+        printRunStatistics = true;
+    }
+    else if( cpargv[argvID] == "-resume") {
+        resumeRun = true;
+    }
+    else if( cpargv[argvID] == "-shard") {
+        argvID++;
+        getShard();
+    }
+    else if( cpargv[argvID] == "-cache") {
+        argvID++;
+        cacheDirectory = getFlagArgument("-cache", "a directory");
+    }
+    else if( cpargv[argvID] == "-serve") {
+        argvID++;
+        serveSocketPath = getFlagArgument("-serve", "a socket path");
+    }
+    else if( cpargv[argvID] == "-D") {
+        argvID++;
+        getParameterOverride(getFlagArgument("-D", "an override name=value"));
+    }
+    else if( cpargv[argvID].compare(0, 2, "-D") == 0 ) {
+        // Also given without space, -Dname=value
+        getParameterOverride(cpargv[argvID].substr(2));
+    }
+    else if( cpargv[argvID] == "-manifest") {
         argvID++;
+        manifestFileName = getFlagArgument("-manifest", "a manifest file");
+    }
+    else if( cpargv[argvID] == "-stream") {
+        streamRun = true;
+    }
+    else if( cpargv[argvID] == "-cross") {
+        crossRun = true;
+    }
+    else if( cpargv[argvID] == "-floorplan") {
+        floorplanRun = true;
+    }
+    else if( cpargv[argvID] == "-sensitivity") {
+        sensitivityRun = true;
+    }
+    else if( cpargv[argvID] == "-techlib") {
+        argvID++;
+        technologyLibraryFileName = getFlagArgument("-techlib",
+                                                    "a technology library");
+    }
+    else if( cpargv[argvID] == "-explore") {
+        argvID++;
+        exploreFileName = getFlagArgument("-explore",
+                                          "an exploration specification");
+    }
+    else if( cpargv[argvID] == "-solve") {
+        argvID++;
+        solveFileName = getFlagArgument("-solve", "a goal specification");
+    }
+    else if( cpargv[argvID] == "-subarray") {
+        argvID++;
+        subarrayFileName = getFlagArgument("-subarray",
+                                           "a subarray specification");
+    }
+    else if( cpargv[argvID] == "-tolerance") {
+        argvID++;
+        toleranceFileName = getFlagArgument("-tolerance",
+                                            "a tolerance specification");
+    }
+    else if( cpargv[argvID] == "-montecarlo") {
+        argvID++;
+        monteCarloFileName = getFlagArgument("-montecarlo",
+                                             "a Monte Carlo specification");
+    }
+    else if( cpargv[argvID] == "-sobol") {
+        argvID++;
+        sobolFileName = getFlagArgument("-sobol", "a Sobol specification");
+    }
+    else if( cpargv[argvID] == "-sample") {
+        argvID++;
+        sampleFileName = getFlagArgument("-sample",
+                                         "a sampling specification");
+    }
+    else if( cpargv[argvID] == "-compiletech") {
+        argvID++;
+        compileLibraryFileName = getFlagArgument("-compiletech",
+                                                 "a technology library");
+    }
+    else if( cpargv[argvID] == "-jobs") {
+        argvID++;
+        getJobs();
+    }
+    else {
+        return false;
     }
 
+    argvID++;
     return true;
 }
@@ -45,6 +45,7 @@
 #include <vector>
 #include <string>
 #include <sstream>
+#include <utility>
 
 using namespace std;
 
@@ -52,11 +53,60 @@ class ArgumentsParser {
 public:
     ArgumentsParser(int argc, char** argv);
 
+    // File names, or response files (@file), directories and patterns,
+    //  which are expanded while running (see ConfigurationSource)
     vector<string> technologyFileName;
     vector<string> architectureFileName;
+    bool hasExpandableFileNames;
+    // Number of configurations, if known before running
     unsigned int nConfigurations;
+    // Manifest listing the configurations instead of -t and -p
+    string manifestFileName;
+    // Every technology with every architecture instead of in pairs
+    bool crossRun;
+    // Every bank and tile placement of each configuration (floorplan run)
+    bool floorplanRun;
+    // Derivatives of the results of each configuration (sensitivity run)
+    bool sensitivityRun;
+    // Compiled technology library the -t technologies are looked up in
+    string technologyLibraryFileName;
+    // Technology library the -t files are compiled into (compile run)
+    string compileLibraryFileName;
     bool IOTerminationCurrentFlag;
     bool printInternalTimings;
+    bool printRunStatistics;
+    // Checkpoint the run and skip the configurations completed by an
+    //  interrupted run
+    bool resumeRun;
+    // Sharded run: only configurations with configID % nShards == shardIndex
+    unsigned int shardIndex;
+    unsigned int nShards;
+    // Directory of the on-disk result cache (empty if not used)
+    string cacheDirectory;
+    // Unix socket on which evaluations are served (serve run)
+    string serveSocketPath;
+    // Evaluate requests read from stdin (stream run)
+    bool streamRun;
+    // Requests evaluated in parallel by a stream run (0: one per core)
+    unsigned int nJobs;
+    // Input parameters replaced in all configurations (-D name=value)
+    vector<pair<string, string>> parameterOverrides;
+    // Grid of input parameters and objectives (explore run)
+    string exploreFileName;
+    // Goals of input parameters under constraints on results (solve run)
+    string solveFileName;
+    // Timing budget of the subarray sizes (subarray run)
+    string subarrayFileName;
+    // Tolerances of input parameters (tolerance run)
+    string toleranceFileName;
+    // Random variations of input parameters (Monte Carlo run)
+    string monteCarloFileName;
+    // Ranges of input parameters for Sobol indices (Sobol run)
+    string sobolFileName;
+    // Ranges of input parameters to sample (sampling run)
+    string sampleFileName;
+    // Shard result tables to be merged (merge run)
+    vector<string> mergeFileName;
 
     ostringstream helpStrStream;
     const char* helpMessage =
@@ -65,11 +115,56 @@ public:
               "(Specify which technology description file should be used.)\n"
             "    -p    <path/to/architecturefile.json> "
               "(Specify which architecture description file should be used.)\n"
+            "    (Instead of file names: @<list file>, <directory> or \"<pattern>\".)\n"
             "  Optional:\n"
+            "    -cross                                "
+              "(Run every technology file with every architecture file.)\n"
+            "    -floorplan                            "
+              "(Best bank and tile placements of each configuration into results_floorplan.csv.)\n"
+            "    -sensitivity                          "
+              "(Derivatives of the results by the technology parameters into results_sensitivity.csv.)\n"
+            "    -manifest <file>                      "
+              "(Run the configurations listed in a manifest instead of -t and -p.)\n"
+            "    -techlib <library file>               "
+              "(Look up the -t technologies by name in a compiled technology library.)\n"
             "    -term                                 "
               "(Include IO termination currents for read and write operations.)\n"
             "    -internaltimings                      "
               "(Enable print out of internal timings.)\n"
+            "    -D <parameter>=<value>                "
+              "(Override an input parameter, e.g. -D Temperature[C]=45.)\n"
+            "    -stats                                "
+              "(Print out run statistics.)\n"
+            "    -shard i/n                            "
+              "(Only run the configurations of shard i out of n, i = 0..n-1.)\n"
+            "    -merge <shard result files>           "
+              "(Merge the result tables of a sharded run into results_merged.csv.)\n"
+            "    -resume                               "
+              "(Checkpoint the run, skipping the configurations completed by an interrupted run.)\n"
+            "    -cache <directory>                    "
+              "(Reuse results stored in (and store new results to) a cache directory.)\n"
+            "    -serve <socket path>                  "
+              "(Serve evaluation requests (NDJSON) on a Unix socket.)\n"
+            "    -stream                               "
+              "(Evaluate requests (NDJSON) from stdin, results to stdout.)\n"
+            "    -jobs <number>                        "
+              "(Number of parallel evaluations, e.g. of -stream, -explore or -montecarlo.)\n"
+            "    -explore <specification file>         "
+              "(Pareto front of a grid or NSGA-II search into results_pareto.csv.)\n"
+            "    -solve <specification file>           "
+              "(Solve for input parameters meeting constraints into results_goals.csv.)\n"
+            "    -subarray <specification file>        "
+              "(Smallest subarray sizes within a timing budget into results_subarray.csv.)\n"
+            "    -tolerance <specification file>       "
+              "(Bounds of the results over tolerances of inputs into results_tolerance.csv.)\n"
+            "    -montecarlo <specification file>      "
+              "(Distributions of the results under random variation into results_montecarlo.csv.)\n"
+            "    -sobol <specification file>           "
+              "(Sobol sensitivity indices over parameter ranges into results_sobol.csv.)\n"
+            "    -sample <specification file>          "
+              "(Sobol, Latin hypercube or stratified points over parameter ranges into results_sample.csv.)\n"
+            "    -compiletech <library file>           "
+              "(Compile the -t technology files into a technology library.)\n"
             "For more information, see README.md.\n";
 
     void runArgParser();
@@ -79,8 +174,14 @@ private:
     vector<string> cpargv;
     int argvID;
 
-    bool getTechFileName();
-    bool getArchFileName();
+    bool getFileNames(bool isTechnologyList);
+    bool getMergeFileName();
+    void getShard();
+    void getJobs();
+    void getParameterOverride(const string& definition);
+    bool getOption();
+    string getFlagArgument(const string& flagName,
+                           const string& argumentName);
 
 };
 
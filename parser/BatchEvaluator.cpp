@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "BatchEvaluator.h"
+
+#include <thread>
+#include <atomic>
+
+#include "../core/Current.h"
+
+BatchEvaluator::BatchEvaluator(unsigned int nWorkers)
+{
+    if ( nWorkers == 0 ) {
+        nWorkers = thread::hardware_concurrency();
+    }
+    this->nWorkers = ( nWorkers == 0 ? 1 : nWorkers );
+}
+
+void
+BatchEvaluator::evaluate(const vector<TechnologyValues>& inputs,
+                         bool IOTerminationCurrentFlag,
+                         vector<DramResult>& results,
+                         vector<string>& errors) const
+{
+    results.assign(inputs.size(), DramResult());
+    errors.assign(inputs.size(), "");
+
+    // Configurations are taken one after the other by the workers
+    atomic<size_t> nextConfiguration(0);
+    auto work = [&]() {
+        while ( true ) {
+            size_t configuration = nextConfiguration++;
+            if ( configuration >= inputs.size() ) {
+                return;
+            }
+            try {
+                Current dram(inputs[configuration], IOTerminationCurrentFlag);
+                results[configuration].collect(dram);
+            } catch(string exceptionMsgThrown) {
+                errors[configuration] = exceptionMsgThrown;
+            }
+        }
+    };
+
+    size_t nThreads = min<size_t>(nWorkers, inputs.size());
+    if ( nThreads <= 1 ) {
+        work();
+        return;
+    }
+    vector<thread> workers;
+    for ( size_t it = 0; it < nThreads; it++ ) {
+        workers.push_back(thread(work));
+    }
+    for ( size_t it = 0; it < workers.size(); it++ ) {
+        workers[it].join();
+    }
+}
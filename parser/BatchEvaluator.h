@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef BATCHEVALUATOR_H
+#define BATCHEVALUATOR_H
+
+#include <string>
+#include <vector>
+
+#include "TechnologyValues.h"
+#include "DramResult.h"
+
+using namespace std;
+
+// Evaluates a batch of configurations on several threads. Each result is
+//  stored at the position of its configuration, so the outcome does not
+//  depend on how the configurations were scheduled.
+class BatchEvaluator
+{
+public:
+    // 0 workers: one per core
+    explicit BatchEvaluator(unsigned int nWorkers = 0);
+
+    // errors[i] is empty if configuration i was evaluated, otherwise it
+    //  holds the error message of the model
+    void evaluate(const vector<TechnologyValues>& inputs,
+                  bool IOTerminationCurrentFlag,
+                  vector<DramResult>& results,
+                  vector<string>& errors) const;
+
+    unsigned int workers() const { return nWorkers; }
+
+private:
+    unsigned int nWorkers;
+};
+
+#endif // BATCHEVALUATOR_H
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "CheckpointJournal.h"
+
+#include <cstdlib>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "../utils/utils.h"
+
+CheckpointJournal::CheckpointJournal()
+{
+    fd = -1;
+    nPendingRecords = 0;
+    loadedSize = 0;
+}
+
+CheckpointJournal::~CheckpointJournal()
+{
+    if ( fd >= 0 ) {
+        close(fd);
+    }
+}
+
+void
+CheckpointJournal::load(istream& journalFile)
+{
+    // A record spans several lines if a file name holds a line break
+    string line;
+    while ( getCsvRecord(journalFile, line) ) {
+        // A last line without line break was torn by the interruption
+        if ( journalFile.eof() ) {
+            break;
+        }
+
+        const char* lineStart = line.c_str();
+        char* idEnd;
+        unsigned long configID = strtoul(lineStart, &idEnd, 10);
+        if ( idEnd == lineStart || *idEnd != ',' ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Invalid line in checkpoint journal: ");
+            exceptionMsgThrown.append(line);
+            exceptionMsgThrown.append("\n");
+            throw exceptionMsgThrown;
+        }
+        completed[configID] = string(idEnd + 1);
+        loadedSize += line.size() + 1;
+    }
+}
+
+bool
+CheckpointJournal::isCompleted(unsigned int configID,
+                               const string& technologyFileName,
+                               const string& architectureFileName) const
+{
+    map<unsigned int, string>::const_iterator entry = completed.find(configID);
+    if ( entry == completed.end() ) {
+        return false;
+    }
+
+    string fileNameFields;
+    appendCsvFileNames(fileNameFields, technologyFileName,
+                       architectureFileName);
+    if ( entry->second != fileNameFields ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Checkpoint journal does not match ");
+        exceptionMsgThrown.append("this run: configuration ");
+        exceptionMsgThrown.append(to_string(configID));
+        exceptionMsgThrown.append(" was run with ");
+        exceptionMsgThrown.append(entry->second);
+        exceptionMsgThrown.append(".\n");
+        throw exceptionMsgThrown;
+    }
+    return true;
+}
+
+void
+CheckpointJournal::open(const string& fileName, bool keepEntries)
+{
+    journalFileName = fileName;
+    int flags = O_WRONLY | O_CREAT | O_APPEND;
+    if ( !keepEntries ) {
+        flags |= O_TRUNC;
+        completed.clear();
+        loadedSize = 0;
+    }
+
+    fd = ::open(fileName.c_str(), flags, 0644);
+    if ( fd < 0 ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Could not open checkpoint journal \'");
+        exceptionMsgThrown.append(fileName);
+        exceptionMsgThrown.append("\': ");
+        exceptionMsgThrown.append(strerror(errno));
+        exceptionMsgThrown.append("\n");
+        throw exceptionMsgThrown;
+    }
+
+    if ( keepEntries ) {
+        // Drop a torn last line of the interrupted run
+        if ( ftruncate(fd, loadedSize) != 0 ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Could not repair checkpoint journal \'");
+            exceptionMsgThrown.append(fileName);
+            exceptionMsgThrown.append("\'.\n");
+            throw exceptionMsgThrown;
+        }
+    }
+}
+
+void
+CheckpointJournal::record(const DramResult& result)
+{
+    pendingRecords.append(to_string(result.configID));
+    pendingRecords.append(",");
+    appendCsvFileNames(pendingRecords, result.technologyFileName,
+                       result.architectureFileName);
+    pendingRecords.append("\n");
+    nPendingRecords++;
+}
+
+void
+CheckpointJournal::commit()
+{
+    if ( fd < 0 || nPendingRecords == 0 ) {
+        return;
+    }
+
+    const char* data = pendingRecords.data();
+    size_t remaining = pendingRecords.size();
+    while ( remaining > 0 ) {
+        ssize_t written = write(fd, data, remaining);
+        if ( written < 0 && errno == EINTR ) {
+            continue;
+        }
+        if ( written <= 0 ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Could not write checkpoint journal \'");
+            exceptionMsgThrown.append(journalFileName);
+            exceptionMsgThrown.append("\': ");
+            exceptionMsgThrown.append(strerror(errno));
+            exceptionMsgThrown.append("\n");
+            throw exceptionMsgThrown;
+        }
+        data += written;
+        remaining -= written;
+    }
+    if ( fsync(fd) != 0 ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Could not sync checkpoint journal \'");
+        exceptionMsgThrown.append(journalFileName);
+        exceptionMsgThrown.append("\': ");
+        exceptionMsgThrown.append(strerror(errno));
+        exceptionMsgThrown.append("\n");
+        throw exceptionMsgThrown;
+    }
+
+    pendingRecords.clear();
+    nPendingRecords = 0;
+}
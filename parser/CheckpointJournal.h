@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef CHECKPOINTJOURNAL_H
+#define CHECKPOINTJOURNAL_H
+
+#include <iostream>
+#include <string>
+#include <map>
+#include <sys/types.h>
+
+#include "DramResult.h"
+
+using namespace std;
+
+// Journal of the configurations whose results have been completely written.
+// One line per configuration: "configID,technology file,architecture file".
+// Lines are collected in batches and each batch is appended and fsync'ed
+//  at once, so after a crash the journal only lists finished configurations
+//  (a torn last line is ignored when the journal is read back).
+class CheckpointJournal
+{
+public:
+    CheckpointJournal();
+    ~CheckpointJournal();
+
+    // Reads back the journal of an interrupted run (see -resume)
+    void load(istream& journalFile);
+
+    // True if the configuration was completed by the interrupted run.
+    // Throws if that run used different files for this configuration.
+    bool isCompleted(unsigned int configID,
+                     const string& technologyFileName,
+                     const string& architectureFileName) const;
+
+    bool hasEntry(unsigned int configID) const
+    {
+        return completed.count(configID) > 0;
+    }
+
+    size_t nCompleted() const { return completed.size(); }
+
+    // Starts journaling, keeping (resume) or discarding previous entries
+    void open(const string& fileName, bool keepEntries);
+
+    // Adds a finished configuration to the current batch
+    void record(const DramResult& result);
+
+    bool hasPendingRecords() const { return nPendingRecords > 0; }
+    bool isBatchFull() const { return nPendingRecords >= batchSize; }
+
+    // Appends the current batch to the journal file and syncs it to disk
+    void commit();
+
+    // Maximum number of configurations in one batch
+    static const unsigned int batchSize = 16;
+
+private:
+    // Files of the completed configurations, indexed by configuration id
+    map<unsigned int, string> completed;
+    // Size of the complete lines read back by load()
+    off_t loadedSize;
+
+    string journalFileName;
+    int fd;
+    string pendingRecords;
+    unsigned int nPendingRecords;
+};
+
+#endif // CHECKPOINTJOURNAL_H
@@ -0,0 +1,449 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "ConfigurationSource.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <glob.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+static bool
+isDirectory(const string& path)
+{
+    struct stat pathStat;
+    return stat(path.c_str(), &pathStat) == 0 && S_ISDIR(pathStat.st_mode);
+}
+
+// Line without comment (#...) and surrounding white space
+static string
+stripLine(const string& line)
+{
+    string stripped(line, 0, line.find('#'));
+    size_t first = stripped.find_first_not_of(" \t\r");
+    if ( first == string::npos ) {
+        return "";
+    }
+    size_t last = stripped.find_last_not_of(" \t\r");
+    return stripped.substr(first, last - first + 1);
+}
+
+// Fields of a manifest line, split on white space up to a comment (#...).
+//  A field in double quotes may contain white space and '#', and a doubled
+//  quote stands for one quote. False if a quote is not closed.
+static bool
+splitManifestLine(const string& line, vector<string>& fields)
+{
+    fields.clear();
+    size_t position = 0;
+    while ( position < line.size() ) {
+        char character = line[position];
+        if ( character == ' ' || character == '\t' || character == '\r' ) {
+            position++;
+            continue;
+        }
+        if ( character == '#' ) {
+            break;
+        }
+
+        string field;
+        if ( character == '"' ) {
+            position++;
+            bool isClosed = false;
+            while ( position < line.size() ) {
+                if ( line[position] != '"' ) {
+                    field += line[position++];
+                }
+                else if ( position + 1 < line.size()
+                          && line[position + 1] == '"' ) {
+                    field += '"';
+                    position += 2;
+                }
+                else {
+                    position++;
+                    isClosed = true;
+                    break;
+                }
+            }
+            if ( !isClosed ) {
+                return false;
+            }
+        }
+        else {
+            size_t end = line.find_first_of(" \t\r#", position);
+            if ( end == string::npos ) {
+                end = line.size();
+            }
+            field = line.substr(position, end - position);
+            position = end;
+        }
+        fields.push_back(field);
+    }
+    return true;
+}
+
+FileNameList::FileNameList(const vector<string>& entries) :
+    entries(entries)
+{
+    nextEntry = 0;
+    nextExpandedFileName = 0;
+}
+
+bool
+FileNameList::isExpandable(const string& entry)
+{
+    return ( !entry.empty() && entry[0] == '@' )
+           || entry.find_first_of("*?[") != string::npos
+           || isDirectory(entry);
+}
+
+bool
+FileNameList::next(string& fileName)
+{
+    while ( true ) {
+        if ( responseFile.is_open() ) {
+            string line;
+            while ( getline(responseFile, line) ) {
+                fileName = stripLine(line);
+                if ( !fileName.empty() ) {
+                    return true;
+                }
+            }
+            responseFile.close();
+        }
+
+        if ( nextExpandedFileName < expandedFileNames.size() ) {
+            fileName = expandedFileNames[nextExpandedFileName++];
+            return true;
+        }
+
+        if ( nextEntry >= entries.size() ) {
+            return false;
+        }
+
+        const string& entry = entries[nextEntry++];
+        if ( !isExpandable(entry) ) {
+            fileName = entry;
+            return true;
+        }
+        try {
+            expandEntry(entry);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+    }
+}
+
+void
+FileNameList::restart()
+{
+    if ( responseFile.is_open() ) {
+        responseFile.close();
+    }
+    responseFile.clear();
+    expandedFileNames.clear();
+    nextExpandedFileName = 0;
+    nextEntry = 0;
+}
+
+void
+FileNameList::expandEntry(const string& entry)
+{
+    expandedFileNames.clear();
+    nextExpandedFileName = 0;
+
+    if ( entry[0] == '@' ) {
+        responseFileName = entry.substr(1);
+        responseFile.open(responseFileName);
+        if ( !responseFile.is_open() ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Could not open response file \'");
+            exceptionMsgThrown.append(responseFileName);
+            exceptionMsgThrown.append("\'.\n");
+            throw exceptionMsgThrown;
+        }
+    }
+    else if ( isDirectory(entry) ) {
+        string directory(entry);
+        while ( directory.size() > 1 && directory[directory.size()-1] == '/' ) {
+            directory.erase(directory.size()-1);
+        }
+        DIR* directoryStream = opendir(directory.c_str());
+        if ( directoryStream == NULL ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Could not read directory \'");
+            exceptionMsgThrown.append(directory);
+            exceptionMsgThrown.append("\'.\n");
+            throw exceptionMsgThrown;
+        }
+        struct dirent* directoryEntry;
+        while ( (directoryEntry = readdir(directoryStream)) != NULL ) {
+            string name(directoryEntry->d_name);
+            if ( name.size() > 5 && name[0] != '.'
+                 && name.compare(name.size() - 5, 5, ".json") == 0 ) {
+                expandedFileNames.push_back(directory + "/" + name);
+            }
+        }
+        closedir(directoryStream);
+        sort(expandedFileNames.begin(), expandedFileNames.end());
+    }
+    else {
+        glob_t matches;
+        int status = glob(entry.c_str(), 0, NULL, &matches);
+        if ( status != 0 ) {
+            globfree(&matches);
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("No input file matches \'");
+            exceptionMsgThrown.append(entry);
+            exceptionMsgThrown.append("\'.\n");
+            throw exceptionMsgThrown;
+        }
+        // Sorted by glob
+        for ( size_t it = 0; it < matches.gl_pathc; it++ ) {
+            expandedFileNames.push_back(matches.gl_pathv[it]);
+        }
+        globfree(&matches);
+    }
+}
+
+ConfigurationSource::ConfigurationSource(const ArgumentsParser& arg) :
+    technologyFileNames(arg.technologyFileName),
+    architectureFileNames(arg.architectureFileName),
+    manifestFileName(arg.manifestFileName)
+{
+    manifestLine = 0;
+    isManifestNumbered = false;
+    nRead = 0;
+    isCrossProduct = arg.crossRun;
+    hasRowTechnology = false;
+
+    if ( !manifestFileName.empty() ) {
+        manifest.open(manifestFileName);
+        if ( !manifest.is_open() ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Could not open manifest \'");
+            exceptionMsgThrown.append(manifestFileName);
+            exceptionMsgThrown.append("\'.\n");
+            throw exceptionMsgThrown;
+        }
+    }
+}
+
+bool
+ConfigurationSource::next(Configuration& configuration)
+{
+    if ( !manifestFileName.empty() ) {
+        try {
+            return nextInManifest(configuration);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+    }
+    if ( isCrossProduct ) {
+        try {
+            return nextInCrossProduct(configuration);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+    }
+
+    bool hasTechnology = false;
+    bool hasArchitecture = false;
+    try {
+        hasTechnology = technologyFileNames.next(
+                            configuration.technologyFileName);
+        hasArchitecture = architectureFileNames.next(
+                              configuration.architectureFileName);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    if ( hasTechnology != hasArchitecture ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Number of technology files is different ");
+        exceptionMsgThrown.append("from the number of archtecture files, the ");
+        exceptionMsgThrown.append(hasTechnology ? "architecture"
+                                                : "technology");
+        exceptionMsgThrown.append(" list ends after ");
+        exceptionMsgThrown.append(to_string(nRead));
+        exceptionMsgThrown.append(" files.\n");
+        throw exceptionMsgThrown;
+    }
+    if ( !hasTechnology ) {
+        return false;
+    }
+
+    configuration.configID = nRead++;
+    return true;
+}
+
+bool
+ConfigurationSource::nextInCrossProduct(Configuration& configuration)
+{
+    try {
+        // At the end of a row, the next technology starts over
+        //  with the first architecture
+        while ( !hasRowTechnology
+                || !architectureFileNames.next(
+                        configuration.architectureFileName) ) {
+            if ( !technologyFileNames.next(rowTechnologyFileName) ) {
+                return false;
+            }
+            hasRowTechnology = true;
+            architectureFileNames.restart();
+        }
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    configuration.technologyFileName = rowTechnologyFileName;
+    configuration.configID = nRead++;
+    return true;
+}
+
+bool
+ConfigurationSource::nextInManifest(Configuration& configuration)
+{
+    string line;
+    while ( getline(manifest, line) ) {
+        manifestLine++;
+        vector<string> fields;
+        bool isValid = splitManifestLine(line, fields);
+        if ( isValid && fields.empty() ) {
+            continue;
+        }
+
+        // Read into locals, so a short line leaves nothing of the
+        //  previous configuration behind
+        isValid = isValid && fields.size() >= 2 && fields.size() <= 3;
+        string technologyFileName = isValid ? fields[0] : "";
+        string architectureFileName = isValid ? fields[1] : "";
+        string configIDField = ( isValid && fields.size() == 3 )
+                               ? fields[2] : "";
+
+        unsigned int configID = nRead;
+        char trailing = 0;
+        isValid = isValid
+                  && !technologyFileName.empty()
+                  && !architectureFileName.empty()
+                  && ( configIDField.empty()
+                       || ( configIDField[0] >= '0'
+                            && configIDField[0] <= '9'
+                            && sscanf(configIDField.c_str(), "%u%c",
+                                      &configID, &trailing) == 1 ) );
+
+        // The default number is the position in the manifest, which may
+        //  be the number given on another line, so either every line
+        //  gives its number or none does
+        bool isNumbered = !configIDField.empty();
+        if ( isValid && nRead > 0 && isNumbered != isManifestNumbered ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Line ");
+            exceptionMsgThrown.append(to_string(manifestLine));
+            exceptionMsgThrown.append(" of manifest \'");
+            exceptionMsgThrown.append(manifestFileName);
+            exceptionMsgThrown.append(isNumbered
+                                      ? "\' gives a configuration number, "
+                                        "but the lines before it do not.\n"
+                                      : "\' gives no configuration number, "
+                                        "but the lines before it do.\n");
+            throw exceptionMsgThrown;
+        }
+        isManifestNumbered = isNumbered;
+
+        if ( isValid && !claimManifestConfigID(configID) ) {
+            isValid = false;
+        }
+        if ( !isValid ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Line ");
+            exceptionMsgThrown.append(to_string(manifestLine));
+            exceptionMsgThrown.append(" of manifest \'");
+            exceptionMsgThrown.append(manifestFileName);
+            exceptionMsgThrown.append("\' is not \"<technology file> ");
+            exceptionMsgThrown.append("<architecture file> ");
+            exceptionMsgThrown.append("[<unused configuration number>]\".\n");
+            throw exceptionMsgThrown;
+        }
+
+        configuration.technologyFileName = technologyFileName;
+        configuration.architectureFileName = architectureFileName;
+        configuration.configID = configID;
+        nRead++;
+        return true;
+    }
+    return false;
+}
+
+bool
+ConfigurationSource::claimManifestConfigID(unsigned int configID)
+{
+    // First range starting after the number, and the one before it
+    map<unsigned int, unsigned long long>::iterator nextRange
+            = manifestConfigIDs.upper_bound(configID);
+    map<unsigned int, unsigned long long>::iterator range = nextRange;
+    if ( range != manifestConfigIDs.begin() ) {
+        --range;
+        if ( configID < range->second ) {
+            return false;
+        }
+        if ( range->second != configID ) {
+            range = manifestConfigIDs.end();
+        }
+    }
+    else {
+        range = manifestConfigIDs.end();
+    }
+
+    unsigned long long rangeEnd = configID + 1ULL;
+    if ( nextRange != manifestConfigIDs.end()
+         && nextRange->first == rangeEnd ) {
+        rangeEnd = nextRange->second;
+        manifestConfigIDs.erase(nextRange);
+    }
+    if ( range != manifestConfigIDs.end() ) {
+        range->second = rangeEnd;
+    }
+    else {
+        manifestConfigIDs[configID] = rangeEnd;
+    }
+    return true;
+}
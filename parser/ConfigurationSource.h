@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef CONFIGURATIONSOURCE_H
+#define CONFIGURATIONSOURCE_H
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <map>
+
+#include "ArgumentsParser.h"
+
+using namespace std;
+
+// One configuration of a run: the input files and its number
+struct Configuration
+{
+    unsigned int configID;
+    string technologyFileName;
+    string architectureFileName;
+};
+
+// Names of the input files of one list (-t or -p). Each entry is a file
+//  name, a response file (@file, one file name per line), a directory
+//  (all its .json files) or a pattern ("dir/*.json"), sorted by name.
+// Entries are only expanded when reached, and response files are read
+//  line by line, so long lists are never held in memory as a whole.
+class FileNameList
+{
+public:
+    explicit FileNameList(const vector<string>& entries);
+
+    bool next(string& fileName);
+    // From the first entry again (response files are read again)
+    void restart();
+
+    // Whether an entry stands for more than one file name
+    static bool isExpandable(const string& entry);
+
+private:
+    void expandEntry(const string& entry);
+
+    const vector<string>& entries;
+    size_t nextEntry;
+
+    ifstream responseFile;
+    string responseFileName;
+    vector<string> expandedFileNames;
+    size_t nextExpandedFileName;
+};
+
+// Configurations of a run, one after the other: the technology and
+//  architecture lists in pairs, every technology with every architecture
+//  (-cross, technology-major: each technology with the whole architecture
+//  list, before the next technology), or the lines of a manifest
+//  ("<technology file> <architecture file> [<configuration number>]",
+//  numbered on every line or on none, file names with white space, '#'
+//  or '"' in double quotes, a quote doubled).
+class ConfigurationSource
+{
+public:
+    explicit ConfigurationSource(const ArgumentsParser& arg);
+
+    bool next(Configuration& configuration);
+
+    unsigned int nConfigurations() const { return nRead; }
+
+private:
+    bool nextInManifest(Configuration& configuration);
+    bool nextInCrossProduct(Configuration& configuration);
+    // False if the number was already used in the manifest
+    bool claimManifestConfigID(unsigned int configID);
+
+    FileNameList technologyFileNames;
+    FileNameList architectureFileNames;
+
+    bool isCrossProduct;
+    // Technology of the current row of a cross run
+    bool hasRowTechnology;
+    string rowTechnologyFileName;
+
+    ifstream manifest;
+    string manifestFileName;
+    unsigned int manifestLine;
+    // Whether the lines read so far give their configuration numbers
+    bool isManifestNumbered;
+    // Numbers of the configurations in the manifest, which must not
+    //  repeat, as ranges (first -> one past the last). Consecutive numbers
+    //  share one range, so a manifest numbered in order (or not at all)
+    //  keeps a single entry however long it is.
+    map<unsigned int, unsigned long long> manifestConfigIDs;
+
+    unsigned int nRead;
+};
+
+#endif // CONFIGURATIONSOURCE_H
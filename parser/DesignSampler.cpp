@@ -0,0 +1,772 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "DesignSampler.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "BatchEvaluator.h"
+#include "MonteCarloSimulator.h"
+
+// Primitive polynomials (degree, coefficients) and initial direction
+//  numbers of the Sobol sequence from its second dimension on (Joe and
+//  Kuo, new-joe-kuo-6.21201). The first dimension is the van der Corput
+//  sequence.
+struct SobolPolynomial
+{
+    unsigned int degree;
+    unsigned int coefficients;
+    uint32_t initialNumbers[7];
+};
+
+static const SobolPolynomial sobolPolynomials[] = {
+    { 1,  0, { 1 } },
+    { 2,  1, { 1, 3 } },
+    { 3,  1, { 1, 3, 1 } },
+    { 3,  2, { 1, 1, 1 } },
+    { 4,  1, { 1, 1, 3, 3 } },
+    { 4,  4, { 1, 3, 5, 13 } },
+    { 5,  2, { 1, 1, 5, 5, 17 } },
+    { 5,  4, { 1, 1, 5, 5, 5 } },
+    { 5,  7, { 1, 1, 7, 11, 19 } },
+    { 5, 11, { 1, 1, 5, 1, 1 } },
+    { 5, 13, { 1, 1, 1, 3, 11 } },
+    { 5, 14, { 1, 3, 5, 5, 31 } },
+    { 6,  1, { 1, 3, 3, 9, 7, 49 } },
+    { 6, 13, { 1, 1, 1, 15, 21, 21 } },
+    { 6, 16, { 1, 3, 1, 13, 27, 49 } },
+    { 6, 19, { 1, 1, 1, 15, 7, 5 } },
+    { 6, 22, { 1, 3, 1, 15, 13, 25 } },
+    { 6, 25, { 1, 1, 5, 5, 19, 61 } },
+    { 7,  1, { 1, 3, 7, 11, 23, 15, 103 } },
+    { 7,  4, { 1, 3, 7, 13, 13, 15, 69 } }
+};
+
+static const unsigned int sobolBits = 32;
+
+// Direction numbers of all dimensions, bit 31 first
+static vector<vector<uint32_t> >
+sobolDirections()
+{
+    vector<vector<uint32_t> > directions(DesignSampler::maxSobolParameters,
+                                         vector<uint32_t>(sobolBits));
+    for ( unsigned int bit = 0; bit < sobolBits; bit++ ) {
+        directions[0][bit] = uint32_t(1) << (sobolBits - 1 - bit);
+    }
+    for ( unsigned int dimension = 1;
+          dimension < DesignSampler::maxSobolParameters; dimension++ ) {
+        const SobolPolynomial& polynomial = sobolPolynomials[dimension - 1];
+        unsigned int degree = polynomial.degree;
+        vector<uint32_t>& numbers = directions[dimension];
+        for ( unsigned int bit = 0; bit < sobolBits; bit++ ) {
+            if ( bit < degree ) {
+                numbers[bit] = polynomial.initialNumbers[bit]
+                               << (sobolBits - 1 - bit);
+                continue;
+            }
+            numbers[bit] = numbers[bit - degree]
+                           ^ ( numbers[bit - degree] >> degree );
+            for ( unsigned int term = 1; term < degree; term++ ) {
+                if ( ( polynomial.coefficients >> (degree - 1 - term) ) & 1 ) {
+                    numbers[bit] ^= numbers[bit - term];
+                }
+            }
+        }
+    }
+    return directions;
+}
+
+double
+DesignSampler::sobolCoordinate(uint32_t pointIndex, unsigned int dimension)
+{
+    static const vector<vector<uint32_t> > directions = sobolDirections();
+
+    const vector<uint32_t>& numbers = directions[dimension];
+    uint32_t coordinate = 0;
+    for ( unsigned int bit = 0; pointIndex != 0; bit++, pointIndex >>= 1 ) {
+        if ( pointIndex & 1 ) {
+            coordinate ^= numbers[bit];
+        }
+    }
+    return coordinate / 4294967296.0;
+}
+
+uint32_t
+DesignSampler::permute(uint32_t index, uint32_t length, uint32_t key)
+{
+    // Every step is invertible on the bits below the mask, so the hash is a
+    //  permutation of 0 .. mask, and indices beyond the length are hashed
+    //  again until they fall below it
+    uint32_t mask = length - 1;
+    mask |= mask >> 1;
+    mask |= mask >> 2;
+    mask |= mask >> 4;
+    mask |= mask >> 8;
+    mask |= mask >> 16;
+    do {
+        index ^= key;
+        index *= 0xe170893d;
+        index ^= key >> 16;
+        index ^= (index & mask) >> 4;
+        index ^= key >> 8;
+        index *= 0x0929eb3f;
+        index ^= key >> 23;
+        index ^= (index & mask) >> 1;
+        index *= 1 | key >> 27;
+        index *= 0x6935fa69;
+        index ^= (index & mask) >> 11;
+        index *= 0x74dcb303;
+        index ^= (index & mask) >> 2;
+        index *= 0x9e501cc3;
+        index ^= (index & mask) >> 2;
+        index *= 0xc860a3df;
+        index &= mask;
+        index ^= index >> 5;
+    } while ( index >= length );
+    return uint32_t( ( uint64_t(index) + key ) % length );
+}
+
+// Key of a permutation: a draw of the counter-based generator beyond all
+//  points
+static uint32_t
+permutationKey(uint64_t seed, uint64_t permutation)
+{
+    return uint32_t(MonteCarloSimulator::counterUniform(seed, UINT64_MAX,
+                                                        permutation)
+                    * 4294967296.0);
+}
+
+static const char* const tilesField = "TilesPerBank[]";
+static const char* const pageSpanningField = "PageSpanningFactor[]";
+static const char* const banksField = "NumberOfBanksPerChannel[]";
+static const char* const verticalBanksField
+        = "NumberOfVerticalBanksPerChannel[]";
+static const char* const horizontalBanksField
+        = "NumberOfHorizontalBanksPerChannel[]";
+
+static const double tilesValues[] = { 1, 2, 4 };
+static const double pageSpanningValues[] = { 0.25, 0.5, 1 };
+
+static bool
+isBankPlacementField(const string& name)
+{
+    return name == banksField || name == verticalBanksField
+           || name == horizontalBanksField;
+}
+
+// Parameters which the model only takes from a few values
+static bool
+isDiscreteField(const string& name)
+{
+    return name == tilesField || name == pageSpanningField
+           || isBankPlacementField(name);
+}
+
+// Values of a discrete parameter which the model allows in a range
+static vector<double>
+allowedValuesIn(const string& name, double minimum, double maximum)
+{
+    vector<double> candidates;
+    if ( name == tilesField ) {
+        candidates.assign(tilesValues, tilesValues + 3);
+    }
+    else if ( name == pageSpanningField ) {
+        candidates.assign(pageSpanningValues, pageSpanningValues + 3);
+    }
+    else {
+        for ( double power = 1; power <= maximum; power *= 2 ) {
+            candidates.push_back(power);
+        }
+    }
+
+    vector<double> values;
+    for ( unsigned int it = 0; it < candidates.size(); it++ ) {
+        if ( candidates[it] >= minimum && candidates[it] <= maximum ) {
+            values.push_back(candidates[it]);
+        }
+    }
+    return values;
+}
+
+bool
+DesignSampler::isAllowedValue(const TechnologyField* field, double value)
+{
+    const string name(field->name);
+    if ( name == tilesField ) {
+        return find(tilesValues, tilesValues + 3, value) != tilesValues + 3;
+    }
+    if ( name == pageSpanningField ) {
+        return find(pageSpanningValues, pageSpanningValues + 3, value)
+               != pageSpanningValues + 3;
+    }
+    if ( isBankPlacementField(name) ) {
+        return value >= 1 && isInteger(value) && isPowerOfTwo(value);
+    }
+    if ( field->isInteger ) {
+        return value >= 0 && isInteger(value);
+    }
+    return true;
+}
+
+// Whether a value of a discrete parameter fits the values of the other
+//  parameters of a point, as Tile and Channel check them
+static bool
+fitsOtherParameters(const string& name, double value,
+                    const TechnologyValues& inputs)
+{
+    if ( name == pageSpanningField ) {
+        return value * inputs.nTilesPerBank >= 1;
+    }
+    if ( name == verticalBanksField ) {
+        return value <= inputs.nBanks;
+    }
+    if ( name == horizontalBanksField ) {
+        return value <= inputs.nBanks
+               && ( inputs.nVerticalBanks == INVALID_VALUE
+                    || value * inputs.nVerticalBanks == inputs.nBanks );
+    }
+    return true;
+}
+
+// Parameters whose values limit others come first
+static int
+assignmentRank(const string& name)
+{
+    if ( name == horizontalBanksField ) {
+        return 2;
+    }
+    if ( name == verticalBanksField || name == pageSpanningField ) {
+        return 1;
+    }
+    return 0;
+}
+
+DesignSampler::DesignSampler(bool IOTerminationCurrentFlag,
+                             unsigned int nJobs) :
+    IOTerminationCurrentFlag(IOTerminationCurrentFlag),
+    nJobs(nJobs)
+{
+    method = SOBOL;
+    nSamples = 1024;
+    seed = 1;
+    nRejected = 0;
+    isBankPlacementSampled = false;
+}
+
+void
+DesignSampler::readSpecification(const string& specificationFileName)
+{
+    rapidjson::Document specification;
+    string exceptionMsgThrown;
+    try {
+        baseInputs = TechnologyValues::readSpecification(
+                         specificationFileName, "sampling", "Sampling specification",
+                         specification, exceptionMsgThrown);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    if ( specification.HasMember("method") ) {
+        string methodName;
+        if ( specification["method"].IsString() ) {
+            methodName = specification["method"].GetString();
+        }
+        if ( methodName == "sobol" ) {
+            method = SOBOL;
+        }
+        else if ( methodName == "latin" ) {
+            method = LATIN_HYPERCUBE;
+        }
+        else if ( methodName == "stratified" ) {
+            method = STRATIFIED;
+        }
+        else {
+            exceptionMsgThrown.append("gives no \"method\" of \"sobol\", ");
+            exceptionMsgThrown.append("\"latin\" or \"stratified\".\n");
+            throw exceptionMsgThrown;
+        }
+    }
+    if ( specification.HasMember("samples") ) {
+        if ( !specification["samples"].IsUint64()
+             || specification["samples"].GetUint64() == 0 ) {
+            exceptionMsgThrown.append("gives no positive number of ");
+            exceptionMsgThrown.append("\"samples\".\n");
+            throw exceptionMsgThrown;
+        }
+        nSamples = specification["samples"].GetUint64();
+    }
+    if ( specification.HasMember("seed") ) {
+        if ( !specification["seed"].IsUint64() ) {
+            exceptionMsgThrown.append("gives no \"seed\" of a number ");
+            exceptionMsgThrown.append("from 0.\n");
+            throw exceptionMsgThrown;
+        }
+        seed = specification["seed"].GetUint64();
+    }
+
+    if ( !specification.HasMember("parameters")
+         || !specification["parameters"].IsObject()
+         || specification["parameters"].MemberCount() == 0 ) {
+        exceptionMsgThrown.append("needs \"parameters\", an object of ");
+        exceptionMsgThrown.append("input parameter ranges.\n");
+        throw exceptionMsgThrown;
+    }
+    sampledParameters.clear();
+    assignmentOrder.clear();
+    isBankPlacementSampled = false;
+    const rapidjson::Value& parameterList = specification["parameters"];
+    for ( rapidjson::Value::ConstMemberIterator member
+                = parameterList.MemberBegin();
+          member != parameterList.MemberEnd(); ++member ) {
+        string name(member->name.GetString());
+        const rapidjson::Value& parameter = member->value;
+        bool isRange = parameter.IsObject()
+                       && parameter.HasMember("minimum")
+                       && parameter["minimum"].IsNumber()
+                       && parameter.HasMember("maximum")
+                       && parameter["maximum"].IsNumber();
+        bool isList = parameter.IsArray();
+        for ( rapidjson::SizeType it = 0; isList && it < parameter.Size();
+              it++ ) {
+            isList = parameter[it].IsNumber();
+        }
+        if ( !isRange && !isList ) {
+            exceptionMsgThrown.append("gives \"");
+            exceptionMsgThrown.append(name);
+            exceptionMsgThrown.append("\" neither a range ({ \"minimum\": ");
+            exceptionMsgThrown.append("..., \"maximum\": ... }) nor a list ");
+            exceptionMsgThrown.append("of values.\n");
+            throw exceptionMsgThrown;
+        }
+        try {
+            if ( isRange ) {
+                addRange(name, parameter["minimum"].GetDouble(),
+                         parameter["maximum"].GetDouble());
+            }
+            else {
+                vector<double> values;
+                for ( rapidjson::SizeType it = 0; it < parameter.Size();
+                      it++ ) {
+                    values.push_back(parameter[it].GetDouble());
+                }
+                addValues(name, values);
+            }
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+    }
+
+    try {
+        checkMethod();
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+}
+
+// Numeric input parameter, sampled once
+static const TechnologyField*
+findSampledField(const string& name,
+                 const vector<SampledParameter>& sampledParameters)
+{
+    const TechnologyField* field = TechnologyValues::findField(name);
+    if ( field == NULL || field->isString ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Sampling of \"");
+        exceptionMsgThrown.append(name);
+        exceptionMsgThrown.append("\", which is no numeric input ");
+        exceptionMsgThrown.append("parameter.\n");
+        throw exceptionMsgThrown;
+    }
+    for ( unsigned int it = 0; it < sampledParameters.size(); it++ ) {
+        if ( sampledParameters[it].field == field ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("\"");
+            exceptionMsgThrown.append(name);
+            exceptionMsgThrown.append("\" is sampled twice.\n");
+            throw exceptionMsgThrown;
+        }
+    }
+    return field;
+}
+
+void
+DesignSampler::addRange(const string& name, double minimum, double maximum)
+{
+    SampledParameter parameter;
+    try {
+        parameter.field = findSampledField(name, sampledParameters);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+    if ( minimum > maximum ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Range of \"");
+        exceptionMsgThrown.append(name);
+        exceptionMsgThrown.append("\" must not end below its start.\n");
+        throw exceptionMsgThrown;
+    }
+
+    parameter.isRange = !isDiscreteField(name);
+    parameter.isInteger = parameter.isRange && parameter.field->isInteger;
+    parameter.minimum = minimum;
+    parameter.maximum = maximum;
+    if ( parameter.isInteger ) {
+        parameter.minimum = ceil(minimum);
+        parameter.maximum = floor(maximum);
+    }
+    else if ( !parameter.isRange ) {
+        parameter.values = allowedValuesIn(name, minimum, maximum);
+    }
+    if ( parameter.minimum > parameter.maximum
+         || ( !parameter.isRange && parameter.values.empty() ) ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Range of \"");
+        exceptionMsgThrown.append(name);
+        exceptionMsgThrown.append("\" holds no value which the model ");
+        exceptionMsgThrown.append("allows.\n");
+        throw exceptionMsgThrown;
+    }
+
+    appendParameter(parameter);
+}
+
+void
+DesignSampler::addValues(const string& name, const vector<double>& values)
+{
+    SampledParameter parameter;
+    try {
+        parameter.field = findSampledField(name, sampledParameters);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+    if ( values.empty() ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("List of values of \"");
+        exceptionMsgThrown.append(name);
+        exceptionMsgThrown.append("\" must not be empty.\n");
+        throw exceptionMsgThrown;
+    }
+    for ( unsigned int it = 0; it < values.size(); it++ ) {
+        if ( !isAllowedValue(parameter.field, values[it]) ) {
+            char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+            shortestDoubleToString(values[it], buffer);
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Value ");
+            exceptionMsgThrown.append(buffer);
+            exceptionMsgThrown.append(" of \"");
+            exceptionMsgThrown.append(name);
+            exceptionMsgThrown.append("\" is not allowed by the model.\n");
+            throw exceptionMsgThrown;
+        }
+    }
+
+    parameter.isRange = false;
+    parameter.isInteger = false;
+    parameter.values = values;
+    sort(parameter.values.begin(), parameter.values.end());
+    parameter.values.erase(unique(parameter.values.begin(),
+                                  parameter.values.end()),
+                           parameter.values.end());
+    parameter.minimum = parameter.values.front();
+    parameter.maximum = parameter.values.back();
+
+    appendParameter(parameter);
+}
+
+void
+DesignSampler::appendParameter(const SampledParameter& parameter)
+{
+    sampledParameters.push_back(parameter);
+    isBankPlacementSampled |= isBankPlacementField(parameter.field->name);
+
+    assignmentOrder.push_back(sampledParameters.size() - 1);
+    stable_sort(assignmentOrder.begin(), assignmentOrder.end(),
+                [this](unsigned int first, unsigned int second)
+                { return assignmentRank(sampledParameters[first].field->name)
+                         < assignmentRank(
+                                sampledParameters[second].field->name); });
+}
+
+void
+DesignSampler::checkMethod() const
+{
+    if ( method == SOBOL && sampledParameters.size() > maxSobolParameters ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Sobol points have at most ");
+        exceptionMsgThrown.append(to_string(maxSobolParameters));
+        exceptionMsgThrown.append(" parameters.\n");
+        throw exceptionMsgThrown;
+    }
+    if ( nSamples > UINT32_MAX ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("A sample has at most ");
+        exceptionMsgThrown.append(to_string(UINT32_MAX));
+        exceptionMsgThrown.append(" points.\n");
+        throw exceptionMsgThrown;
+    }
+}
+
+// nStrata^nParameters, or limit + 1 if that is more
+static uint64_t
+cellCount(uint64_t nStrata, unsigned int nParameters, uint64_t limit)
+{
+    uint64_t nCells = 1;
+    for ( unsigned int it = 0; it < nParameters; it++ ) {
+        nCells *= nStrata;
+        if ( nCells > limit ) {
+            return limit + 1;
+        }
+    }
+    return nCells;
+}
+
+void
+DesignSampler::unitPoint(unsigned long pointIndex,
+                         vector<double>& coordinates) const
+{
+    unsigned int nParameters = sampledParameters.size();
+    coordinates.resize(nParameters);
+
+    if ( method == SOBOL ) {
+        for ( unsigned int it = 0; it < nParameters; it++ ) {
+            coordinates[it] = sobolCoordinate(pointIndex, it);
+        }
+        return;
+    }
+
+    if ( method == LATIN_HYPERCUBE ) {
+        // Each parameter goes through the strata in its own order
+        for ( unsigned int it = 0; it < nParameters; it++ ) {
+            uint32_t stratum = permute(pointIndex, nSamples,
+                                       permutationKey(seed, it));
+            coordinates[it] = ( stratum
+                                + MonteCarloSimulator::counterUniform(
+                                        seed, pointIndex, it) )
+                              / nSamples;
+        }
+        return;
+    }
+
+    // Largest grid which the points fill: nStrata^nParameters cells
+    uint32_t nStrata = 1;
+    if ( nParameters > 0 ) {
+        nStrata = max(1.0, floor(pow(nSamples, 1.0 / nParameters)));
+        while ( nStrata > 1
+                && cellCount(nStrata, nParameters, nSamples) > nSamples ) {
+            nStrata--;
+        }
+        while ( cellCount(nStrata + 1, nParameters, nSamples) <= nSamples ) {
+            nStrata++;
+        }
+    }
+    uint32_t nCells = cellCount(nStrata, nParameters, nSamples);
+    // Each round of nCells points visits the cells in its own order, so
+    //  the points of an incomplete last round spread over the grid
+    unsigned long round = pointIndex / nCells;
+    uint32_t cell = permute(pointIndex % nCells, nCells,
+                            permutationKey(seed, round));
+    for ( unsigned int it = 0; it < nParameters; it++ ) {
+        coordinates[it] = ( cell % nStrata
+                            + MonteCarloSimulator::counterUniform(
+                                    seed, pointIndex, it) )
+                          / nStrata;
+        cell /= nStrata;
+    }
+}
+
+bool
+DesignSampler::point(unsigned long pointIndex, TechnologyValues& inputs,
+                     string& rejectionMessage) const
+{
+    vector<double> coordinates;
+    unitPoint(pointIndex, coordinates);
+
+    inputs = baseInputs;
+    if ( isBankPlacementSampled ) {
+        // Directions which are not sampled follow from the sampled ones
+        for ( unsigned int it = 0; it < 2; it++ ) {
+            const char* name = it == 0 ? verticalBanksField
+                                       : horizontalBanksField;
+            const TechnologyField* field = TechnologyValues::findField(name);
+            bool isSampled = false;
+            for ( unsigned int parameterID = 0;
+                  parameterID < sampledParameters.size(); parameterID++ ) {
+                isSampled |= sampledParameters[parameterID].field == field;
+            }
+            if ( !isSampled ) {
+                field->setNumber(inputs, INVALID_VALUE);
+            }
+        }
+    }
+
+    vector<double> fittingValues;
+    for ( unsigned int order = 0; order < assignmentOrder.size(); order++ ) {
+        const SampledParameter& parameter
+                = sampledParameters[assignmentOrder[order]];
+        double coordinate = coordinates[assignmentOrder[order]];
+        double value;
+        if ( parameter.isRange && parameter.isInteger ) {
+            double nValues = parameter.maximum - parameter.minimum + 1;
+            value = parameter.minimum
+                    + min(floor(coordinate * nValues), nValues - 1);
+        }
+        else if ( parameter.isRange ) {
+            value = parameter.minimum
+                    + coordinate * (parameter.maximum - parameter.minimum);
+        }
+        else {
+            fittingValues.clear();
+            for ( unsigned int it = 0; it < parameter.values.size(); it++ ) {
+                if ( fitsOtherParameters(parameter.field->name,
+                                         parameter.values[it], inputs) ) {
+                    fittingValues.push_back(parameter.values[it]);
+                }
+            }
+            if ( fittingValues.empty() ) {
+                rejectionMessage = "[ERROR] No value of \"";
+                rejectionMessage.append(parameter.field->name);
+                rejectionMessage.append("\" fits the other parameters ");
+                rejectionMessage.append("of the point.\n");
+                return false;
+            }
+            unsigned int valueID = min<unsigned int>(
+                                        coordinate * fittingValues.size(),
+                                        fittingValues.size() - 1);
+            value = fittingValues[valueID];
+        }
+        parameter.field->setNumber(inputs, value);
+    }
+    return true;
+}
+
+void
+DesignSampler::sample(ostream& pointFile)
+{
+    try {
+        checkMethod();
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+    nRejected = 0;
+    firstRejectionMessage.clear();
+
+    pointFile << "Point";
+    for ( unsigned int it = 0; it < sampledParameters.size(); it++ ) {
+        pointFile << "," << sampledParameters[it].field->name;
+    }
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        pointFile << "," << DramResult::names[valueID];
+    }
+    pointFile << "\n";
+
+    BatchEvaluator evaluator(nJobs);
+    vector<TechnologyValues> batch;
+    vector<string> rejectionMessages(batchSize);
+    vector<DramResult> results;
+    vector<string> errors;
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+    for ( unsigned long first = 0; first < nSamples; first += batchSize ) {
+        unsigned long last = min<unsigned long>(first + batchSize, nSamples);
+        batch.clear();
+        for ( unsigned long pointIndex = first; pointIndex < last;
+              pointIndex++ ) {
+            TechnologyValues inputs;
+            string& rejectionMessage = rejectionMessages[pointIndex - first];
+            rejectionMessage.clear();
+            if ( point(pointIndex, inputs, rejectionMessage) ) {
+                batch.push_back(inputs);
+            }
+        }
+        evaluator.evaluate(batch, IOTerminationCurrentFlag, results, errors);
+
+        // Rejections and results in point order
+        unsigned int evaluated = 0;
+        for ( unsigned long pointIndex = first; pointIndex < last;
+              pointIndex++ ) {
+            const string& pointMessage = rejectionMessages[pointIndex - first];
+            bool isEvaluated = pointMessage.empty();
+            unsigned int batchID = evaluated;
+            const string& rejectionMessage = isEvaluated ? errors[batchID]
+                                                         : pointMessage;
+            if ( isEvaluated ) {
+                evaluated++;
+            }
+            if ( !rejectionMessage.empty() ) {
+                if ( nRejected++ == 0 ) {
+                    firstRejectionMessage = rejectionMessage;
+                }
+                continue;
+            }
+
+            pointFile << pointIndex;
+            for ( unsigned int it = 0; it < sampledParameters.size(); it++ ) {
+                shortestDoubleToString(
+                    sampledParameters[it].field->getNumber(batch[batchID]),
+                    buffer);
+                pointFile << "," << buffer;
+            }
+            for ( int valueID = 0; valueID < DramResult::N_VALUES;
+                  valueID++ ) {
+                shortestDoubleToString(results[batchID].values[valueID],
+                                       buffer);
+                pointFile << "," << buffer;
+            }
+            pointFile << "\n";
+        }
+    }
+}
+
+void
+DesignSampler::printStatistics(ostream& output) const
+{
+    const char* methodName = method == SOBOL ? "Sobol"
+                             : method == LATIN_HYPERCUBE ? "Latin hypercube"
+                             : "stratified";
+    output << nSamples << " " << methodName << " points of "
+           << sampledParameters.size() << " parameters, " << nRejected
+           << " rejected" << endl;
+    if ( nRejected > 0 ) {
+        output << "First rejection: " << firstRejectionMessage;
+        if ( firstRejectionMessage[firstRejectionMessage.size()-1] != '\n' ) {
+            output << endl;
+        }
+    }
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef DESIGNSAMPLER_H
+#define DESIGNSAMPLER_H
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <cstdint>
+
+#include "TechnologyValues.h"
+#include "DramResult.h"
+
+using namespace std;
+
+// Input parameter of a design-space sample: a range or a list of values
+struct SampledParameter
+{
+    const TechnologyField* field;
+    // Values in the range of a continuous parameter, or integers in the
+    //  range of a count
+    bool isRange;
+    bool isInteger;
+    double minimum;
+    double maximum;
+    // Otherwise the values, in increasing order
+    vector<double> values;
+};
+
+// Points over ranges of input parameters around a base configuration,
+//  each evaluated (-sample <specification>):
+//   {
+//     "technology": "<technology file>",
+//     "architecture": "<architecture file>",
+//     "method": "sobol",
+//     "samples": 1024,
+//     "seed": 1,
+//     "parameters": {
+//       "CellWidth[um]": { "minimum": 0.09, "maximum": 0.11 },
+//       "TilesPerBank[]": { "minimum": 1, "maximum": 4 },
+//       "PageSpanningFactor[]": [0.5, 1]
+//     }
+//   }
+// "method" is "sobol" (the Sobol sequence, at most maxSobolParameters
+//  parameters), "latin" (a Latin hypercube: every parameter has one point
+//  in each of samples equal strata) or "stratified" (one point in each cell
+//  of a grid of equal strata, as many cells as the samples allow).
+// A range of a parameter which the model only takes from a few values
+//  (tiles per bank, banks and their directions, page spanning factor)
+//  stands for the allowed values in it, and a range of a count for the
+//  integers in it. A point takes a value out of the ones which the
+//  values of its other parameters allow (e.g. no page spanning factor
+//  below 1 / tiles per bank). A bank direction which is not sampled is
+//  left to the model when the banks or the other direction are sampled.
+// Points are made from their index when they are evaluated, in batches on
+//  several threads, and written in point order, so the results do not
+//  depend on the number of threads.
+class DesignSampler
+{
+public:
+    enum Method { SOBOL, LATIN_HYPERCUBE, STRATIFIED };
+
+    DesignSampler(bool IOTerminationCurrentFlag, unsigned int nJobs);
+
+    void readSpecification(const string& specificationFileName);
+
+    void addRange(const string& name, double minimum, double maximum);
+    void addValues(const string& name, const vector<double>& values);
+
+    // Coordinates in [0, 1) of a point, one per parameter
+    void unitPoint(unsigned long pointIndex,
+                   vector<double>& coordinates) const;
+    // Input parameters of a point, false (and why) if the other
+    //  parameters leave a parameter no value
+    bool point(unsigned long pointIndex, TechnologyValues& inputs,
+               string& rejectionMessage) const;
+
+    // Evaluates the points and writes their parameters and results
+    void sample(ostream& pointFile);
+    void printStatistics(ostream& output) const;
+
+    const vector<SampledParameter>& parameters() const
+        { return sampledParameters; }
+
+    // Coordinate of a point of the Sobol sequence (Joe-Kuo direction
+    //  numbers), which does not depend on the seed
+    static double sobolCoordinate(uint32_t pointIndex,
+                                  unsigned int dimension);
+    // Permutation of 0 .. length-1 given by the key (Kensler's hash with
+    //  cycle walking)
+    static uint32_t permute(uint32_t index, uint32_t length, uint32_t key);
+
+    // Base configuration, -D overrides are applied by the caller
+    TechnologyValues baseInputs;
+
+    Method method;
+    unsigned long nSamples;
+    uint64_t seed;
+    // Points which the model rejects, or whose parameters do not fit
+    unsigned long nRejected;
+    // First reason of a rejection
+    string firstRejectionMessage;
+
+    static const unsigned int maxSobolParameters = 21;
+    // Points evaluated at once
+    static const unsigned int batchSize = 1024;
+
+private:
+    void appendParameter(const SampledParameter& parameter);
+    void checkMethod() const;
+    static bool isAllowedValue(const TechnologyField* field, double value);
+
+    bool IOTerminationCurrentFlag;
+    unsigned int nJobs;
+    vector<SampledParameter> sampledParameters;
+
+    // Parameters in the order in which their values are chosen (a value
+    //  which limits another one first)
+    vector<unsigned int> assignmentOrder;
+    bool isBankPlacementSampled;
+};
+
+#endif // DESIGNSAMPLER_H
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "DramResult.h"
+#include "../core/Dual.h"
+#include "../core/Interval.h"
+
+const char* const DramResult::labels[DramResult::N_VALUES] = {
+    "DRAM frequency       [MHz]",
+    "Core frequency       [MHz]",
+    "Max core frequency   [MHz]",
+
+    "tRCD                 [ns]",
+    "tCL (tCAS)           [ns]",
+    "tRAS                 [ns]",
+    "tRP                  [ns]",
+    "tRC                  [ns]",
+    "tRL                  [ns]",
+    "tRTP                 [ns]",
+    "tCCD                 [ns]",
+    "tWR                  [ns]",
+    "tRFC                 [ns]",
+    "tREFI                [ns]",
+
+    "tRCD                 [cc]",
+    "tCL (tCAS)           [cc]",
+    "Core tCL             [cc]",
+    "tRAS                 [cc]",
+    "tRP                  [cc]",
+    "tRC                  [cc]",
+    "tRL                  [cc]",
+    "Core tRL             [cc]",
+    "tRTP                 [cc]",
+    "tCCD                 [cc]",
+    "Core tCCD            [cc]",
+    "tWR                  [cc]",
+    "tRFC                 [cc]",
+    "tREFI                [cc]",
+
+    "IDD0                 [mA]",
+    "IPP0                 [mA]",
+    "IDD1                 [mA]",
+    "IPP1                 [mA]",
+    "IDD2N                [mA]",
+    "IDD3N                [mA]",
+    "IPP3N                [mA]",
+    "Rho                  []  ",
+    "IDD4R                [mA]",
+    "IDD4W                [mA]",
+    "IDD5B                [mA]",
+    "IPP5B                [mA]",
+
+    "Subarray height      [um]",
+    "Subarray width       [um]",
+    "Tile height          [um]",
+    "Tile width           [um]",
+    "Bank height          [um]",
+    "Bank width           [um]",
+    "Channel height       [um]",
+    "Channel width        [um]",
+    "Channel area       [(mm)^2]"
+};
+
+const char* const DramResult::names[DramResult::N_VALUES] = {
+    "DRAMFrequency[MHz]",
+    "CoreFrequency[MHz]",
+    "MaxCoreFrequency[MHz]",
+
+    "tRCD[ns]",
+    "tCL[ns]",
+    "tRAS[ns]",
+    "tRP[ns]",
+    "tRC[ns]",
+    "tRL[ns]",
+    "tRTP[ns]",
+    "tCCD[ns]",
+    "tWR[ns]",
+    "tRFC[ns]",
+    "tREFI[ns]",
+
+    "tRCD[cc]",
+    "tCL[cc]",
+    "CoretCL[cc]",
+    "tRAS[cc]",
+    "tRP[cc]",
+    "tRC[cc]",
+    "tRL[cc]",
+    "CoretRL[cc]",
+    "tRTP[cc]",
+    "tCCD[cc]",
+    "CoretCCD[cc]",
+    "tWR[cc]",
+    "tRFC[cc]",
+    "tREFI[cc]",
+
+    "IDD0[mA]",
+    "IPP0[mA]",
+    "IDD1[mA]",
+    "IPP1[mA]",
+    "IDD2N[mA]",
+    "IDD3N[mA]",
+    "IPP3N[mA]",
+    "Rho[]",
+    "IDD4R[mA]",
+    "IDD4W[mA]",
+    "IDD5B[mA]",
+    "IPP5B[mA]",
+
+    "SubarrayHeight[um]",
+    "SubarrayWidth[um]",
+    "TileHeight[um]",
+    "TileWidth[um]",
+    "BankHeight[um]",
+    "BankWidth[um]",
+    "ChannelHeight[um]",
+    "ChannelWidth[um]",
+    "ChannelArea[mm^2]"
+};
+
+int
+DramResult::findValue(const string& name)
+{
+    for ( int valueID = 0; valueID < N_VALUES; valueID++ ) {
+        if ( name == names[valueID] ) {
+            return valueID;
+        }
+    }
+    return -1;
+}
+
+DramResult::DramResult()
+{
+    configID = 0;
+    technologyFileName = "";
+    architectureFileName = "";
+    warning = "";
+    for ( int valueID = 0; valueID < N_VALUES; valueID++ ) {
+        values[valueID] = 0;
+    }
+    inputKey = "";
+    wasEvaluated = true;
+}
+
+template<typename Scalar>
+void
+DramResult::collectValues(const BasicCurrent<Scalar>& dram, Scalar* values)
+{
+    values[DRAM_FREQ]       = dram.dramFreq.value();
+    values[CORE_FREQ]       = dram.dramCoreFreq.value();
+    values[MAX_CORE_FREQ]   = dram.maxCoreFreq.value();
+
+    values[TRCD]            = dram.trcd.value();
+    values[TCAS]            = dram.tcas.value();
+    values[TRAS]            = dram.tras.value();
+    values[TRP]             = dram.trp.value();
+    values[TRC]             = dram.trc.value();
+    values[TRL]             = dram.trl.value();
+    values[TRTP]            = dram.trtp.value();
+    values[TCCD]            = dram.tccd.value();
+    values[TWR]             = dram.twr.value();
+    values[TRFC]            = dram.trfc.value();
+    values[TREFI]           = dram.trefI.value();
+
+    values[TRCD_CLK]        = dram.trcd_clk.value();
+    values[TCAS_CLK]        = dram.tcas_clk.value();
+    values[TCAS_CORE_CLK]   = dram.tcas_coreClk.value();
+    values[TRAS_CLK]        = dram.tras_clk.value();
+    values[TRP_CLK]         = dram.trp_clk.value();
+    values[TRC_CLK]         = dram.trc_clk.value();
+    values[TRL_CLK]         = dram.trl_clk.value();
+    values[TRL_CORE_CLK]    = dram.trl_coreClk.value();
+    values[TRTP_CLK]        = dram.trtp_clk.value();
+    values[TCCD_CLK]        = dram.tccd_clk.value();
+    values[TCCD_CORE_CLK]   = dram.tccd_coreClk.value();
+    values[TWR_CLK]         = dram.twr_clk.value();
+    values[TRFC_CLK]        = dram.trfc_clk.value();
+    values[TREFI_CLK]       = dram.trefI_clk.value();
+
+    values[IDD0]            = dram.IDD0.value();
+    values[IPP0]            = dram.IPP0.value();
+    values[IDD1]            = dram.IDD1.value();
+    values[IPP1]            = dram.IPP1.value();
+    values[IDD2N]           = dram.IDD2n.value();
+    values[IDD3N]           = dram.IDD3n.value();
+    values[IPP3N]           = dram.IPP3n.value();
+    values[RHO]             = dram.rho;
+    values[IDD4R]           = dram.IDD4R.value();
+    values[IDD4W]           = dram.IDD4W.value();
+    values[IDD5B]           = dram.IDD5b.value();
+    values[IPP5B]           = dram.IPP5b.value();
+
+    values[SUBARRAY_HEIGHT] = dram.subArrayHeight.value();
+    values[SUBARRAY_WIDTH]  = dram.subArrayWidth.value();
+    values[TILE_HEIGHT]     = dram.tileHeight.value();
+    values[TILE_WIDTH]      = dram.tileWidth.value();
+    values[BANK_HEIGHT]     = dram.bankHeight.value();
+    values[BANK_WIDTH]      = dram.bankWidth.value();
+    values[CHANNEL_HEIGHT]  = dram.channelHeight.value();
+    values[CHANNEL_WIDTH]   = dram.channelWidth.value();
+    values[CHANNEL_AREA]    = dram.channelArea.value();
+}
+
+void
+DramResult::collect(const Current& dram)
+{
+    collectValues(dram, values);
+
+    warning = dram.warning;
+}
+
+template void DramResult::collectValues(const BasicCurrent<double>& dram,
+                                         double* values);
+template void DramResult::collectValues(const BasicCurrent<Dual>& dram,
+                                         Dual* values);
+template void DramResult::collectValues(const BasicCurrent<Interval>& dram,
+                                         Interval* values);
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef DRAMRESULT_H
+#define DRAMRESULT_H
+
+#include <string>
+
+#include "../core/Current.h"
+
+using namespace std;
+
+// Plain record of the published results of one DRAM configuration.
+// It holds no reference to the model objects, so it can be handed over
+//  to the output stage once the configuration has been evaluated.
+class DramResult
+{
+public:
+    // Published values, in output order
+    enum ValueID {
+        DRAM_FREQ, CORE_FREQ, MAX_CORE_FREQ,
+
+        TRCD, TCAS, TRAS, TRP, TRC, TRL, TRTP, TCCD, TWR, TRFC, TREFI,
+
+        TRCD_CLK, TCAS_CLK, TCAS_CORE_CLK, TRAS_CLK, TRP_CLK, TRC_CLK,
+        TRL_CLK, TRL_CORE_CLK, TRTP_CLK, TCCD_CLK, TCCD_CORE_CLK,
+        TWR_CLK, TRFC_CLK, TREFI_CLK,
+
+        IDD0, IPP0, IDD1, IPP1, IDD2N, IDD3N, IPP3N, RHO,
+        IDD4R, IDD4W, IDD5B, IPP5B,
+
+        SUBARRAY_HEIGHT, SUBARRAY_WIDTH, TILE_HEIGHT, TILE_WIDTH,
+        BANK_HEIGHT, BANK_WIDTH, CHANNEL_HEIGHT, CHANNEL_WIDTH, CHANNEL_AREA,
+
+        N_VALUES
+    };
+
+    // Labels used in the csv and stdout tables
+    static const char* const labels[N_VALUES];
+    // Names used in machine readable output, in the style of the
+    //  input parameters (name[unit])
+    static const char* const names[N_VALUES];
+    // ValueID of a name, -1 if there is no value of that name
+    static int findValue(const string& name);
+
+    DramResult();
+
+    void collect(const Current& dram);
+
+    // Published values of a model evaluated on Scalar numbers
+    template<typename Scalar>
+    static void collectValues(const BasicCurrent<Scalar>& dram,
+                              Scalar* values);
+
+    unsigned int configID;
+    string technologyFileName;
+    string architectureFileName;
+    string warning;
+    double values[N_VALUES];
+
+    // Canonical text of all effective inputs (see ResultCache)
+    string inputKey;
+    // False if the values were reused instead of evaluated
+    bool wasEvaluated;
+};
+
+#endif // DRAMRESULT_H
@@ -47,230 +47,6 @@ DRAMSpec::DRAMSpec(int argc, char** argv)
     runDramSpec(argc, argv);
 }
 
-//function for writing results in json
-void
-DRAMSpec::jsonOutputWrite(int dramConfigID)
-{
-    //parsing the timing results in ns
-    rapidjson::Document timingnsdoc;
-    timingnsdoc.SetObject();
-
-    timingnsdoc.AddMember(
-          "trcd",   dram->trcd.value(),   timingnsdoc.GetAllocator());
-    timingnsdoc.AddMember(
-          "tcl",    dram->tcas.value(),   timingnsdoc.GetAllocator());
-    timingnsdoc.AddMember(
-          "tras",   dram->tras.value(),   timingnsdoc.GetAllocator());
-    timingnsdoc.AddMember(
-          "trp",    dram->trp.value(),    timingnsdoc.GetAllocator());
-    timingnsdoc.AddMember(
-          "trc",    dram->trc.value(),    timingnsdoc.GetAllocator());
-    timingnsdoc.AddMember(
-          "trl",    dram->trl.value(),    timingnsdoc.GetAllocator());
-    timingnsdoc.AddMember(
-          "trtp",   dram->trtp.value(),   timingnsdoc.GetAllocator());
-    timingnsdoc.AddMember(
-          "tccd",   dram->tccd.value(),   timingnsdoc.GetAllocator());
-    timingnsdoc.AddMember(
-          "twr",    dram->twr.value(),    timingnsdoc.GetAllocator());
-    timingnsdoc.AddMember(
-          "trfc",   dram->trfc.value(),   timingnsdoc.GetAllocator());
-    timingnsdoc.AddMember(
-          "trefI",  dram->trefI.value(),  timingnsdoc.GetAllocator());
-
-    // Convert JSON document to string
-    rapidjson::GenericStringBuffer< rapidjson::UTF8<> > timingnsbuffer;
-    rapidjson::Writer< rapidjson::GenericStringBuffer<
-    rapidjson::UTF8<> > > timingnswriter(timingnsbuffer);
-    timingnsdoc.Accept(timingnswriter);
-    const char* timingnsstr = timingnsbuffer.GetString();
-
-    //open a file
-    stringstream timingnsresstr;
-    timingnsresstr << string("timingnsresult_")
-                   << dramConfigID
-                   << string(".json");
-    ofstream timingnsresultfile(timingnsresstr.str().c_str());
-    timingnsresultfile << timingnsstr;
-    timingnsresultfile.close();
-
-    //parsing the timing results in clock cycles
-    rapidjson::Document timingsDoc;
-    timingsDoc.SetObject();
-
-    timingsDoc.AddMember(
-          "Frequency",  dram->dramFreq.value(),   timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "trcd_cc",    dram->trcd_clk.value() ,  timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "tcl_cc",     dram->tcas_clk.value() ,  timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "tras_cc",    dram->tras_clk.value() ,  timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "trp_cc",     dram->trp_clk.value() ,   timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "trc_cc",     dram->trc_clk.value() ,   timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "trl_cc",     dram->trl_clk.value() ,   timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "twl_cc",     dram->twl_clk.value() ,   timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "trtp_cc",    dram->trtp_clk.value() ,  timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "tccd_cc",    dram->tccd_clk.value() ,  timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "twr_cc",     dram->twr_clk.value() ,   timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "trfc_cc",    dram->trfc_clk.value() ,  timingsDoc.GetAllocator());
-    timingsDoc.AddMember(
-          "trefI_cc",   dram->trefI_clk.value() , timingsDoc.GetAllocator());
-
-    // Convert JSON document to string
-    rapidjson::GenericStringBuffer< rapidjson::UTF8<> > timingbuffer;
-    rapidjson::Writer< rapidjson::GenericStringBuffer<
-    rapidjson::UTF8<> > > timingwriter(timingbuffer);
-    timingsDoc.Accept(timingwriter);
-    const char* timingstr = timingbuffer.GetString();
-
-    //Placing timing results (in clock cycles) in different files according to file number
-    stringstream timingresstr;
-    timingresstr << string("timingresult_")
-                 << dramConfigID
-                 << string(".json");
-    ofstream timingresultfile(timingresstr.str().c_str());
-    timingresultfile << timingstr;
-    timingresultfile.close();
-
-    //parsing the currents
-    rapidjson::Document currentdoc;
-    currentdoc.SetObject();
-
-    currentdoc.AddMember(
-          "IDD0",   dram->IDD0.value(),   currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "IPP0",   dram->IPP0.value(),   currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "IDD1",   dram->IDD1.value(),   currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "IPP1",   dram->IPP0.value(),   currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "IDD4R",  dram->IDD4R.value(),  currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "IDD4W",  dram->IDD4W.value(),  currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "IDD2n",  dram->IDD2n.value(),  currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "IDD3n",  dram->IDD3n.value(),  currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "IPP3n",  dram->IPP3n.value(),  currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "Rho",    dram->rho,            currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "IDD5B",  dram->IDD5b.value(),  currentdoc.GetAllocator());
-    currentdoc.AddMember(
-          "IPP5B",  dram->IPP5b.value(),  currentdoc.GetAllocator());
-
-    //convert JSON document to string
-    rapidjson::GenericStringBuffer< rapidjson::UTF8<> > currentbuffer;
-    rapidjson::Writer< rapidjson::GenericStringBuffer
-    < rapidjson::UTF8<> > > currentwriter(currentbuffer);
-    currentdoc.Accept(currentwriter);
-    const char* currentstr = currentbuffer.GetString();
-
-    //Placing current results in different files according to file number
-    stringstream currentresstr;
-    currentresstr << string("currentresult_")
-                  << dramConfigID
-                  << string(".json");
-    ofstream currentresultfile(currentresstr.str().c_str());
-    currentresultfile << currentstr;
-    currentresultfile.close();
-}
-
-//function for writing results in csv file or cout
-string
-DRAMSpec::arrangeOutput(const string outputType)
-{
-    int lineWidth;
-    string separator;
-    // If outputing to csv file, keep the lines as short as possible
-    //  and add a comma separator between label and value
-    if (outputType == "csv") {
-        lineWidth = 0;
-        separator = ",";
-    }
-    // If outputing to terminal, build a more human readable table
-    else if (outputType == "stdout") {
-        lineWidth = 30;
-        separator = "";
-    } else {
-        std::string exceptionMsgThrown("[ERROR] ");
-        exceptionMsgThrown.append("Unexpected behaviour - ");
-        exceptionMsgThrown.append("could not decide on output type.");
-        throw exceptionMsgThrown;
-    }
-
-    ostringstream resultTable;
-
-    resultTable
-    << BUILD_LINE("DRAM frequency       [MHz]",   dram->dramFreq.value())
-    << BUILD_LINE("Core frequency       [MHz]",   dram->dramCoreFreq.value())
-    << BUILD_LINE("Max core frequency   [MHz]",   dram->maxCoreFreq.value())
-
-    << BUILD_LINE("tRCD                 [ns]",    dram->trcd.value())
-    << BUILD_LINE("tCL (tCAS)           [ns]",    dram->tcas.value())
-    << BUILD_LINE("tRAS                 [ns]",    dram->tras.value())
-    << BUILD_LINE("tRP                  [ns]",    dram->trp.value())
-    << BUILD_LINE("tRC                  [ns]",    dram->trc.value())
-    << BUILD_LINE("tRL                  [ns]",    dram->trl.value())
-    << BUILD_LINE("tRTP                 [ns]",    dram->trtp.value())
-    << BUILD_LINE("tCCD                 [ns]",    dram->tccd.value())
-    << BUILD_LINE("tWR                  [ns]",    dram->twr.value())
-    << BUILD_LINE("tRFC                 [ns]",    dram->trfc.value())
-    << BUILD_LINE("tREFI                [ns]",    dram->trefI.value())
-
-    << BUILD_LINE("tRCD                 [cc]",    dram->trcd_clk.value())
-    << BUILD_LINE("tCL (tCAS)           [cc]",    dram->tcas_clk.value())
-    << BUILD_LINE("Core tCL             [cc]",    dram->tcas_coreClk.value())
-    << BUILD_LINE("tRAS                 [cc]",    dram->tras_clk.value())
-    << BUILD_LINE("tRP                  [cc]",    dram->trp_clk.value())
-    << BUILD_LINE("tRC                  [cc]",    dram->trc_clk.value())
-    << BUILD_LINE("tRL                  [cc]",    dram->trl_clk.value())
-    << BUILD_LINE("Core tRL             [cc]",    dram->trl_coreClk.value())
-    << BUILD_LINE("tRTP                 [cc]",    dram->trtp_clk.value())
-    << BUILD_LINE("tCCD                 [cc]",    dram->tccd_clk.value())
-    << BUILD_LINE("Core tCCD            [cc]",    dram->tccd_coreClk.value())
-    << BUILD_LINE("tWR                  [cc]",    dram->twr_clk.value())
-    << BUILD_LINE("tRFC                 [cc]",    dram->trfc_clk.value())
-    << BUILD_LINE("tREFI                [cc]",    dram->trefI_clk.value())
-
-    << BUILD_LINE("IDD0                 [mA]",    dram->IDD0.value())
-    << BUILD_LINE("IPP0                 [mA]",    dram->IPP0.value())
-    << BUILD_LINE("IDD1                 [mA]",    dram->IDD1.value())
-    << BUILD_LINE("IPP1                 [mA]",    dram->IPP1.value())
-    << BUILD_LINE("IDD2N                [mA]",    dram->IDD2n.value())
-    << BUILD_LINE("IDD3N                [mA]",    dram->IDD3n.value())
-    << BUILD_LINE("IPP3N                [mA]",    dram->IPP3n.value())
-    << BUILD_LINE("Rho                  []  ",    dram->rho)
-    << BUILD_LINE("IDD4R                [mA]",    dram->IDD4R.value())
-    << BUILD_LINE("IDD4W                [mA]",    dram->IDD4W.value())
-    << BUILD_LINE("IDD5B                [mA]",    dram->IDD5b.value())
-    << BUILD_LINE("IPP5B                [mA]",    dram->IPP5b.value())
-
-    << BUILD_LINE("Subarray height      [um]",    dram->subArrayHeight.value())
-    << BUILD_LINE("Subarray width       [um]",    dram->subArrayWidth.value())
-    << BUILD_LINE("Tile height          [um]",    dram->tileHeight.value())
-    << BUILD_LINE("Tile width           [um]",    dram->tileWidth.value())
-    << BUILD_LINE("Bank height          [um]",    dram->bankHeight.value())
-    << BUILD_LINE("Bank width           [um]",    dram->bankWidth.value())
-    << BUILD_LINE("Channel height       [um]",    dram->channelHeight.value())
-    << BUILD_LINE("Channel width        [um]",    dram->channelWidth.value())
-    << BUILD_LINE("Channel area       [(mm)^2]",  dram->channelArea.value())
-    ;
-
-    return resultTable.str();
-}
-
 void DRAMSpec::runDramSpec(int argc, char** argv)
 {
     arg = new ArgumentsParser(argc, argv);
@@ -286,70 +62,655 @@ void DRAMSpec::runDramSpec(int argc, char** argv)
         return;
     }
 
+    if ( !arg->mergeFileName.empty() ) {
+        mergeShards();
+        return;
+    }
+
+    if ( !arg->compileLibraryFileName.empty() ) {
+        compileTechnologyLibrary();
+        return;
+    }
+
+    if ( !arg->serveSocketPath.empty() ) {
+        serve();
+        return;
+    }
+
+    if ( arg->streamRun ) {
+        stream();
+        return;
+    }
+
+    if ( !arg->exploreFileName.empty() ) {
+        explore();
+        return;
+    }
+
+    if ( !arg->solveFileName.empty() ) {
+        solve();
+        return;
+    }
+
+    if ( !arg->subarrayFileName.empty() ) {
+        subarray();
+        return;
+    }
+
+    if ( !arg->toleranceFileName.empty() ) {
+        tolerance();
+        return;
+    }
+
+    if ( !arg->monteCarloFileName.empty() ) {
+        monteCarlo();
+        return;
+    }
+
+    if ( !arg->sobolFileName.empty() ) {
+        sobol();
+        return;
+    }
+
+    if ( !arg->sampleFileName.empty() ) {
+        sample();
+        return;
+    }
+
+    if ( arg->floorplanRun ) {
+        floorplan();
+        return;
+    }
+
+    if ( arg->sensitivityRun ) {
+        sensitivity();
+        return;
+    }
+
     output << "_______________________________________________________"
            << "_______________________________________________________"
            << "_______________________________________________________"
            << endl;
 
-    //Loop through all the corresponding inputs (arch and tech files)
-    // and fill the array to print in a clean layout
-    for(unsigned int configID = 0; configID < arg->nConfigurations; configID++)
+    RunStatistics statistics;
+    CheckpointJournal journal;
+    ResultCache cache;
+    OutputWriter writer(output, writerQueueCapacity);
+
+    // Shard table and checkpoint journal share the same base name
+    string resultFileName("results");
+    if ( arg->nShards > 1 ) {
+        resultFileName.append("_shard_");
+        resultFileName.append(to_string(arg->shardIndex));
+        resultFileName.append("_of_");
+        resultFileName.append(to_string(arg->nShards));
+    }
+
+    try {
+        // Only sharded and resumable (-resume) runs are checkpointed,
+        //  a plain run neither writes nor syncs a journal
+        if ( arg->nShards > 1 || arg->resumeRun ) {
+            string journalFileName(resultFileName + ".journal");
+            if ( arg->resumeRun ) {
+                ifstream previousJournal(journalFileName);
+                journal.load(previousJournal);
+            }
+            journal.open(journalFileName, arg->resumeRun);
+            writer.attachJournal(&journal);
+        }
+
+        if ( !arg->cacheDirectory.empty() ) {
+            cache.setDirectory(arg->cacheDirectory);
+            writer.attachCache(&cache);
+        }
+
+        if ( arg->nShards > 1 ) {
+            writer.openShardTable(resultFileName + ".csv",
+                                  arg->resumeRun ? &journal : NULL);
+        }
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+    writer.start();
+
+    // Invalid overrides are reported before anything is evaluated
+    try {
+        TechnologyValues overrideCheck;
+        applyParameterOverrides(overrideCheck);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    ConfigurationSource source(*arg);
+
+    // With a technology library, -t gives names of its technologies
+    TechnologyLibrary technologyLibrary;
+    if ( !arg->technologyLibraryFileName.empty() ) {
+        try {
+            technologyLibrary.open(arg->technologyLibraryFileName);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+    }
+
+    // Technology of the previous configuration, read (and its technology
+    //  constants derived) once for all the architectures it is run with,
+    //  e.g. a row of a cross run
+    TechnologyValues rowTechnology;
+    bool hasRowTechnology = false;
+
+    //Loop through all the corresponding inputs (arch and tech files),
+    // read one after the other from the argument lists or the manifest,
+    // the results are formatted and written by the output writer thread
+    Configuration configuration;
+    while ( true )
     {
-        ofstream csvResultFile;
-        string csvResultFileName("results_for_config_");
-        csvResultFileName.append(to_string(configID));
-        csvResultFileName.append(".csv");
-        csvResultFile.open(csvResultFileName, ofstream::trunc);
-
-        output << "DRAM Configuration: "
-               << configID+1
-               << endl;
-        output << "\tTechnology filename: "
-               << arg->technologyFileName[configID]
-               << endl;
-        output << "\tParameter filename:  "
-               << arg->architectureFileName[configID]
-               << endl;
+        try {
+            if ( !source.next(configuration) ) {
+                break;
+            }
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+        unsigned int configID = configuration.configID;
+
+        // Configurations are dealt round-robin to the shards
+        if ( configID % arg->nShards != arg->shardIndex ) {
+            continue;
+        }
+
+        if ( journal.isCompleted(configID,
+                                 configuration.technologyFileName,
+                                 configuration.architectureFileName) ) {
+            statistics.nResumedConfigurations++;
+            continue;
+        }
+
+        DramResult result;
+        result.configID = configID;
+        result.technologyFileName = configuration.technologyFileName;
+        result.architectureFileName = configuration.architectureFileName;
 
         try{
-            // Current is the last thing calculated for the dram
-            // Maybe the inheritance style should be adjusted for
-            //  intelligibility purposes
-            dram = new Current(arg->technologyFileName[configID],
-                               arg->architectureFileName[configID],
-                               arg->IOTerminationCurrentFlag);
-            output << dram->warning;
+            if ( !hasRowTechnology || rowTechnology.techFileName
+                                      != configuration.technologyFileName ) {
+                hasRowTechnology = false;
+                rowTechnology = TechnologyValues();
+                rowTechnology.techFileName = configuration.technologyFileName;
+                rowTechnology.archFileName =
+                                        configuration.architectureFileName;
+                if ( !technologyLibrary.isOpen() ) {
+                    rowTechnology.readTechnologyFile();
+                }
+                else if ( !technologyLibrary.find(
+                              configuration.technologyFileName,
+                              rowTechnology) ) {
+                    string exceptionMsgThrown("[ERROR] ");
+                    exceptionMsgThrown.append("Technology \'");
+                    exceptionMsgThrown.append(
+                                        configuration.technologyFileName);
+                    exceptionMsgThrown.append("\' is not in technology ");
+                    exceptionMsgThrown.append("library \'");
+                    exceptionMsgThrown.append(
+                                        arg->technologyLibraryFileName);
+                    exceptionMsgThrown.append("\'.\n");
+                    throw exceptionMsgThrown;
+                }
+                applyParameterOverrides(rowTechnology, TECHNOLOGY_DOCUMENT);
+                rowTechnology.deriveTechnologyConstants();
+                hasRowTechnology = true;
+            }
+            TechnologyValues inputs(rowTechnology);
+            inputs.archFileName = configuration.architectureFileName;
+            inputs.readArchitectureFile();
+            applyParameterOverrides(inputs, ARCHITECTURE_DOCUMENT);
+            result.inputKey = ResultCache::inputKey(inputs,
+                                             arg->IOTerminationCurrentFlag);
+
+            // Internal timings can only be printed out by evaluating
+            if ( !arg->printInternalTimings && cache.findInRun(result) ) {
+                result.wasEvaluated = false;
+                statistics.nRepeatedConfigurations++;
+            }
+            else if ( !arg->printInternalTimings && cache.findOnDisk(result) ) {
+                result.wasEvaluated = false;
+                cache.insertInRun(result);
+                statistics.nCacheHits++;
+            }
+            else {
+                // Current is the last thing calculated for the dram
+                // Maybe the inheritance style should be adjusted for
+                //  intelligibility purposes
+                Current dram(inputs, arg->IOTerminationCurrentFlag);
+                result.collect(dram);
+                cache.insertInRun(result);
+                statistics.nEvaluatedConfigurations++;
+
+                if (arg->printInternalTimings) {
+                    dram.printTimings();
+                }
+            }
         } catch(string exceptionMsgThrown) {
             throw exceptionMsgThrown;
         }
-        jsonOutputWrite(configID+1);
 
-        csvResultFile << "Label,"
-                      << "Technology filename: " << arg->technologyFileName[configID]
-                      << "  Parameter filename: " << arg->architectureFileName[configID]
-                      << endl;
+        writer.push(result);
+    }
+
+    try {
+        writer.finish();
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    if (arg->printRunStatistics) {
+        statistics.writerQueueCapacity = writer.queueCapacity();
+        statistics.writerQueueHighWaterMark = writer.queueHighWaterMark();
+        statistics.writerQueueStalls = writer.queueStalls();
+        statistics.print(output);
+    }
+}
+
+void DRAMSpec::applyParameterOverrides(TechnologyValues& inputs)
+{
+    try {
+        applyParameterOverrides(inputs, TECHNOLOGY_DOCUMENT);
+        applyParameterOverrides(inputs, ARCHITECTURE_DOCUMENT);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+}
+
+void DRAMSpec::applyParameterOverrides(TechnologyValues& inputs,
+                                       InputDocument document)
+{
+    for ( unsigned int it = 0; it < arg->parameterOverrides.size(); it++ ) {
+        const TechnologyField* field =
+            TechnologyValues::findField(arg->parameterOverrides[it].first);
+        // Unknown names are reported by overrideField
+        if ( field != NULL && field->document != document ) {
+            continue;
+        }
+        try {
+            inputs.overrideField(arg->parameterOverrides[it].first,
+                                 arg->parameterOverrides[it].second);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+    }
+}
+
+void DRAMSpec::mergeShards()
+{
+    ShardMerger merger;
+
+    for ( unsigned int it = 0; it < arg->mergeFileName.size(); it++ ) {
+        ifstream shardFile(arg->mergeFileName[it]);
+        if ( !shardFile.is_open() ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Could not open shard result file \'");
+            exceptionMsgThrown.append(arg->mergeFileName[it]);
+            exceptionMsgThrown.append("\'.\n");
+            throw exceptionMsgThrown;
+        }
+
+        try {
+            merger.readShard(shardFile, arg->mergeFileName[it]);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+    }
+
+    ofstream mergedFile(mergedFileName, ofstream::trunc);
+    merger.writeMerged(mergedFile);
+    mergedFile.close();
+
+    output << "Merged " << merger.nConfigurations()
+           << " configurations from " << arg->mergeFileName.size()
+           << " shard result files into " << mergedFileName
+           << endl;
+}
+
+void DRAMSpec::compileTechnologyLibrary()
+{
+    vector<string> technologyFileNames;
+    FileNameList fileNames(arg->technologyFileName);
+    string fileName;
+    unsigned int nTechnologies = 0;
+    try {
+        while ( fileNames.next(fileName) ) {
+            technologyFileNames.push_back(fileName);
+        }
+        nTechnologies = TechnologyLibrary::compile(technologyFileNames,
+                                                arg->compileLibraryFileName);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    output << "Compiled " << nTechnologies
+           << " technologies into " << arg->compileLibraryFileName
+           << endl;
+}
+
+void DRAMSpec::explore()
+{
+    ParetoExplorer explorer;
+    explorer.IOTerminationCurrentFlag = arg->IOTerminationCurrentFlag;
+    explorer.nJobs = arg->nJobs;
+
+    try {
+        explorer.readSpecification(arg->exploreFileName);
+        applyParameterOverrides(explorer.baseInputs);
+        explorer.explore();
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    ofstream frontFile(paretoFileName, ofstream::trunc);
+    explorer.writeFront(frontFile);
+    frontFile.close();
+
+    if ( explorer.isEvolutionary ) {
+        output << "Searched " << explorer.nGenerations << " generations of "
+               << explorer.populationSize << " configurations ("
+               << explorer.nEvaluated << " evaluated), "
+               << explorer.front().size() << " on the Pareto front written to "
+               << paretoFileName << endl;
+    }
+    else {
+        output << "Explored " << explorer.nGridPoints() << " configurations ("
+               << explorer.nSkipped << " skipped as dominated), "
+               << explorer.front().size() << " on the Pareto front written to "
+               << paretoFileName << endl;
+    }
+    if ( explorer.nInvalid > 0 ) {
+        output << "[WARNING] " << explorer.nInvalid
+               << " configurations are invalid, the first one: "
+               << explorer.firstInvalidMessage;
+        if ( explorer.firstInvalidMessage.empty()
+             || explorer.firstInvalidMessage[
+                    explorer.firstInvalidMessage.size()-1] != '\n' ) {
+            output << endl;
+        }
+    }
+    if (arg->printRunStatistics) {
+        explorer.printStatistics(output);
+    }
+}
+
+void DRAMSpec::solve()
+{
+    GoalSeeker seeker;
+    seeker.IOTerminationCurrentFlag = arg->IOTerminationCurrentFlag;
+
+    try {
+        seeker.readSpecification(arg->solveFileName);
+        applyParameterOverrides(seeker.baseInputs);
+        seeker.solve();
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    ofstream goalFile(goalsFileName, ofstream::trunc);
+    seeker.writeGoals(goalFile);
+    goalFile.close();
+
+    seeker.printGoals(output);
+    output << "Goals written to " << goalsFileName << endl;
+}
+
+void DRAMSpec::subarray()
+{
+    SubarraySizer sizer;
+
+    try {
+        sizer.readSpecification(arg->subarrayFileName);
+        applyParameterOverrides(sizer.baseInputs);
+        sizer.solve();
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    ofstream sizeFile(subarrayFileName, ofstream::trunc);
+    sizer.writeSizes(sizeFile);
+    sizeFile.close();
+
+    sizer.printStatistics(output);
+    output << "Smallest subarrays of each row size written to "
+           << subarrayFileName << endl;
+}
+
+void DRAMSpec::tolerance()
+{
+    ToleranceAnalyzer analyzer(arg->IOTerminationCurrentFlag);
+
+    try {
+        analyzer.readSpecification(arg->toleranceFileName);
+        applyParameterOverrides(analyzer.baseInputs);
+        analyzer.analyze();
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    ofstream boundFile(toleranceFileName, ofstream::trunc);
+    analyzer.writeBounds(boundFile);
+    boundFile.close();
+
+    analyzer.printBounds(output);
+    output << "Bounds written to " << toleranceFileName << endl;
+}
+
+void DRAMSpec::monteCarlo()
+{
+    MonteCarloSimulator simulator(arg->IOTerminationCurrentFlag, arg->nJobs);
+
+    try {
+        simulator.readSpecification(arg->monteCarloFileName);
+        applyParameterOverrides(simulator.baseInputs);
+        simulator.simulate();
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    ofstream statisticsFile(monteCarloFileName, ofstream::trunc);
+    simulator.writeStatistics(statisticsFile);
+    statisticsFile.close();
+    ofstream histogramFile(histogramFileName, ofstream::trunc);
+    simulator.writeHistograms(histogramFile);
+    histogramFile.close();
 
+    simulator.printStatistics(output);
+    output << "Statistics written to " << monteCarloFileName
+           << ", clock cycle histograms to " << histogramFileName << endl;
+}
+
+void DRAMSpec::sobol()
+{
+    SobolAnalyzer analyzer(arg->IOTerminationCurrentFlag, arg->nJobs);
+
+    try {
+        analyzer.readSpecification(arg->sobolFileName);
+        applyParameterOverrides(analyzer.baseInputs);
+        analyzer.analyze();
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    ofstream indexFile(sobolFileName, ofstream::trunc);
+    analyzer.writeIndices(indexFile);
+    indexFile.close();
+
+    analyzer.printIndices(output);
+    output << "Indices written to " << sobolFileName << endl;
+}
+
+void DRAMSpec::sample()
+{
+    DesignSampler sampler(arg->IOTerminationCurrentFlag, arg->nJobs);
+
+    try {
+        sampler.readSpecification(arg->sampleFileName);
+        applyParameterOverrides(sampler.baseInputs);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    // Points are written while they are evaluated
+    ofstream pointFile(sampleFileName, ofstream::trunc);
+    try {
+        sampler.sample(pointFile);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+    pointFile.close();
+
+    sampler.printStatistics(output);
+    output << "Points written to " << sampleFileName << endl;
+}
+
+void DRAMSpec::floorplan()
+{
+    // Invalid overrides are reported before anything is evaluated
+    try {
+        TechnologyValues overrideCheck;
+        applyParameterOverrides(overrideCheck);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    ConfigurationSource source(*arg);
+    FloorplanOptimizer optimizer(arg->IOTerminationCurrentFlag);
+    ofstream floorplanFile(floorplanFileName, ofstream::trunc);
+    FloorplanOptimizer::writeHeader(floorplanFile);
+
+    Configuration configuration;
+    unsigned int nConfigurations = 0;
+    while ( true )
+    {
         try {
-            csvResultFile << arrangeOutput("csv");
+            if ( !source.next(configuration) ) {
+                break;
+            }
+            TechnologyValues inputs(configuration.technologyFileName,
+                                    configuration.architectureFileName);
+            applyParameterOverrides(inputs);
+            optimizer.optimize(inputs);
         } catch(string exceptionMsgThrown) {
             throw exceptionMsgThrown;
         }
-        csvResultFile.close();
 
+        optimizer.writeBest(floorplanFile, configuration.configID,
+                            configuration.technologyFileName,
+                            configuration.architectureFileName);
+        output << "Configuration " << configuration.configID << " ("
+               << configuration.technologyFileName << ", "
+               << configuration.architectureFileName << "):" << endl;
+        optimizer.printBest(output);
+        nConfigurations++;
+    }
+    floorplanFile.close();
+
+    output << "Best placements of " << nConfigurations
+           << " configurations written to " << floorplanFileName << endl;
+}
+
+void DRAMSpec::sensitivity()
+{
+    // Invalid overrides are reported before anything is evaluated
+    try {
+        TechnologyValues overrideCheck;
+        applyParameterOverrides(overrideCheck);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    ConfigurationSource source(*arg);
+    SensitivityAnalyzer analyzer(arg->IOTerminationCurrentFlag);
+    ofstream sensitivityFile(sensitivityFileName, ofstream::trunc);
+    SensitivityAnalyzer::writeHeader(sensitivityFile);
+
+    Configuration configuration;
+    unsigned int nConfigurations = 0;
+    while ( true )
+    {
         try {
-            output << arrangeOutput("stdout") << endl;
+            if ( !source.next(configuration) ) {
+                break;
+            }
+            TechnologyValues inputs(configuration.technologyFileName,
+                                    configuration.architectureFileName);
+            applyParameterOverrides(inputs);
+            analyzer.analyze(inputs);
         } catch(string exceptionMsgThrown) {
             throw exceptionMsgThrown;
         }
 
-        if (arg->printInternalTimings) {
-            dram->printTimings();
+        analyzer.writeSensitivities(sensitivityFile, configuration.configID,
+                                    configuration.technologyFileName,
+                                    configuration.architectureFileName);
+        output << "Configuration " << configuration.configID << " ("
+               << configuration.technologyFileName << ", "
+               << configuration.architectureFileName << "), "
+               << analyzer.sensitivities().size() << " parameters, "
+               << analyzer.nEvaluations << " evaluations:" << endl;
+        analyzer.printSensitivities(output);
+        nConfigurations++;
+    }
+    sensitivityFile.close();
+
+    output << "Sensitivities of " << nConfigurations
+           << " configurations written to " << sensitivityFileName << endl;
+}
+
+void DRAMSpec::serve()
+{
+    EvaluationService service;
+    service.setDefaultIOTermination(arg->IOTerminationCurrentFlag);
+
+    try {
+        if ( !arg->cacheDirectory.empty() ) {
+            service.setCacheDirectory(arg->cacheDirectory);
         }
 
-        output  << "_______________________________________________________"
-                << "_______________________________________________________"
-                << "_______________________________________________________"
-                << endl;
+        SocketServer server(arg->serveSocketPath, service);
+        server.open();
+
+        // Clients may connect from here on
+        cout << "Serving on " << arg->serveSocketPath << endl;
+        server.run();
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    output << "Stopped serving on " << arg->serveSocketPath << endl;
+    if (arg->printRunStatistics) {
+        service.printStatistics(output);
+    }
+}
+
+void DRAMSpec::stream()
+{
+    EvaluationService service;
+    service.setDefaultIOTermination(arg->IOTerminationCurrentFlag);
+
+    try {
+        if ( !arg->cacheDirectory.empty() ) {
+            service.setCacheDirectory(arg->cacheDirectory);
+        }
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    unsigned int nJobs = arg->nJobs;
+    if ( nJobs == 0 ) {
+        nJobs = max(1u, thread::hardware_concurrency());
+    }
+
+    StreamEvaluator evaluator(service, nJobs, streamInFlightPerJob*nJobs);
+    evaluator.run(cin, cout);
 
+    // Standard output only carries the answers
+    if (arg->printRunStatistics) {
+        service.printStatistics(cerr);
     }
 }
@@ -42,6 +42,26 @@
 #define DRAMSPEC_H
 
 #include "ArgumentsParser.h"
+#include "DramResult.h"
+#include "OutputWriter.h"
+#include "RunStatistics.h"
+#include "ShardMerger.h"
+#include "CheckpointJournal.h"
+#include "ResultCache.h"
+#include "ConfigurationSource.h"
+#include "EvaluationService.h"
+#include "SocketServer.h"
+#include "StreamEvaluator.h"
+#include "TechnologyLibrary.h"
+#include "ParetoExplorer.h"
+#include "GoalSeeker.h"
+#include "FloorplanOptimizer.h"
+#include "SubarraySizer.h"
+#include "SensitivityAnalyzer.h"
+#include "ToleranceAnalyzer.h"
+#include "MonteCarloSimulator.h"
+#include "SobolAnalyzer.h"
+#include "DesignSampler.h"
 #include "../core/Current.h"
 
 #include <ctime>
@@ -60,26 +80,78 @@
 
 using namespace std;
 
-// Very specific macro to be used inside arrangeOutput() function
-#define BUILD_LINE(label, value) \
-    setw(lineWidth) \
-    << left << label \
-    << separator \
-    << right << value \
-    << endl \
-
 class DRAMSpec
 {
 public:
     DRAMSpec(int argc, char** argv);
 
-    void jsonOutputWrite(int dramConfigID);
-    string arrangeOutput(const string isCsv);
-
     void runDramSpec(int argc, char** argv);
 
+    // Input parameters given by -D, after reading the input files
+    void applyParameterOverrides(TechnologyValues& inputs);
+    // Only those of one input file
+    void applyParameterOverrides(TechnologyValues& inputs,
+                                 InputDocument document);
+
+    // Merge run: combines the result tables of all shards of a sharded run
+    void mergeShards();
+
+    // Compile run: writes the technology files to a technology library
+    void compileTechnologyLibrary();
+
+    // Serve run: evaluates configurations on request until shut down
+    void serve();
+
+    // Stream run: evaluates requests from stdin, answers to stdout
+    void stream();
+
+    // Explore run: Pareto front of a grid of input parameters
+    void explore();
+
+    // Solve run: parameter values meeting constraints on the results
+    void solve();
+
+    // Subarray run: smallest subarray sizes within a timing budget
+    void subarray();
+
+    // Tolerance run: bounds of the results over tolerances of the inputs
+    void tolerance();
+
+    // Monte Carlo run: distributions of the results under random variation
+    void monteCarlo();
+
+    // Sobol run: variance-based sensitivity indices over parameter ranges
+    void sobol();
+
+    // Sampling run: results at points over parameter ranges
+    void sample();
+
+    // Floorplan run: best bank and tile placements of the configurations
+    void floorplan();
+
+    // Sensitivity run: derivatives of the results of the configurations
+    void sensitivity();
+
+    // Number of results which can wait to be written
+    //  before the computation has to wait for the writer
+    static const size_t writerQueueCapacity = 64;
+
+    // Requests of a stream run read ahead, per parallel job
+    static const size_t streamInFlightPerJob = 4;
+
+    const char* mergedFileName = "results_merged.csv";
+    const char* paretoFileName = "results_pareto.csv";
+    const char* goalsFileName = "results_goals.csv";
+    const char* floorplanFileName = "results_floorplan.csv";
+    const char* subarrayFileName = "results_subarray.csv";
+    const char* sensitivityFileName = "results_sensitivity.csv";
+    const char* toleranceFileName = "results_tolerance.csv";
+    const char* monteCarloFileName = "results_montecarlo.csv";
+    const char* histogramFileName = "results_montecarlo_histograms.csv";
+    const char* sobolFileName = "results_sobol.csv";
+    const char* sampleFileName = "results_sample.csv";
+
     ArgumentsParser * arg;
-    Current * dram;
     ostringstream output;
 };
 
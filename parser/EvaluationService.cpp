@@ -0,0 +1,511 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "EvaluationService.h"
+
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
+#include "../utils/utils.h"
+
+// Bound of the parsed inputs kept between requests, emptied when reached
+//  (the results are bounded by ResultCache::maxRunResults)
+static const size_t maxCachedInputs = 1024;
+
+bool
+EvaluationService::FileState::operator==(const FileState& other) const
+{
+    return modificationTime == other.modificationTime
+           && modificationTimeNs == other.modificationTimeNs
+           && size == other.size;
+}
+
+EvaluationService::EvaluationService() :
+    latencySamples(nLatencySamples, 0),
+    defaultIOTerminationCurrentFlag(false),
+    shutdownRequested(false)
+{
+    nRequests = 0;
+    nFailedRequests = 0;
+    nEvaluations = 0;
+    nReusedResults = 0;
+    nInputCacheHits = 0;
+    totalLatency = 0;
+    maxLatency = 0;
+    nextLatencySample = 0;
+}
+
+void
+EvaluationService::setCacheDirectory(const string& directory)
+{
+    try {
+        resultCache.setDirectory(directory);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+}
+
+void
+EvaluationService::setDefaultIOTermination(bool IOTerminationCurrentFlag)
+{
+    defaultIOTerminationCurrentFlag = IOTerminationCurrentFlag;
+}
+
+bool
+EvaluationService::getFileState(const string& fileName, FileState& state)
+{
+    return getFileModification(fileName.c_str(), state.modificationTime,
+                               state.modificationTimeNs, state.size);
+}
+
+string
+EvaluationService::handleRequest(const string& requestLine)
+{
+    return respond(requestLine, false, 0);
+}
+
+string
+EvaluationService::handleRequest(const string& requestLine,
+                                 unsigned long defaultID)
+{
+    return respond(requestLine, true, defaultID);
+}
+
+string
+EvaluationService::respond(const string& requestLine, bool hasDefaultID,
+                           unsigned long defaultID)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+
+    bool isFailed = false;
+    try {
+        rapidjson::Document request;
+        request.Parse(requestLine.c_str());
+        bool isObject = !request.HasParseError() && request.IsObject();
+
+        // The id comes first, also in the answer of a failed request
+        if ( isObject && request.HasMember("id") ) {
+            writer.Key("id");
+            request["id"].Accept(writer);
+        }
+        else if ( hasDefaultID ) {
+            writer.Key("id");
+            writer.Uint64(defaultID);
+        }
+
+        if ( !isObject ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Request is not a JSON object.\n");
+            throw exceptionMsgThrown;
+        }
+
+        if ( request.HasMember("command") ) {
+            string command;
+            if ( request["command"].IsString() ) {
+                command = request["command"].GetString();
+            }
+
+            if ( command == "stats" ) {
+                writer.Key("ok");
+                writer.Bool(true);
+                writer.Key("statistics");
+                writeStatistics(writer);
+            }
+            else if ( command == "shutdown" ) {
+                shutdownRequested.store(true);
+                writer.Key("ok");
+                writer.Bool(true);
+            }
+            else {
+                string exceptionMsgThrown("[ERROR] ");
+                exceptionMsgThrown.append("Unknown command. ");
+                exceptionMsgThrown.append("Expected \"stats\" or \"shutdown\".\n");
+                throw exceptionMsgThrown;
+            }
+        }
+        else {
+            TechnologyValues inputs;
+            readInputs(request, inputs);
+
+            if ( request.HasMember("overrides") ) {
+                applyOverrides(request["overrides"], inputs);
+            }
+
+            bool IOTerminationCurrentFlag = defaultIOTerminationCurrentFlag;
+            if ( request.HasMember("term") ) {
+                if ( !request["term"].IsBool() ) {
+                    string exceptionMsgThrown("[ERROR] ");
+                    exceptionMsgThrown.append("Member \"term\" is expected ");
+                    exceptionMsgThrown.append("to be a boolean.\n");
+                    throw exceptionMsgThrown;
+                }
+                IOTerminationCurrentFlag = request["term"].GetBool();
+            }
+
+            DramResult result;
+            bool wasEvaluated = evaluate(inputs, IOTerminationCurrentFlag,
+                                         result);
+            // JSON has no infinities or NaNs
+            for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+                if ( !isfinite(result.values[valueID]) ) {
+                    string exceptionMsgThrown("[ERROR] ");
+                    exceptionMsgThrown.append("The model gives no finite ");
+                    exceptionMsgThrown.append("value of \"");
+                    exceptionMsgThrown.append(DramResult::names[valueID]);
+                    exceptionMsgThrown.append("\" for these inputs.\n");
+                    throw exceptionMsgThrown;
+                }
+            }
+
+            writer.Key("ok");
+            writer.Bool(true);
+            writer.Key("reused");
+            writer.Bool(!wasEvaluated);
+            writer.Key("warning");
+            writer.String(result.warning.c_str());
+            writer.Key("results");
+            writer.StartObject();
+            for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+                writer.Key(DramResult::names[valueID]);
+                writer.Double(result.values[valueID]);
+            }
+            writer.EndObject();
+        }
+    } catch(string exceptionMsgThrown) {
+        isFailed = true;
+        // Messages end with a line break, which is not needed here
+        while ( !exceptionMsgThrown.empty()
+                && exceptionMsgThrown[exceptionMsgThrown.size()-1] == '\n' ) {
+            exceptionMsgThrown.erase(exceptionMsgThrown.size()-1);
+        }
+        writer.Key("ok");
+        writer.Bool(false);
+        writer.Key("error");
+        writer.String(exceptionMsgThrown.c_str());
+    }
+
+    double latency = chrono::duration<double, micro>(
+                         chrono::steady_clock::now() - start).count();
+    recordLatency(latency, isFailed);
+
+    writer.Key("latency_us");
+    writer.Double(latency);
+    writer.EndObject();
+
+    return buffer.GetString();
+}
+
+void
+EvaluationService::readInputs(const rapidjson::Value& request,
+                              TechnologyValues& inputs)
+{
+    if ( !request.HasMember("technology")
+         || !request.HasMember("architecture") ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Request needs members \"technology\" ");
+        exceptionMsgThrown.append("and \"architecture\".\n");
+        throw exceptionMsgThrown;
+    }
+    const rapidjson::Value& technology = request["technology"];
+    const rapidjson::Value& architecture = request["architecture"];
+
+    if ( !technology.IsString() || !architecture.IsString() ) {
+        // At least one inline document, nothing to keep
+        inputs.techFileName = technology.IsString() ?
+                                  technology.GetString() : "(inline)";
+        inputs.archFileName = architecture.IsString() ?
+                                  architecture.GetString() : "(inline)";
+        readDocument(technology, true, inputs);
+        readDocument(architecture, false, inputs);
+        return;
+    }
+
+    // Both files, reuse what was read as long as they are unchanged
+    string technologyFileName(technology.GetString());
+    string architectureFileName(architecture.GetString());
+    string pairKey(technologyFileName + "\n" + architectureFileName);
+
+    FileState technologyFileState, architectureFileState;
+    bool isCacheable = getFileState(technologyFileName, technologyFileState)
+                    && getFileState(architectureFileName, architectureFileState);
+    if ( isCacheable ) {
+        lock_guard<mutex> lock(cacheMutex);
+        map<string, CachedInputs>::const_iterator cached
+                = inputCache.find(pairKey);
+        bool isUnchanged = cached != inputCache.end()
+             && cached->second.technologyFileState == technologyFileState
+             && cached->second.architectureFileState == architectureFileState;
+        for ( unsigned int it = 0; isUnchanged
+              && it < cached->second.inputs.baseFileNames.size(); it++ ) {
+            FileState baseFileState;
+            isUnchanged = getFileState(cached->second.inputs.baseFileNames[it],
+                                       baseFileState)
+                          && baseFileState == cached->second.baseFileStates[it];
+        }
+        if ( isUnchanged ) {
+            inputs = cached->second.inputs;
+            lock_guard<mutex> statisticsLock(statisticsMutex);
+            nInputCacheHits++;
+            return;
+        }
+    }
+
+    try {
+        inputs.readjson(technologyFileName, architectureFileName);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    vector<FileState> baseFileStates(inputs.baseFileNames.size());
+    for ( unsigned int it = 0; isCacheable
+          && it < inputs.baseFileNames.size(); it++ ) {
+        isCacheable = getFileState(inputs.baseFileNames[it],
+                                   baseFileStates[it]);
+    }
+
+    if ( isCacheable ) {
+        lock_guard<mutex> lock(cacheMutex);
+        if ( inputCache.size() >= maxCachedInputs ) {
+            inputCache.clear();
+        }
+        CachedInputs& cached = inputCache[pairKey];
+        cached.technologyFileState = technologyFileState;
+        cached.architectureFileState = architectureFileState;
+        cached.baseFileStates = baseFileStates;
+        cached.inputs = inputs;
+    }
+}
+
+void
+EvaluationService::readDocument(const rapidjson::Value& document,
+                                bool isTechnology,
+                                TechnologyValues& inputs)
+{
+    const char* documentType = isTechnology ? "technology" : "architecture";
+
+    try {
+        ExtendedDocument fileDocument;
+        JSONMembers values(document);
+        if ( document.IsString() ) {
+            TechnologyValues::readJSONFile(document.GetString(),
+                                           documentType,
+                                           fileDocument,
+                                           &inputs.baseFileNames);
+            values = JSONMembers(fileDocument);
+        }
+        else if ( !document.IsObject() ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Member \"");
+            exceptionMsgThrown.append(documentType);
+            exceptionMsgThrown.append("\" is expected to be a file path ");
+            exceptionMsgThrown.append("or a JSON object.\n");
+            throw exceptionMsgThrown;
+        }
+
+        if ( isTechnology ) {
+            inputs.readTechnology(values);
+        }
+        else {
+            inputs.readArchitecture(values);
+        }
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+}
+
+void
+EvaluationService::applyOverrides(const rapidjson::Value& overrides,
+                                  TechnologyValues& inputs)
+{
+    if ( !overrides.IsObject() ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Member \"overrides\" is expected ");
+        exceptionMsgThrown.append("to be a JSON object.\n");
+        throw exceptionMsgThrown;
+    }
+
+    for ( rapidjson::Value::ConstMemberIterator member = overrides.MemberBegin();
+          member != overrides.MemberEnd(); ++member ) {
+        const char* name = member->name.GetString();
+        const TechnologyField* field = TechnologyValues::findField(name);
+        if ( field == NULL ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Unknown input parameter \"");
+            exceptionMsgThrown.append(name);
+            exceptionMsgThrown.append("\" in overrides.\n");
+            throw exceptionMsgThrown;
+        }
+
+        if ( field->isString && member->value.IsString() ) {
+            field->setString(inputs, member->value.GetString());
+        }
+        else if ( !field->isString && member->value.IsNumber() ) {
+            double value = member->value.GetDouble();
+            try {
+                TechnologyValues::checkNumber(*field, value);
+            } catch(string exceptionMsgThrown) {
+                throw exceptionMsgThrown;
+            }
+            field->setNumber(inputs, value);
+        }
+        else {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Override of \"");
+            exceptionMsgThrown.append(name);
+            exceptionMsgThrown.append("\" is expected to be a ");
+            exceptionMsgThrown.append(field->isString ? "string" : "number");
+            exceptionMsgThrown.append(".\n");
+            throw exceptionMsgThrown;
+        }
+    }
+}
+
+bool
+EvaluationService::evaluate(const TechnologyValues& inputs,
+                            bool IOTerminationCurrentFlag,
+                            DramResult& result)
+{
+    result.inputKey = ResultCache::inputKey(inputs, IOTerminationCurrentFlag);
+
+    bool isReused = false;
+    {
+        lock_guard<mutex> lock(cacheMutex);
+        isReused = resultCache.findInRun(result);
+    }
+    if ( !isReused && resultCache.findOnDisk(result) ) {
+        lock_guard<mutex> lock(cacheMutex);
+        resultCache.insertInRun(result);
+        isReused = true;
+    }
+    if ( isReused ) {
+        lock_guard<mutex> statisticsLock(statisticsMutex);
+        nReusedResults++;
+        return false;
+    }
+
+    try {
+        Current dram(inputs, IOTerminationCurrentFlag);
+        result.collect(dram);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    {
+        lock_guard<mutex> lock(cacheMutex);
+        resultCache.insertInRun(result);
+    }
+    resultCache.storeOnDisk(result);
+
+    lock_guard<mutex> statisticsLock(statisticsMutex);
+    nEvaluations++;
+    return true;
+}
+
+void
+EvaluationService::recordLatency(double latency, bool isFailed)
+{
+    lock_guard<mutex> statisticsLock(statisticsMutex);
+    nRequests++;
+    if ( isFailed ) {
+        nFailedRequests++;
+    }
+    totalLatency += latency;
+    maxLatency = max(maxLatency, latency);
+    latencySamples[nextLatencySample % nLatencySamples] = latency;
+    nextLatencySample++;
+}
+
+void
+EvaluationService::writeStatistics(
+        rapidjson::Writer<rapidjson::StringBuffer>& writer)
+{
+    lock_guard<mutex> statisticsLock(statisticsMutex);
+
+    // Percentiles over the most recent requests
+    vector<double> recent(latencySamples.begin(),
+                          latencySamples.begin()
+                          + min(nextLatencySample, nLatencySamples));
+    sort(recent.begin(), recent.end());
+    double p50 = recent.empty() ? 0 : recent[(recent.size() - 1) / 2];
+    double p99 = recent.empty() ? 0 : recent[(recent.size() - 1) * 99 / 100];
+
+    writer.StartObject();
+    writer.Key("requests");
+    writer.Uint64(nRequests);
+    writer.Key("failed_requests");
+    writer.Uint64(nFailedRequests);
+    writer.Key("evaluations");
+    writer.Uint64(nEvaluations);
+    writer.Key("reused_results");
+    writer.Uint64(nReusedResults);
+    writer.Key("input_cache_hits");
+    writer.Uint64(nInputCacheHits);
+    writer.Key("mean_latency_us");
+    writer.Double(nRequests > 0 ? totalLatency / nRequests : 0);
+    writer.Key("p50_latency_us");
+    writer.Double(p50);
+    writer.Key("p99_latency_us");
+    writer.Double(p99);
+    writer.Key("max_latency_us");
+    writer.Double(maxLatency);
+    writer.EndObject();
+}
+
+void
+EvaluationService::printStatistics(ostream& out)
+{
+    lock_guard<mutex> statisticsLock(statisticsMutex);
+
+    out << "Service statistics:" << endl;
+    out << setw(34) << left << "\tRequests:" << nRequests << endl;
+    out << setw(34) << left << "\tFailed requests:" << nFailedRequests << endl;
+    out << setw(34) << left << "\tEvaluations:" << nEvaluations << endl;
+    out << setw(34) << left << "\tReused results:" << nReusedResults << endl;
+    out << setw(34) << left << "\tInput cache hits:" << nInputCacheHits << endl;
+    out << setw(34) << left << "\tMean latency [us]:"
+        << ( nRequests > 0 ? totalLatency / nRequests : 0 ) << endl;
+    out << setw(34) << left << "\tMax latency [us]:" << maxLatency << endl;
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef EVALUATIONSERVICE_H
+#define EVALUATIONSERVICE_H
+
+#include <iostream>
+#include <string>
+#include <map>
+#include <vector>
+#include <mutex>
+#include <atomic>
+
+#include "DramResult.h"
+#include "ResultCache.h"
+#include "TechnologyValues.h"
+#include "../core/Current.h"
+
+#include "rapidjson/include/rapidjson/document.h"
+#include "rapidjson/include/rapidjson/writer.h"
+#include "rapidjson/include/rapidjson/stringbuffer.h"
+
+using namespace std;
+
+// Evaluates single configurations on request (see -serve).
+// Each request is one JSON object, answered by one JSON object:
+//  {"id": ..., "technology": <file path or inline object>,
+//   "architecture": <file path or inline object>,
+//   "overrides": {"<input parameter>": <value>, ...}, "term": <bool>}
+//  {"command": "stats"} and {"command": "shutdown"}
+// Read input files and evaluated results are kept between requests,
+//  and requests may be handled concurrently.
+class EvaluationService
+{
+public:
+    EvaluationService();
+
+    void setCacheDirectory(const string& directory);
+    // Used for requests without "term" (see -term)
+    void setDefaultIOTermination(bool IOTerminationCurrentFlag);
+
+    // One request line in, one response line out (without line break)
+    string handleRequest(const string& requestLine);
+    // Same, but a request without "id" (or not readable at all) is
+    //  answered with the given id
+    string handleRequest(const string& requestLine, unsigned long defaultID);
+
+    bool isShutdownRequested() const { return shutdownRequested.load(); }
+
+    void printStatistics(ostream& out);
+
+    // Number of latencies kept for the percentiles of the statistics
+    static const size_t nLatencySamples = 1024;
+
+private:
+    struct FileState {
+        long long modificationTime;
+        long modificationTimeNs;
+        long long size;
+        bool operator==(const FileState& other) const;
+    };
+    // Input values read from a pair of files, valid while both are unchanged
+    struct CachedInputs {
+        FileState technologyFileState;
+        FileState architectureFileState;
+        // States of the base files, in the order of inputs.baseFileNames
+        vector<FileState> baseFileStates;
+        TechnologyValues inputs;
+    };
+
+    static bool getFileState(const string& fileName, FileState& state);
+
+    string respond(const string& requestLine, bool hasDefaultID,
+                   unsigned long defaultID);
+
+    void readInputs(const rapidjson::Value& request, TechnologyValues& inputs);
+    void readDocument(const rapidjson::Value& document, bool isTechnology,
+                      TechnologyValues& inputs);
+    void applyOverrides(const rapidjson::Value& overrides,
+                        TechnologyValues& inputs);
+    bool evaluate(const TechnologyValues& inputs,
+                  bool IOTerminationCurrentFlag, DramResult& result);
+
+    void recordLatency(double latency, bool isFailed);
+    void writeStatistics(rapidjson::Writer<rapidjson::StringBuffer>& writer);
+
+    mutex cacheMutex;
+    map<string, CachedInputs> inputCache;
+    ResultCache resultCache;
+
+    mutex statisticsMutex;
+    unsigned long nRequests;
+    unsigned long nFailedRequests;
+    unsigned long nEvaluations;
+    unsigned long nReusedResults;
+    unsigned long nInputCacheHits;
+    double totalLatency;   // [us]
+    double maxLatency;     // [us]
+    vector<double> latencySamples;
+    size_t nextLatencySample;
+
+    bool defaultIOTerminationCurrentFlag;
+    atomic<bool> shutdownRequested;
+};
+
+#endif // EVALUATIONSERVICE_H
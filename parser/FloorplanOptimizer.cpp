@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "FloorplanOptimizer.h"
+
+#include "../core/Current.h"
+
+FloorplanOptimizer::FloorplanOptimizer(bool IOTerminationCurrentFlag) :
+    IOTerminationCurrentFlag(IOTerminationCurrentFlag)
+{
+    nInvalid = 0;
+    configuredPlacement = 0;
+}
+
+bool
+FloorplanOptimizer::isMaximized(int valueID)
+{
+    return valueID == DramResult::MAX_CORE_FREQ;
+}
+
+void
+FloorplanOptimizer::optimize(const TechnologyValues& inputs)
+{
+    placements.clear();
+    objectiveValueIDs.clear();
+    nInvalid = 0;
+
+    // Placement independent stages, and the configured placement
+    Tile tile;
+    unsigned int configuredVerticalTiles = 0;
+    unsigned int configuredVerticalBanks = 0;
+    try {
+        tile = Tile(inputs);
+        Bank configuredBank(tile, INVALID_VALUE);
+        Channel configuredChannel(configuredBank, INVALID_VALUE);
+        configuredVerticalTiles = configuredBank.nVerticalTiles;
+        configuredVerticalBanks = configuredChannel.nVerticalBanks;
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    for ( unsigned int nVerticalTiles = 1;
+          nVerticalTiles <= tile.nTilesPerBank; nVerticalTiles *= 2 ) {
+        Bank bank(tile, nVerticalTiles);
+        for ( unsigned int nVerticalBanks = 1;
+              nVerticalBanks <= bank.nBanks; nVerticalBanks *= 2 ) {
+            Floorplan placement;
+            placement.nVerticalBanks = nVerticalBanks;
+            placement.nHorizontalBanks = bank.nBanks / nVerticalBanks;
+            placement.nVerticalTiles = nVerticalTiles;
+            placement.nHorizontalTiles = bank.nHorizontalTiles;
+            try {
+                Channel channel(bank, nVerticalBanks);
+                Timing timing(channel);
+                Current dram(timing, IOTerminationCurrentFlag);
+                placement.result.collect(dram);
+            } catch(string exceptionMsgThrown) {
+                // The configuration itself is rejected as in a normal run
+                if ( nVerticalTiles == configuredVerticalTiles
+                     && nVerticalBanks == configuredVerticalBanks ) {
+                    throw exceptionMsgThrown;
+                }
+                nInvalid++;
+                continue;
+            }
+            if ( nVerticalTiles == configuredVerticalTiles
+                 && nVerticalBanks == configuredVerticalBanks ) {
+                configuredPlacement = placements.size();
+            }
+            placements.push_back(placement);
+        }
+    }
+
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        for ( unsigned int it = 1; it < placements.size(); it++ ) {
+            if ( placements[it].result.values[valueID]
+                 != placements[0].result.values[valueID] ) {
+                objectiveValueIDs.push_back(valueID);
+                break;
+            }
+        }
+    }
+}
+
+unsigned int
+FloorplanOptimizer::bestFloorplan(int valueID) const
+{
+    // The first of equally good placements
+    unsigned int best = 0;
+    for ( unsigned int it = 1; it < placements.size(); it++ ) {
+        double value = placements[it].result.values[valueID];
+        double bestValue = placements[best].result.values[valueID];
+        if ( isMaximized(valueID) ? value > bestValue : value < bestValue ) {
+            best = it;
+        }
+    }
+    return best;
+}
+
+void
+FloorplanOptimizer::writeHeader(ostream& floorplanFile)
+{
+    floorplanFile << "Configuration,TechnologyFile,ArchitectureFile,"
+                  << "Objective,Goal,Best,VerticalBanks,HorizontalBanks,"
+                  << "VerticalTiles,HorizontalTiles,Configured\n";
+}
+
+void
+FloorplanOptimizer::writeBest(ostream& floorplanFile, unsigned int configID,
+                              const string& technologyFileName,
+                              const string& architectureFileName) const
+{
+    string fileNameFields;
+    appendCsvFileNames(fileNameFields, technologyFileName,
+                       architectureFileName);
+
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+    for ( unsigned int it = 0; it < objectiveValueIDs.size(); it++ ) {
+        int valueID = objectiveValueIDs[it];
+        const Floorplan& best = placements[bestFloorplan(valueID)];
+        floorplanFile << configID << "," << fileNameFields << ","
+                      << DramResult::names[valueID] << ","
+                      << ( isMaximized(valueID) ? "maximum" : "minimum" );
+        shortestDoubleToString(best.result.values[valueID], buffer);
+        floorplanFile << "," << buffer
+                      << "," << best.nVerticalBanks
+                      << "," << best.nHorizontalBanks
+                      << "," << best.nVerticalTiles
+                      << "," << best.nHorizontalTiles;
+        shortestDoubleToString(
+            placements[configuredPlacement].result.values[valueID], buffer);
+        floorplanFile << "," << buffer << "\n";
+    }
+}
+
+void
+FloorplanOptimizer::printBest(ostream& output) const
+{
+    const Floorplan& configured = placements[configuredPlacement];
+    output << "\t" << placements.size() << " placements, configured: "
+           << configured.nVerticalBanks << "x" << configured.nHorizontalBanks
+           << " banks, " << configured.nVerticalTiles << "x"
+           << configured.nHorizontalTiles << " tiles (vertical x horizontal)"
+           << endl;
+
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+    for ( unsigned int it = 0; it < objectiveValueIDs.size(); it++ ) {
+        int valueID = objectiveValueIDs[it];
+        const Floorplan& best = placements[bestFloorplan(valueID)];
+        shortestDoubleToString(best.result.values[valueID], buffer);
+        output << "\t" << DramResult::names[valueID] << ": " << buffer
+               << " with " << best.nVerticalBanks << "x"
+               << best.nHorizontalBanks << " banks, "
+               << best.nVerticalTiles << "x" << best.nHorizontalTiles
+               << " tiles";
+        shortestDoubleToString(configured.result.values[valueID], buffer);
+        output << " (configured: " << buffer << ")" << endl;
+    }
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef FLOORPLANOPTIMIZER_H
+#define FLOORPLANOPTIMIZER_H
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+#include "TechnologyValues.h"
+#include "DramResult.h"
+
+using namespace std;
+
+// Placement of the banks on the channel and of the tiles on a bank
+struct Floorplan
+{
+    unsigned int nVerticalBanks;
+    unsigned int nHorizontalBanks;
+    unsigned int nVerticalTiles;
+    unsigned int nHorizontalTiles;
+    DramResult result;
+};
+
+// Evaluates a configuration with every power-of-two placement of its
+//  banks and tiles (-floorplan). The subarray and tile are computed once,
+//  a bank once per tile placement and the rest once per placement.
+// Every result which differs between the placements is an objective:
+//  the maximum core frequency is maximized, the other results minimized.
+class FloorplanOptimizer
+{
+public:
+    explicit FloorplanOptimizer(bool IOTerminationCurrentFlag);
+
+    void optimize(const TechnologyValues& inputs);
+
+    const vector<Floorplan>& floorplans() const { return placements; }
+    // Placement given by the inputs (the default one if not given)
+    unsigned int configuredFloorplan() const { return configuredPlacement; }
+    const vector<int>& objectives() const { return objectiveValueIDs; }
+    unsigned int bestFloorplan(int valueID) const;
+    static bool isMaximized(int valueID);
+
+    static void writeHeader(ostream& floorplanFile);
+    // One row per objective
+    void writeBest(ostream& floorplanFile, unsigned int configID,
+                   const string& technologyFileName,
+                   const string& architectureFileName) const;
+    void printBest(ostream& output) const;
+
+    // Placements which the model rejects
+    unsigned int nInvalid;
+
+private:
+    bool IOTerminationCurrentFlag;
+    vector<Floorplan> placements;
+    unsigned int configuredPlacement;
+    vector<int> objectiveValueIDs;
+};
+
+#endif // FLOORPLANOPTIMIZER_H
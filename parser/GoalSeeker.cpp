@@ -0,0 +1,509 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "GoalSeeker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "../core/Current.h"
+
+// Clock cycles of timings which do not depend on the frequency: at the
+//  frequency f [MHz], cycles = ceil(time[ns] * f / 1000)
+struct FrequencyIndependentCycles
+{
+    int cyclesValueID;
+    int timeValueID;
+};
+
+static const FrequencyIndependentCycles frequencyIndependentCycles[] = {
+    { DramResult::TRCD_CLK,  DramResult::TRCD  },
+    { DramResult::TCAS_CLK,  DramResult::TCAS  },
+    { DramResult::TRAS_CLK,  DramResult::TRAS  },
+    { DramResult::TRP_CLK,   DramResult::TRP   },
+    { DramResult::TRC_CLK,   DramResult::TRC   },
+    { DramResult::TRTP_CLK,  DramResult::TRTP  },
+    { DramResult::TCCD_CLK,  DramResult::TCCD  },
+    { DramResult::TWR_CLK,   DramResult::TWR   },
+    { DramResult::TREFI_CLK, DramResult::TREFI }
+};
+
+GoalSeeker::GoalSeeker()
+{
+    IOTerminationCurrentFlag = false;
+}
+
+void
+GoalSeeker::readSpecification(const string& specificationFileName)
+{
+    rapidjson::Document specification;
+    string exceptionMsgThrown;
+    try {
+        baseInputs = TechnologyValues::readSpecification(
+                         specificationFileName, "goal", "Goal specification",
+                         specification, exceptionMsgThrown);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    if ( !specification.HasMember("goals")
+         || !specification["goals"].IsArray()
+         || specification["goals"].Size() == 0 ) {
+        exceptionMsgThrown.append("needs \"goals\", a list of objects.\n");
+        throw exceptionMsgThrown;
+    }
+    const rapidjson::Value& goalList = specification["goals"];
+    for ( rapidjson::SizeType it = 0; it < goalList.Size(); it++ ) {
+        const rapidjson::Value& goal = goalList[it];
+        string goalMsgThrown(exceptionMsgThrown);
+        goalMsgThrown.append("has a goal ");
+        goalMsgThrown.append(to_string(it + 1));
+        goalMsgThrown.append(" which ");
+
+        bool isMaximized = goal.IsObject() && goal.HasMember("maximize");
+        bool isMinimized = goal.IsObject() && goal.HasMember("minimize");
+        const char* direction = ( isMaximized ? "maximize" : "minimize" );
+        if ( isMaximized == isMinimized || !goal[direction].IsString() ) {
+            goalMsgThrown.append("needs one parameter name to ");
+            goalMsgThrown.append("\"maximize\" or \"minimize\".\n");
+            throw goalMsgThrown;
+        }
+        string name(goal[direction].GetString());
+
+        try {
+            if ( goal.HasMember("values") ) {
+                vector<double> values;
+                bool isValid = goal["values"].IsArray()
+                               && goal["values"].Size() > 0;
+                for ( rapidjson::SizeType value = 0;
+                      isValid && value < goal["values"].Size(); value++ ) {
+                    isValid = goal["values"][value].IsNumber();
+                    if ( isValid ) {
+                        values.push_back(goal["values"][value].GetDouble());
+                    }
+                }
+                if ( !isValid ) {
+                    goalMsgThrown.append("gives no list of numbers ");
+                    goalMsgThrown.append("as \"values\".\n");
+                    throw goalMsgThrown;
+                }
+                addListGoal(name, isMaximized, values);
+            }
+            else {
+                if ( !goal.HasMember("minimum")
+                     || !goal["minimum"].IsNumber()
+                     || !goal.HasMember("maximum")
+                     || !goal["maximum"].IsNumber()
+                     || goal["minimum"].GetDouble()
+                        > goal["maximum"].GetDouble()
+                     || ( goal.HasMember("tolerance")
+                          && ( !goal["tolerance"].IsNumber()
+                               || goal["tolerance"].GetDouble() <= 0 ) ) ) {
+                    goalMsgThrown.append("gives no \"values\" nor ");
+                    goalMsgThrown.append("a valid \"minimum\" and ");
+                    goalMsgThrown.append("\"maximum\".\n");
+                    throw goalMsgThrown;
+                }
+                addRangeGoal(name, isMaximized, goal["minimum"].GetDouble(),
+                             goal["maximum"].GetDouble(),
+                             goal.HasMember("tolerance")
+                             ? goal["tolerance"].GetDouble() : 0);
+            }
+
+            if ( !goal.HasMember("constraints")
+                 || !goal["constraints"].IsArray()
+                 || goal["constraints"].Size() == 0 ) {
+                goalMsgThrown.append("needs \"constraints\", ");
+                goalMsgThrown.append("a list of comparisons.\n");
+                throw goalMsgThrown;
+            }
+            const rapidjson::Value& constraints = goal["constraints"];
+            for ( rapidjson::SizeType constraint = 0;
+                  constraint < constraints.Size(); constraint++ ) {
+                if ( !constraints[constraint].IsString() ) {
+                    goalMsgThrown.append("gives a constraint which is ");
+                    goalMsgThrown.append("not a comparison.\n");
+                    throw goalMsgThrown;
+                }
+                addConstraint(constraints[constraint].GetString());
+            }
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+    }
+}
+
+void
+GoalSeeker::addRangeGoal(const string& name, bool isMaximized,
+                         double minimum, double maximum, double tolerance)
+{
+    try {
+        addListGoal(name, isMaximized, vector<double>());
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    Goal& goal = goalList.back();
+    goal.isInteger = goal.field->isInteger;
+    goal.minimum = ( goal.isInteger ? ceil(minimum) : minimum );
+    goal.maximum = ( goal.isInteger ? floor(maximum) : maximum );
+    goal.tolerance = ( tolerance > 0 ? tolerance : (maximum - minimum)*1e-9 );
+}
+
+void
+GoalSeeker::addListGoal(const string& name, bool isMaximized,
+                        const vector<double>& values)
+{
+    const TechnologyField* field = TechnologyValues::findField(name);
+    if ( field == NULL || field->isString ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Unknown numeric input parameter \"");
+        exceptionMsgThrown.append(name);
+        exceptionMsgThrown.append("\" can not be solved for.\n");
+        throw exceptionMsgThrown;
+    }
+
+    Goal goal;
+    goal.field = field;
+    goal.isMaximized = isMaximized;
+    goal.values = values;
+    sort(goal.values.begin(), goal.values.end());
+    goal.values.erase(unique(goal.values.begin(), goal.values.end()),
+                      goal.values.end());
+    goal.minimum = 0;
+    goal.maximum = 0;
+    goal.isInteger = false;
+    goal.tolerance = 0;
+    goal.isFound = false;
+    goal.value = 0;
+    goal.nEvaluations = 0;
+    goal.isNarrowedInClosedForm = false;
+    goalList.push_back(goal);
+}
+
+void
+GoalSeeker::addConstraint(const string& text)
+{
+    istringstream tokens(text);
+    string name;
+    string comparison;
+    string boundName;
+    string trailing;
+    tokens >> name >> comparison >> boundName;
+
+    Constraint constraint;
+    constraint.text = text;
+    constraint.valueID = DramResult::findValue(name);
+    constraint.boundValueID = DramResult::findValue(boundName);
+    constraint.bound = 0;
+    if ( constraint.boundValueID < 0 ) {
+        char* end = NULL;
+        constraint.bound = strtod(boundName.c_str(), &end);
+        if ( boundName.empty() || *end != '\0' ) {
+            boundName.clear();
+        }
+    }
+    bool isValid = ( constraint.valueID >= 0 && !boundName.empty()
+                     && !(tokens >> trailing) && !goalList.empty() );
+    if ( comparison == "<" ) {
+        constraint.comparison = LESS;
+    }
+    else if ( comparison == "<=" ) {
+        constraint.comparison = LESS_EQUAL;
+    }
+    else if ( comparison == ">" ) {
+        constraint.comparison = GREATER;
+    }
+    else if ( comparison == ">=" ) {
+        constraint.comparison = GREATER_EQUAL;
+    }
+    else {
+        isValid = false;
+    }
+
+    if ( !isValid ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Constraint \"");
+        exceptionMsgThrown.append(text);
+        exceptionMsgThrown.append("\" is not of the form \"<result> <= ");
+        exceptionMsgThrown.append("<number or result>\" (also <, >= or >).\n");
+        throw exceptionMsgThrown;
+    }
+    goalList.back().constraints.push_back(constraint);
+}
+
+bool
+GoalSeeker::isMet(const Constraint& constraint, const DramResult& result)
+{
+    double value = result.values[constraint.valueID];
+    double bound = ( constraint.boundValueID >= 0
+                     ? result.values[constraint.boundValueID]
+                     : constraint.bound );
+    switch ( constraint.comparison ) {
+        case LESS:
+            return value < bound;
+        case LESS_EQUAL:
+            return value <= bound;
+        case GREATER:
+            return value > bound;
+        default:
+            return value >= bound;
+    }
+}
+
+void
+GoalSeeker::solve()
+{
+    for ( unsigned int it = 0; it < goalList.size(); it++ ) {
+        solveGoal(goalList[it]);
+    }
+}
+
+const GoalSeeker::Evaluation&
+GoalSeeker::evaluate(Goal& goal, double value)
+{
+    map<double, Evaluation>::iterator known = evaluations.find(value);
+    if ( known != evaluations.end() ) {
+        return known->second;
+    }
+
+    Evaluation& evaluation = evaluations[value];
+    evaluation.isValid = false;
+    goal.nEvaluations++;
+
+    TechnologyValues inputs(baseInputs);
+    goal.field->setNumber(inputs, value);
+    try {
+        Current dram(inputs, IOTerminationCurrentFlag);
+        evaluation.result.collect(dram);
+        evaluation.isValid = true;
+    } catch(string exceptionMsgThrown) {
+        // Rejected by the model
+    }
+    return evaluation;
+}
+
+bool
+GoalSeeker::isFeasible(Goal& goal, double value)
+{
+    const Evaluation& evaluation = evaluate(goal, value);
+    if ( !evaluation.isValid ) {
+        return false;
+    }
+    for ( unsigned int it = 0; it < goal.constraints.size(); it++ ) {
+        if ( !isMet(goal.constraints[it], evaluation.result) ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+double
+GoalSeeker::closedFormUpperBound(Goal& goal)
+{
+    const double infinity = numeric_limits<double>::infinity();
+    if ( string(goal.field->name) != "Frequency[MHz]" ) {
+        return infinity;
+    }
+
+    // Frequency independent quantities, taken at the lowest frequency
+    const Evaluation& reference =
+        evaluate(goal, goal.values.empty() ? goal.minimum : goal.values[0]);
+    if ( !reference.isValid ) {
+        return infinity;
+    }
+    const double* values = reference.result.values;
+    size_t nCycles = sizeof(frequencyIndependentCycles)
+                     / sizeof(frequencyIndependentCycles[0]);
+    bool isCoreFrequencyDerived = ( TechnologyValues::findField(
+                "CoreFrequency[MHz]")->getNumber(baseInputs) == 0 );
+
+    double upperBound = infinity;
+    for ( unsigned int it = 0; it < goal.constraints.size(); it++ ) {
+        const Constraint& constraint = goal.constraints[it];
+        if ( constraint.comparison != LESS
+             && constraint.comparison != LESS_EQUAL ) {
+            continue;
+        }
+
+        // ceil(time * f / 1000) <= cycles  <=>  f <= 1000 * cycles / time
+        for ( size_t cycles = 0; cycles < nCycles; cycles++ ) {
+            const FrequencyIndependentCycles& timing =
+                                            frequencyIndependentCycles[cycles];
+            if ( constraint.valueID == timing.cyclesValueID
+                 && constraint.boundValueID < 0
+                 && values[timing.timeValueID] > 0 ) {
+                double maxCycles = ( constraint.comparison == LESS_EQUAL
+                                     ? floor(constraint.bound)
+                                     : ceil(constraint.bound) - 1 );
+                upperBound = min(upperBound, 1000.0 * maxCycles
+                                             / values[timing.timeValueID]);
+            }
+        }
+
+        // The core frequency is the frequency over a fixed clock factor,
+        //  the maximum core frequency only depends on tCCD
+        if ( constraint.valueID == DramResult::CORE_FREQ
+             && constraint.boundValueID == DramResult::MAX_CORE_FREQ
+             && isCoreFrequencyDerived
+             && values[DramResult::CORE_FREQ] > 0 ) {
+            upperBound = min(upperBound, values[DramResult::MAX_CORE_FREQ]
+                                         * values[DramResult::DRAM_FREQ]
+                                         / values[DramResult::CORE_FREQ]);
+        }
+    }
+
+    goal.isNarrowedInClosedForm = ( upperBound < infinity );
+    return upperBound;
+}
+
+void
+GoalSeeker::solveGoal(Goal& goal)
+{
+    evaluations.clear();
+    goal.isFound = false;
+    goal.nEvaluations = 0;
+    goal.isNarrowedInClosedForm = false;
+
+    double upperBound = closedFormUpperBound(goal);
+
+    // Positions of the bisection: indices of the candidate values, or the
+    //  values of the range (integers for counts)
+    vector<double> candidates;
+    for ( unsigned int it = 0; it < goal.values.size(); it++ ) {
+        if ( goal.values[it] <= upperBound ) {
+            candidates.push_back(goal.values[it]);
+        }
+    }
+    bool isList = !goal.values.empty();
+    bool isDiscrete = ( isList || goal.isInteger );
+    double low = ( isList ? 0 : goal.minimum );
+    double high = ( isList ? double(candidates.size()) - 1
+                    : min(goal.maximum, goal.isInteger ? floor(upperBound)
+                                                       : upperBound) );
+    if ( high < low ) {
+        return;
+    }
+    auto valueAt = [&](double position) {
+        return isList ? candidates[size_t(position)] : position;
+    };
+    auto feasibleAt = [&](double position) {
+        return isFeasible(goal, valueAt(position));
+    };
+
+    // Bracket: the feasible end of the range must be feasible,
+    //  the other end is the answer if it is feasible too
+    double feasibleEnd = ( goal.isMaximized ? low : high );
+    double otherEnd = ( goal.isMaximized ? high : low );
+    if ( feasibleAt(otherEnd) ) {
+        goal.isFound = true;
+        goal.value = valueAt(otherEnd);
+        return;
+    }
+    if ( !feasibleAt(feasibleEnd) ) {
+        return;
+    }
+
+    // A closed form bound missed by rounding is met just below it
+    if ( goal.isMaximized && !isDiscrete && upperBound <= goal.maximum
+         && high - goal.tolerance > low
+         && feasibleAt(high - goal.tolerance) ) {
+        low = high - goal.tolerance;
+    }
+
+    double step = ( isDiscrete ? 1 : goal.tolerance );
+    while ( high - low > step ) {
+        double middle = ( isDiscrete ? floor((low + high) / 2)
+                                     : (low + high) / 2 );
+        if ( feasibleAt(middle) == goal.isMaximized ) {
+            low = middle;
+        }
+        else {
+            high = middle;
+        }
+    }
+    goal.isFound = true;
+    goal.value = valueAt(goal.isMaximized ? low : high);
+}
+
+void
+GoalSeeker::writeGoals(ostream& goalFile) const
+{
+    goalFile << "Parameter,Goal,Value,Evaluations,Constraints\n";
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+    for ( unsigned int it = 0; it < goalList.size(); it++ ) {
+        const Goal& goal = goalList[it];
+        goalFile << goal.field->name << ","
+                 << ( goal.isMaximized ? "maximum" : "minimum" ) << ",";
+        if ( goal.isFound ) {
+            shortestDoubleToString(goal.value, buffer);
+            goalFile << buffer;
+        }
+        goalFile << "," << goal.nEvaluations << ",";
+        for ( unsigned int constraint = 0;
+              constraint < goal.constraints.size(); constraint++ ) {
+            goalFile << ( constraint > 0 ? "; " : "" )
+                     << goal.constraints[constraint].text;
+        }
+        goalFile << "\n";
+    }
+}
+
+void
+GoalSeeker::printGoals(ostream& output) const
+{
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+    for ( unsigned int it = 0; it < goalList.size(); it++ ) {
+        const Goal& goal = goalList[it];
+        output << goal.field->name << ": ";
+        if ( goal.isFound ) {
+            shortestDoubleToString(goal.value, buffer);
+            output << ( goal.isMaximized ? "maximum " : "minimum " )
+                   << buffer;
+        }
+        else {
+            output << "no value meets the constraints";
+        }
+        output << " (" << goal.nEvaluations << " evaluations"
+               << ( goal.isNarrowedInClosedForm ? ", closed form" : "" )
+               << ")" << endl;
+    }
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef GOALSEEKER_H
+#define GOALSEEKER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <ostream>
+
+#include "TechnologyValues.h"
+#include "DramResult.h"
+
+using namespace std;
+
+// Goal seeking around a base configuration (-solve <specification>): the
+//  largest or smallest value of one input parameter for which constraints
+//  on the results hold:
+//   {
+//     "technology": "<technology file>",
+//     "architecture": "<architecture file>",
+//     "goals": [
+//       { "maximize": "Frequency[MHz]", "minimum": 100, "maximum": 4000,
+//         "constraints": [ "CoreFrequency[MHz] <= MaxCoreFrequency[MHz]",
+//                          "tRCD[cc] <= 14" ] },
+//       { "maximize": "CellsPerSubarrayColumn[]", "minimum": 64,
+//         "maximum": 2048, "constraints": [ "tRCD[ns] <= 14" ] },
+//       { "minimize": "SubarrayToPageFactor[]", "values": [1, 2, 4, 8],
+//         "constraints": [ "CoreFrequency[MHz] <= MaxCoreFrequency[MHz]" ] }
+//     ]
+//   }
+// The constraints are taken to hold on one side of the answer only (below
+//  it when maximizing, above it when minimizing). Constraints the model
+//  gives in closed form narrow the range first, without evaluations: the
+//  clock cycles of the timings which do not depend on the frequency, and
+//  the maximum core frequency. The answer is then bracketed and bisected,
+//  over the values of a list, over the integers for counts (e.g.
+//  "CellsPerSubarrayColumn[]"), or down to a tolerance. Configurations the
+//  model rejects do not meet the constraints.
+class GoalSeeker
+{
+public:
+    enum Comparison
+    {
+        LESS,
+        LESS_EQUAL,
+        GREATER,
+        GREATER_EQUAL
+    };
+
+    struct Constraint
+    {
+        string text;
+        int valueID;
+        Comparison comparison;
+        // Bounded by another result, or by a number
+        int boundValueID;
+        double bound;
+    };
+
+    struct Goal
+    {
+        const TechnologyField* field;
+        bool isMaximized;
+        // Sorted list of values, or a range
+        vector<double> values;
+        double minimum;
+        double maximum;
+        bool isInteger;
+        double tolerance;
+        vector<Constraint> constraints;
+
+        // Answer
+        bool isFound;
+        double value;
+        unsigned int nEvaluations;
+        bool isNarrowedInClosedForm;
+    };
+
+    GoalSeeker();
+
+    void readSpecification(const string& specificationFileName);
+
+    // tolerance 0: a billionth of the range
+    void addRangeGoal(const string& name, bool isMaximized,
+                      double minimum, double maximum, double tolerance = 0);
+    void addListGoal(const string& name, bool isMaximized,
+                     const vector<double>& values);
+    // "<result> <= <number or result>", also <, >= and >
+    void addConstraint(const string& constraint);
+
+    void solve();
+
+    const vector<Goal>& goals() const { return goalList; }
+    void writeGoals(ostream& goalFile) const;
+    void printGoals(ostream& output) const;
+
+    // Base configuration and -D overrides are applied by the caller
+    //  before solving
+    TechnologyValues baseInputs;
+    bool IOTerminationCurrentFlag;
+
+private:
+    struct Evaluation
+    {
+        bool isValid;
+        DramResult result;
+    };
+
+    static bool isMet(const Constraint& constraint, const DramResult& result);
+
+    void solveGoal(Goal& goal);
+    double closedFormUpperBound(Goal& goal);
+    bool isFeasible(Goal& goal, double value);
+    const Evaluation& evaluate(Goal& goal, double value);
+
+    vector<Goal> goalList;
+    // Evaluations of the goal being solved, by parameter value
+    map<double, Evaluation> evaluations;
+};
+
+#endif // GOALSEEKER_H
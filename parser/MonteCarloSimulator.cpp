@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "MonteCarloSimulator.h"
+
+#include <cmath>
+
+#include "BatchEvaluator.h"
+
+// Results printed with their distribution
+static const int printedValueIDs[] = {
+    DramResult::TRCD, DramResult::TRAS, DramResult::TRC,
+    DramResult::IDD0, DramResult::IDD5B
+};
+
+MonteCarloSimulator::MonteCarloSimulator(bool IOTerminationCurrentFlag,
+                                         unsigned int nJobs) :
+    IOTerminationCurrentFlag(IOTerminationCurrentFlag),
+    nJobs(nJobs)
+{
+    nSamples = 10000;
+    seed = 1;
+    nRejected = 0;
+}
+
+void
+MonteCarloSimulator::readSpecification(const string& specificationFileName)
+{
+    rapidjson::Document specification;
+    string exceptionMsgThrown;
+    try {
+        baseInputs = TechnologyValues::readSpecification(
+                         specificationFileName, "Monte Carlo", "Monte Carlo specification",
+                         specification, exceptionMsgThrown);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    if ( specification.HasMember("samples") ) {
+        if ( !specification["samples"].IsUint64()
+             || specification["samples"].GetUint64() == 0 ) {
+            exceptionMsgThrown.append("gives no positive number of ");
+            exceptionMsgThrown.append("\"samples\".\n");
+            throw exceptionMsgThrown;
+        }
+        nSamples = specification["samples"].GetUint64();
+    }
+    if ( specification.HasMember("seed") ) {
+        if ( !specification["seed"].IsUint64() ) {
+            exceptionMsgThrown.append("gives no \"seed\" of a number ");
+            exceptionMsgThrown.append("from 0.\n");
+            throw exceptionMsgThrown;
+        }
+        seed = specification["seed"].GetUint64();
+    }
+
+    if ( !specification.HasMember("variations")
+         || !specification["variations"].IsObject()
+         || specification["variations"].MemberCount() == 0 ) {
+        exceptionMsgThrown.append("needs \"variations\", an object of ");
+        exceptionMsgThrown.append("input parameters.\n");
+        throw exceptionMsgThrown;
+    }
+    variations.clear();
+    const rapidjson::Value& variationList = specification["variations"];
+    for ( rapidjson::Value::ConstMemberIterator member
+                = variationList.MemberBegin();
+          member != variationList.MemberEnd(); ++member ) {
+        string name(member->name.GetString());
+        const rapidjson::Value& variation = member->value;
+        bool isNormal = variation.IsObject() && variation.HasMember("normal")
+                        && variation["normal"].IsNumber();
+        bool isUniform = variation.IsObject()
+                         && variation.HasMember("uniform")
+                         && variation["uniform"].IsArray()
+                         && variation["uniform"].Size() == 2
+                         && variation["uniform"][0].IsNumber()
+                         && variation["uniform"][1].IsNumber();
+        if ( isNormal == isUniform ) {
+            exceptionMsgThrown.append("gives \"");
+            exceptionMsgThrown.append(name);
+            exceptionMsgThrown.append("\" neither a \"normal\" relative ");
+            exceptionMsgThrown.append("deviation nor a \"uniform\" range.\n");
+            throw exceptionMsgThrown;
+        }
+        try {
+            if ( isNormal ) {
+                addNormalVariation(name, variation["normal"].GetDouble());
+            }
+            else {
+                addUniformVariation(name, variation["uniform"][0].GetDouble(),
+                                    variation["uniform"][1].GetDouble());
+            }
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+    }
+}
+
+void
+MonteCarloSimulator::addNormalVariation(const string& name,
+                                        double relativeSigma)
+{
+    Variation normal;
+    try {
+        normal.field = TechnologyValues::findContinuousField(
+                name, baseInputs, "Variation", "distribution");
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+    if ( relativeSigma < 0 ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Relative deviation of \"");
+        exceptionMsgThrown.append(name);
+        exceptionMsgThrown.append("\" must not be negative.\n");
+        throw exceptionMsgThrown;
+    }
+    normal.distribution = Variation::NORMAL;
+    normal.relativeSigma = relativeSigma;
+    normal.minimum = 0;
+    normal.maximum = 0;
+    variations.push_back(normal);
+}
+
+void
+MonteCarloSimulator::addUniformVariation(const string& name, double minimum,
+                                         double maximum)
+{
+    Variation uniform;
+    try {
+        uniform.field = TechnologyValues::findContinuousField(
+                name, baseInputs, "Variation", "distribution");
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+    if ( minimum > maximum ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Range of \"");
+        exceptionMsgThrown.append(name);
+        exceptionMsgThrown.append("\" must not end below its start.\n");
+        throw exceptionMsgThrown;
+    }
+    uniform.distribution = Variation::UNIFORM;
+    uniform.relativeSigma = 0;
+    uniform.minimum = minimum;
+    uniform.maximum = maximum;
+    variations.push_back(uniform);
+}
+
+// SplitMix64 finalizer
+static uint64_t
+mix(uint64_t value)
+{
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+}
+
+double
+MonteCarloSimulator::counterUniform(uint64_t seed, uint64_t sampleIndex,
+                                    uint64_t draw)
+{
+    const uint64_t golden = 0x9e3779b97f4a7c15ULL;
+    uint64_t value = mix(seed + golden);
+    value = mix(value ^ (sampleIndex + golden));
+    value = mix(value ^ (draw + golden));
+    return ( (value >> 11) + 0.5 ) / 9007199254740992.0;
+}
+
+TechnologyValues
+MonteCarloSimulator::sample(unsigned long sampleIndex) const
+{
+    TechnologyValues inputs(baseInputs);
+    for ( unsigned int it = 0; it < variations.size(); it++ ) {
+        const Variation& variation = variations[it];
+        double uniform = counterUniform(seed, sampleIndex, 2*it);
+        double value;
+        if ( variation.distribution == Variation::NORMAL ) {
+            // Box-Muller
+            double angle = counterUniform(seed, sampleIndex, 2*it + 1);
+            double normal = sqrt(-2 * log(uniform)) * cos(2 * M_PI * angle);
+            double nominal = variation.field->getNumber(baseInputs);
+            value = nominal + normal * variation.relativeSigma * fabs(nominal);
+        }
+        else {
+            value = variation.minimum
+                    + uniform * (variation.maximum - variation.minimum);
+        }
+        variation.field->setNumber(inputs, value);
+    }
+    return inputs;
+}
+
+bool
+MonteCarloSimulator::isClockCycles(int valueID)
+{
+    return valueID >= DramResult::TRCD_CLK && valueID <= DramResult::TREFI_CLK;
+}
+
+void
+MonteCarloSimulator::simulate()
+{
+    valueStatistics.assign(DramResult::N_VALUES, StreamingStatistics());
+    cycleHistograms.assign(DramResult::N_VALUES,
+                           map<double, unsigned long>());
+    nRejected = 0;
+
+    BatchEvaluator evaluator(nJobs);
+    vector<TechnologyValues> batch;
+    vector<DramResult> results;
+    vector<string> errors;
+    for ( unsigned long first = 0; first < nSamples; first += batchSize ) {
+        batch.clear();
+        for ( unsigned long sampleIndex = first;
+              sampleIndex < nSamples && sampleIndex < first + batchSize;
+              sampleIndex++ ) {
+            batch.push_back(sample(sampleIndex));
+        }
+        evaluator.evaluate(batch, IOTerminationCurrentFlag, results, errors);
+
+        for ( unsigned int it = 0; it < batch.size(); it++ ) {
+            if ( !errors[it].empty() ) {
+                nRejected++;
+                continue;
+            }
+            for ( int valueID = 0; valueID < DramResult::N_VALUES;
+                  valueID++ ) {
+                double value = results[it].values[valueID];
+                valueStatistics[valueID].add(value);
+                if ( isClockCycles(valueID) ) {
+                    cycleHistograms[valueID][value]++;
+                }
+            }
+        }
+    }
+}
+
+void
+MonteCarloSimulator::writeStatistics(ostream& statisticsFile) const
+{
+    const vector<QuantileEstimator>& quantiles
+            = valueStatistics[0].quantiles();
+    statisticsFile << "Result,Samples,Mean,StandardDeviation,Minimum";
+    for ( unsigned int it = 0; it < quantiles.size(); it++ ) {
+        statisticsFile << ",P" << quantiles[it].probability * 100;
+    }
+    statisticsFile << ",Maximum\n";
+
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        const StreamingStatistics& statistics = valueStatistics[valueID];
+        statisticsFile << DramResult::names[valueID] << ","
+                       << statistics.count();
+        shortestDoubleToString(statistics.mean(), buffer);
+        statisticsFile << "," << buffer;
+        shortestDoubleToString(sqrt(statistics.variance()), buffer);
+        statisticsFile << "," << buffer;
+        shortestDoubleToString(statistics.minimum(), buffer);
+        statisticsFile << "," << buffer;
+        for ( unsigned int it = 0; it < quantiles.size(); it++ ) {
+            shortestDoubleToString(statistics.quantiles()[it].quantile(),
+                                   buffer);
+            statisticsFile << "," << buffer;
+        }
+        shortestDoubleToString(statistics.maximum(), buffer);
+        statisticsFile << "," << buffer << "\n";
+    }
+}
+
+void
+MonteCarloSimulator::writeHistograms(ostream& histogramFile) const
+{
+    histogramFile << "Result,Cycles,Samples\n";
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        const map<double, unsigned long>& cycles = cycleHistograms[valueID];
+        for ( map<double, unsigned long>::const_iterator bin = cycles.begin();
+              bin != cycles.end(); ++bin ) {
+            histogramFile << DramResult::names[valueID] << ","
+                          << bin->first << "," << bin->second << "\n";
+        }
+    }
+}
+
+void
+MonteCarloSimulator::printStatistics(ostream& output) const
+{
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+    for ( unsigned int printed = 0;
+          printed < sizeof(printedValueIDs) / sizeof(printedValueIDs[0]);
+          printed++ ) {
+        const StreamingStatistics& statistics
+                = valueStatistics[printedValueIDs[printed]];
+        output << DramResult::names[printedValueIDs[printed]] << ": mean ";
+        shortestDoubleToString(statistics.mean(), buffer);
+        output << buffer << ", sigma ";
+        shortestDoubleToString(sqrt(statistics.variance()), buffer);
+        output << buffer;
+        for ( unsigned int it = 0; it < statistics.quantiles().size(); it++ ) {
+            const QuantileEstimator& estimator = statistics.quantiles()[it];
+            shortestDoubleToString(estimator.quantile(), buffer);
+            output << ", P" << estimator.probability * 100 << " " << buffer;
+        }
+        output << endl;
+    }
+    output << nSamples << " samples of " << variations.size()
+           << " variations, " << nRejected << " rejected by the model"
+           << endl;
+}
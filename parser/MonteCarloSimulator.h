@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef MONTECARLOSIMULATOR_H
+#define MONTECARLOSIMULATOR_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <ostream>
+#include <cstdint>
+
+#include "TechnologyValues.h"
+#include "DramResult.h"
+#include "StreamingStatistics.h"
+
+using namespace std;
+
+// Random variation of one input parameter
+struct Variation
+{
+    enum Distribution { NORMAL, UNIFORM };
+
+    const TechnologyField* field;
+    Distribution distribution;
+    // Normal: standard deviation relative to the value of the parameter
+    double relativeSigma;
+    // Uniform: range in the unit of the JSON member
+    double minimum;
+    double maximum;
+};
+
+// Distributions of the results under random variation of input
+//  parameters (-montecarlo <specification>):
+//   {
+//     "technology": "<technology file>",
+//     "architecture": "<architecture file>",
+//     "samples": 100000,
+//     "seed": 1,
+//     "variations": {
+//       "CellCapacitance[fF]": { "normal": 0.05 },
+//       "Temperature[C]": { "uniform": [25, 80] }
+//     }
+//   }
+// "normal" gives a standard deviation relative to the value, "uniform" a
+//  range.
+// The random numbers of a sample are drawn from a counter-based generator:
+//  they are a hash of the seed, the sample index and the variation, so a
+//  sample is the same whichever thread evaluates it. Samples are
+//  evaluated in batches on several threads, and their results are added
+//  to the statistics in sample order, so the statistics do not depend on
+//  the number of threads either. No sample is stored.
+class MonteCarloSimulator
+{
+public:
+    MonteCarloSimulator(bool IOTerminationCurrentFlag, unsigned int nJobs);
+
+    void readSpecification(const string& specificationFileName);
+
+    void addNormalVariation(const string& name, double relativeSigma);
+    void addUniformVariation(const string& name, double minimum,
+                             double maximum);
+
+    void simulate();
+
+    // Input parameters of one sample
+    TechnologyValues sample(unsigned long sampleIndex) const;
+
+    // Uniform number in (0, 1) of a counter: a hash of the seed, the
+    //  sample and the draw within the sample
+    static double counterUniform(uint64_t seed, uint64_t sampleIndex,
+                                 uint64_t draw);
+
+    const StreamingStatistics& statistics(int valueID) const
+        { return valueStatistics[valueID]; }
+    // Number of samples of each clock cycle count
+    const map<double, unsigned long>& histogram(int valueID) const
+        { return cycleHistograms[valueID]; }
+    static bool isClockCycles(int valueID);
+
+    void writeStatistics(ostream& statisticsFile) const;
+    void writeHistograms(ostream& histogramFile) const;
+    void printStatistics(ostream& output) const;
+
+    // Base configuration, -D overrides are applied by the caller
+    TechnologyValues baseInputs;
+
+    unsigned long nSamples;
+    uint64_t seed;
+    // Samples which the model rejects, left out of the statistics
+    unsigned long nRejected;
+
+    // Samples evaluated at once
+    static const unsigned int batchSize = 1024;
+
+private:
+    bool IOTerminationCurrentFlag;
+    unsigned int nJobs;
+    vector<Variation> variations;
+
+    vector<StreamingStatistics> valueStatistics;
+    vector<map<double, unsigned long> > cycleHistograms;
+};
+
+#endif // MONTECARLOSIMULATOR_H
@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "Nsga2.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+Nsga2::Nsga2(const vector<Gene>& genes, unsigned int populationSize,
+             unsigned long long seed) :
+    genes(genes),
+    populationSize(populationSize),
+    generator(seed)
+{
+    crossoverProbability = 0.9;
+    crossoverDistributionIndex = 15.0;
+    mutationDistributionIndex = 20.0;
+}
+
+double
+Nsga2::uniform()
+{
+    // 53 random bits in [0, 1)
+    return (generator() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+unsigned int
+Nsga2::uniformIndex(unsigned int nValues)
+{
+    return generator() % nValues;
+}
+
+vector<Nsga2::Individual>
+Nsga2::initialPopulation()
+{
+    vector<Individual> individuals(populationSize);
+    for ( unsigned int it = 0; it < populationSize; it++ ) {
+        for ( unsigned int gene = 0; gene < genes.size(); gene++ ) {
+            if ( genes[gene].nValues > 0 ) {
+                individuals[it].genes.push_back(
+                                        uniformIndex(genes[gene].nValues));
+            }
+            else {
+                individuals[it].genes.push_back(genes[gene].minimum
+                    + uniform() * (genes[gene].maximum - genes[gene].minimum));
+            }
+        }
+    }
+    return individuals;
+}
+
+vector<Nsga2::Individual>
+Nsga2::makeOffspring()
+{
+    vector<Individual> offspring;
+    while ( offspring.size() < populationSize ) {
+        Individual first(tournament());
+        Individual second(tournament());
+        if ( uniform() < crossoverProbability ) {
+            crossover(first, second);
+        }
+        mutate(first);
+        mutate(second);
+        offspring.push_back(first);
+        if ( offspring.size() < populationSize ) {
+            offspring.push_back(second);
+        }
+    }
+    return offspring;
+}
+
+const Nsga2::Individual&
+Nsga2::tournament()
+{
+    const Individual& first =
+                        currentPopulation[uniformIndex(populationSize)];
+    const Individual& second =
+                        currentPopulation[uniformIndex(populationSize)];
+    if ( second.rank < first.rank
+         || ( second.rank == first.rank
+              && second.crowdingDistance > first.crowdingDistance ) ) {
+        return second;
+    }
+    return first;
+}
+
+double
+Nsga2::crossoverChild(double lower, double upper, double bound,
+                      double u) const
+{
+    // Simulated binary crossover: the child spreads away from the parents
+    //  towards the bound (the minimum or the maximum of the gene), with
+    //  the spread limited so that it stays within the bound
+    double spread = upper - lower;
+    double direction = ( bound < upper ? -1.0 : 1.0 );
+    double distance = ( direction < 0 ? lower - bound : bound - upper );
+    double beta = 1.0 + 2.0 * distance / spread;
+    double alpha = 2.0 - pow(beta, -(crossoverDistributionIndex + 1.0));
+    double betaQ;
+    if ( u <= 1.0 / alpha ) {
+        betaQ = pow(u * alpha, 1.0 / (crossoverDistributionIndex + 1.0));
+    }
+    else {
+        betaQ = pow(1.0 / (2.0 - u * alpha),
+                    1.0 / (crossoverDistributionIndex + 1.0));
+    }
+    return 0.5 * ((lower + upper) + direction * betaQ * spread);
+}
+
+void
+Nsga2::crossover(Individual& first, Individual& second)
+{
+    for ( unsigned int gene = 0; gene < genes.size(); gene++ ) {
+        double& value1 = first.genes[gene];
+        double& value2 = second.genes[gene];
+        if ( genes[gene].nValues > 0 ) {
+            // Uniform crossover of discrete genes
+            if ( uniform() < 0.5 ) {
+                swap(value1, value2);
+            }
+            continue;
+        }
+        if ( uniform() >= 0.5 || fabs(value1 - value2) < 1e-14 ) {
+            continue;
+        }
+        double lower = min(value1, value2);
+        double upper = max(value1, value2);
+        double u = uniform();
+        double child1 = crossoverChild(lower, upper, genes[gene].minimum, u);
+        double child2 = crossoverChild(lower, upper, genes[gene].maximum, u);
+        child1 = min(max(child1, genes[gene].minimum), genes[gene].maximum);
+        child2 = min(max(child2, genes[gene].minimum), genes[gene].maximum);
+        if ( uniform() < 0.5 ) {
+            swap(child1, child2);
+        }
+        value1 = child1;
+        value2 = child2;
+    }
+}
+
+void
+Nsga2::mutate(Individual& individual)
+{
+    double mutationProbability = 1.0 / genes.size();
+    for ( unsigned int gene = 0; gene < genes.size(); gene++ ) {
+        if ( uniform() >= mutationProbability ) {
+            continue;
+        }
+        double& value = individual.genes[gene];
+        if ( genes[gene].nValues > 0 ) {
+            // Any other value of a discrete gene
+            if ( genes[gene].nValues > 1 ) {
+                unsigned int other = uniformIndex(genes[gene].nValues - 1);
+                value = ( other >= value ? other + 1 : other );
+            }
+            continue;
+        }
+
+        // Polynomial mutation of continuous genes
+        double range = genes[gene].maximum - genes[gene].minimum;
+        if ( range <= 0 ) {
+            continue;
+        }
+        double exponent = 1.0 / (mutationDistributionIndex + 1.0);
+        double u = uniform();
+        double delta;
+        if ( u < 0.5 ) {
+            double distance = 1.0 - (value - genes[gene].minimum) / range;
+            delta = pow(2.0*u + (1.0 - 2.0*u)
+                        * pow(distance, mutationDistributionIndex + 1.0),
+                        exponent) - 1.0;
+        }
+        else {
+            double distance = 1.0 - (genes[gene].maximum - value) / range;
+            delta = 1.0 - pow(2.0*(1.0 - u) + 2.0*(u - 0.5)
+                              * pow(distance, mutationDistributionIndex + 1.0),
+                              exponent);
+        }
+        value = min(max(value + delta * range, genes[gene].minimum),
+                    genes[gene].maximum);
+    }
+}
+
+bool
+Nsga2::dominates(const Individual& first, const Individual& second)
+{
+    if ( first.isFeasible != second.isFeasible ) {
+        return first.isFeasible;
+    }
+    if ( !first.isFeasible ) {
+        return false;
+    }
+    bool isBetter = false;
+    for ( unsigned int it = 0; it < first.objectiveValues.size(); it++ ) {
+        if ( first.objectiveValues[it] > second.objectiveValues[it] ) {
+            return false;
+        }
+        if ( first.objectiveValues[it] < second.objectiveValues[it] ) {
+            isBetter = true;
+        }
+    }
+    return isBetter;
+}
+
+vector<vector<unsigned int> >
+Nsga2::sortFronts(vector<Individual>& individuals)
+{
+    // Fast non-dominated sorting
+    vector<vector<unsigned int> > dominatedBy(individuals.size());
+    vector<unsigned int> nDominating(individuals.size(), 0);
+    vector<vector<unsigned int> > fronts(1);
+    for ( unsigned int first = 0; first < individuals.size(); first++ ) {
+        for ( unsigned int second = 0; second < individuals.size();
+              second++ ) {
+            if ( dominates(individuals[first], individuals[second]) ) {
+                dominatedBy[first].push_back(second);
+            }
+            else if ( dominates(individuals[second], individuals[first]) ) {
+                nDominating[first]++;
+            }
+        }
+        if ( nDominating[first] == 0 ) {
+            individuals[first].rank = 0;
+            fronts[0].push_back(first);
+        }
+    }
+
+    while ( !fronts.back().empty() ) {
+        vector<unsigned int> nextFront;
+        const vector<unsigned int>& front = fronts.back();
+        for ( unsigned int it = 0; it < front.size(); it++ ) {
+            const vector<unsigned int>& dominated = dominatedBy[front[it]];
+            for ( unsigned int next = 0; next < dominated.size(); next++ ) {
+                if ( --nDominating[dominated[next]] == 0 ) {
+                    individuals[dominated[next]].rank = fronts.size();
+                    nextFront.push_back(dominated[next]);
+                }
+            }
+        }
+        sort(nextFront.begin(), nextFront.end());
+        fronts.push_back(nextFront);
+    }
+    fronts.pop_back();
+    return fronts;
+}
+
+void
+Nsga2::assignCrowdingDistances(vector<Individual>& individuals,
+                               const vector<unsigned int>& front)
+{
+    for ( unsigned int it = 0; it < front.size(); it++ ) {
+        individuals[front[it]].crowdingDistance = 0;
+    }
+    // Infeasible individuals have no objective values to spread
+    if ( front.empty() || !individuals[front[0]].isFeasible ) {
+        return;
+    }
+
+    const double infinity = numeric_limits<double>::infinity();
+    unsigned int nObjectives = individuals[front[0]].objectiveValues.size();
+    vector<unsigned int> sorted(front);
+    for ( unsigned int obj = 0; obj < nObjectives; obj++ ) {
+        stable_sort(sorted.begin(), sorted.end(),
+                    [&](unsigned int first, unsigned int second)
+                        { return individuals[first].objectiveValues[obj]
+                                 < individuals[second].objectiveValues[obj]; });
+        double lowest = individuals[sorted.front()].objectiveValues[obj];
+        double highest = individuals[sorted.back()].objectiveValues[obj];
+        individuals[sorted.front()].crowdingDistance = infinity;
+        individuals[sorted.back()].crowdingDistance = infinity;
+        if ( highest <= lowest ) {
+            continue;
+        }
+        for ( unsigned int it = 1; it + 1 < sorted.size(); it++ ) {
+            individuals[sorted[it]].crowdingDistance +=
+                ( individuals[sorted[it+1]].objectiveValues[obj]
+                  - individuals[sorted[it-1]].objectiveValues[obj] )
+                / ( highest - lowest );
+        }
+    }
+}
+
+void
+Nsga2::select(const vector<Individual>& candidates)
+{
+    vector<Individual> combined(currentPopulation);
+    combined.insert(combined.end(), candidates.begin(), candidates.end());
+
+    vector<vector<unsigned int> > fronts = sortFronts(combined);
+    vector<Individual> selected;
+    for ( unsigned int rank = 0;
+          rank < fronts.size() && selected.size() < populationSize;
+          rank++ ) {
+        vector<unsigned int>& front = fronts[rank];
+        assignCrowdingDistances(combined, front);
+        // The least crowded individuals of the last front fit in
+        if ( selected.size() + front.size() > populationSize ) {
+            stable_sort(front.begin(), front.end(),
+                        [&](unsigned int first, unsigned int second)
+                            { return combined[first].crowdingDistance
+                                     > combined[second].crowdingDistance; });
+            front.resize(populationSize - selected.size());
+        }
+        for ( unsigned int it = 0; it < front.size(); it++ ) {
+            selected.push_back(combined[front[it]]);
+        }
+    }
+    currentPopulation.swap(selected);
+}
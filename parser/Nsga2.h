@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef NSGA2_H
+#define NSGA2_H
+
+#include <vector>
+#include <random>
+
+using namespace std;
+
+// Elitist non-dominated sorting genetic algorithm (NSGA-II, Deb et al.)
+//  over a genome of discrete and continuous genes. The caller evaluates
+//  the individuals; the algorithm only ranks and breeds them:
+//   candidates = initialPopulation();
+//   evaluate(candidates); select(candidates);
+//   for each generation:
+//       candidates = makeOffspring();
+//       evaluate(candidates); select(candidates);
+// Infeasible individuals are dominated by every feasible one
+//  (constrained domination). All random numbers come from one generator
+//  seeded by the caller, so a search is reproducible from its seed.
+class Nsga2
+{
+public:
+    struct Gene
+    {
+        // Discrete gene: index into nValues values, continuous gene
+        //  (nValues = 0): value in [minimum, maximum]
+        unsigned int nValues;
+        double minimum;
+        double maximum;
+    };
+
+    struct Individual
+    {
+        vector<double> genes;
+        // Set by the caller's evaluation, smaller is better
+        bool isFeasible;
+        vector<double> objectiveValues;
+        // Set by select()
+        unsigned int rank;
+        double crowdingDistance;
+    };
+
+    Nsga2(const vector<Gene>& genes, unsigned int populationSize,
+          unsigned long long seed);
+
+    // Random individuals of the first generation
+    vector<Individual> initialPopulation();
+    // Children of the population by binary tournament, crossover
+    //  and mutation
+    vector<Individual> makeOffspring();
+    // Keeps the best individuals of the population and the evaluated
+    //  candidates
+    void select(const vector<Individual>& candidates);
+
+    const vector<Individual>& population() const { return currentPopulation; }
+
+    static bool dominates(const Individual& first, const Individual& second);
+
+    // Distribution indices of the simulated binary crossover and of the
+    //  polynomial mutation of continuous genes
+    double crossoverProbability;
+    double crossoverDistributionIndex;
+    double mutationDistributionIndex;
+
+private:
+    // Platform independent distributions, the ones of the standard
+    //  library may differ between implementations
+    double uniform();
+    unsigned int uniformIndex(unsigned int nValues);
+
+    const Individual& tournament();
+    void crossover(Individual& first, Individual& second);
+    void mutate(Individual& individual);
+    double crossoverChild(double lower, double upper,
+                          double bound, double u) const;
+
+    static vector<vector<unsigned int> >
+        sortFronts(vector<Individual>& individuals);
+    static void assignCrowdingDistances(vector<Individual>& individuals,
+                                        const vector<unsigned int>& front);
+
+    vector<Gene> genes;
+    unsigned int populationSize;
+    mt19937_64 generator;
+    vector<Individual> currentPopulation;
+};
+
+#endif // NSGA2_H
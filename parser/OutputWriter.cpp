@@ -0,0 +1,449 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "OutputWriter.h"
+
+#include <chrono>
+#include <cstdlib>
+
+OutputWriter::OutputWriter(ostringstream& outputStream, size_t queueCapacity) :
+    output(outputStream),
+    journal(NULL),
+    cache(NULL),
+    queue(queueCapacity),
+    producerDone(false),
+    nStalls(0)
+{
+}
+
+OutputWriter::~OutputWriter()
+{
+    stopWriterThread();
+}
+
+void
+OutputWriter::start()
+{
+    writerThread = thread(&OutputWriter::run, this);
+}
+
+void
+OutputWriter::push(DramResult& result)
+{
+    if ( queue.tryPush(result) ) {
+        return;
+    }
+
+    // Queue is full: the writer is behind, wait for a free slot
+    nStalls++;
+    while ( !queue.tryPush(result) ) {
+        this_thread::yield();
+    }
+}
+
+void
+OutputWriter::finish()
+{
+    stopWriterThread();
+
+    if ( !writerError.empty() ) {
+        throw writerError;
+    }
+}
+
+void
+OutputWriter::stopWriterThread()
+{
+    if ( writerThread.joinable() ) {
+        producerDone.store(true, memory_order_release);
+        writerThread.join();
+    }
+}
+
+void
+OutputWriter::attachJournal(CheckpointJournal* checkpointJournal)
+{
+    journal = checkpointJournal;
+}
+
+void
+OutputWriter::attachCache(const ResultCache* resultCache)
+{
+    cache = resultCache;
+}
+
+void
+OutputWriter::commitCheckpoint()
+{
+    // Rows must be on disk before the journal declares them completed
+    if ( shardTable.is_open() ) {
+        shardTable.flush();
+        syncFileToDisk(shardTableFileName.c_str());
+    }
+    journal->commit();
+}
+
+void
+OutputWriter::openShardTable(const string& fileName,
+                             const CheckpointJournal* resumeJournal)
+{
+    shardTableFileName = fileName;
+
+    // Rows kept from the interrupted run (resume)
+    string keptRows;
+    if ( resumeJournal != NULL ) {
+        ifstream previousTable(fileName);
+        string line;
+        getline(previousTable, line); // Header
+        while ( getCsvRecord(previousTable, line) ) {
+            if ( previousTable.eof() ) {
+                break; // Torn last row
+            }
+            unsigned long configID = strtoul(line.c_str(), NULL, 10);
+            if ( resumeJournal->hasEntry(configID) ) {
+                keptRows.append(line);
+                keptRows.append("\n");
+            }
+        }
+    }
+
+    shardTable.open(fileName, ofstream::trunc);
+    if ( !shardTable.is_open() ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Could not create shard result file \'");
+        exceptionMsgThrown.append(fileName);
+        exceptionMsgThrown.append("\'.\n");
+        throw exceptionMsgThrown;
+    }
+
+    shardTable << "Configuration,Technology filename,Parameter filename";
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        shardTable << "," << DramResult::labels[valueID];
+    }
+    shardTable << "\n";
+    shardTable << keptRows;
+}
+
+void
+OutputWriter::run()
+{
+    DramResult result;
+    unsigned int nIdleRounds = 0;
+
+    try {
+        while ( true ) {
+            if ( queue.tryPop(result) ) {
+                writeResult(result);
+                nIdleRounds = 0;
+                continue;
+            }
+
+            if ( producerDone.load(memory_order_acquire) ) {
+                // Results pushed right before the producer finished
+                while ( queue.tryPop(result) ) {
+                    writeResult(result);
+                }
+                if ( journal != NULL ) {
+                    commitCheckpoint();
+                }
+                break;
+            }
+
+            // Nothing to write: checkpoint what has been written so far,
+            //  then spin shortly and back off
+            if ( journal != NULL && journal->hasPendingRecords() ) {
+                commitCheckpoint();
+            }
+            if ( nIdleRounds < 64 ) {
+                nIdleRounds++;
+                this_thread::yield();
+            } else {
+                this_thread::sleep_for(chrono::microseconds(100));
+            }
+        }
+    } catch(string exceptionMsgThrown) {
+        writerError = exceptionMsgThrown;
+        discardUntilProducerDone();
+    } catch(...) {
+        // E.g. bad_alloc or a stream exception, which would otherwise
+        //  terminate the program on this thread
+        writerError = "[ERROR] Unexpected failure while writing the "
+                      "results.\n";
+        discardUntilProducerDone();
+    }
+}
+
+void
+OutputWriter::discardUntilProducerDone()
+{
+    // Keep the producer from waiting forever on a full queue
+    DramResult result;
+    while ( !producerDone.load(memory_order_acquire) ) {
+        while ( queue.tryPop(result) ) {}
+        this_thread::yield();
+    }
+}
+
+void
+OutputWriter::writeResult(const DramResult& result)
+{
+    jsonOutputWrite(result);
+
+    arrangeOutput(result);
+
+    ofstream csvResultFile;
+    string csvResultFileName("results_for_config_");
+    csvResultFileName.append(to_string(result.configID));
+    csvResultFileName.append(".csv");
+    csvResultFile.open(csvResultFileName, ofstream::trunc);
+
+    csvResultFile << "Label,"
+                  << "Technology filename: " << result.technologyFileName
+                  << "  Parameter filename: " << result.architectureFileName
+                  << endl;
+    csvResultFile << formatter.csvTable();
+    csvResultFile.close();
+
+    if ( shardTable.is_open() ) {
+        shardTableWrite(result);
+    }
+
+    if ( cache != NULL && result.wasEvaluated ) {
+        cache->storeOnDisk(result);
+    }
+
+    if ( journal != NULL ) {
+        journal->record(result);
+        if ( journal->isBatchFull() ) {
+            commitCheckpoint();
+        }
+    }
+
+    output << "DRAM Configuration: "
+           << result.configID+1
+           << endl;
+    output << "\tTechnology filename: "
+           << result.technologyFileName
+           << endl;
+    output << "\tParameter filename:  "
+           << result.architectureFileName
+           << endl;
+    output << result.warning;
+
+    output << formatter.stdoutTable() << endl;
+
+    output  << "_______________________________________________________"
+            << "_______________________________________________________"
+            << "_______________________________________________________"
+            << endl;
+}
+
+//function for building the csv and stdout result tables in a single pass
+void
+OutputWriter::arrangeOutput(const DramResult& result)
+{
+    formatter.clear();
+
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        formatter.appendLine(DramResult::labels[valueID],
+                             result.values[valueID]);
+    }
+}
+
+//function for writing one row of the shard result table
+void
+OutputWriter::shardTableWrite(const DramResult& result)
+{
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+
+    string row(to_string(result.configID));
+    row.push_back(',');
+    appendCsvFileNames(row, result.technologyFileName,
+                       result.architectureFileName);
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        int length = shortestDoubleToString(result.values[valueID], buffer);
+        row.push_back(',');
+        row.append(buffer, length);
+    }
+    row.push_back('\n');
+    shardTable << row;
+}
+
+//function for writing results in json
+void
+OutputWriter::jsonOutputWrite(const DramResult& result)
+{
+    const double* values = result.values;
+
+    //parsing the timing results in ns
+    rapidjson::Document timingnsdoc;
+    timingnsdoc.SetObject();
+
+    timingnsdoc.AddMember(
+          "trcd",   values[DramResult::TRCD],   timingnsdoc.GetAllocator());
+    timingnsdoc.AddMember(
+          "tcl",    values[DramResult::TCAS],   timingnsdoc.GetAllocator());
+    timingnsdoc.AddMember(
+          "tras",   values[DramResult::TRAS],   timingnsdoc.GetAllocator());
+    timingnsdoc.AddMember(
+          "trp",    values[DramResult::TRP],    timingnsdoc.GetAllocator());
+    timingnsdoc.AddMember(
+          "trc",    values[DramResult::TRC],    timingnsdoc.GetAllocator());
+    timingnsdoc.AddMember(
+          "trl",    values[DramResult::TRL],    timingnsdoc.GetAllocator());
+    timingnsdoc.AddMember(
+          "trtp",   values[DramResult::TRTP],   timingnsdoc.GetAllocator());
+    timingnsdoc.AddMember(
+          "tccd",   values[DramResult::TCCD],   timingnsdoc.GetAllocator());
+    timingnsdoc.AddMember(
+          "twr",    values[DramResult::TWR],    timingnsdoc.GetAllocator());
+    timingnsdoc.AddMember(
+          "trfc",   values[DramResult::TRFC],   timingnsdoc.GetAllocator());
+    timingnsdoc.AddMember(
+          "trefI",  values[DramResult::TREFI],  timingnsdoc.GetAllocator());
+
+    // Convert JSON document to string
+    rapidjson::GenericStringBuffer< rapidjson::UTF8<> > timingnsbuffer;
+    rapidjson::Writer< rapidjson::GenericStringBuffer<
+    rapidjson::UTF8<> > > timingnswriter(timingnsbuffer);
+    timingnsdoc.Accept(timingnswriter);
+    const char* timingnsstr = timingnsbuffer.GetString();
+
+    //open a file
+    stringstream timingnsresstr;
+    timingnsresstr << string("timingnsresult_")
+                   << result.configID+1
+                   << string(".json");
+    ofstream timingnsresultfile(timingnsresstr.str().c_str());
+    timingnsresultfile << timingnsstr;
+    timingnsresultfile.close();
+
+    //parsing the timing results in clock cycles
+    rapidjson::Document timingsDoc;
+    timingsDoc.SetObject();
+
+    timingsDoc.AddMember(
+          "Frequency",  values[DramResult::DRAM_FREQ],   timingsDoc.GetAllocator());
+    timingsDoc.AddMember(
+          "trcd_cc",    values[DramResult::TRCD_CLK] ,  timingsDoc.GetAllocator());
+    timingsDoc.AddMember(
+          "tcl_cc",     values[DramResult::TCAS_CLK] ,  timingsDoc.GetAllocator());
+    timingsDoc.AddMember(
+          "tras_cc",    values[DramResult::TRAS_CLK] ,  timingsDoc.GetAllocator());
+    timingsDoc.AddMember(
+          "trp_cc",     values[DramResult::TRP_CLK] ,   timingsDoc.GetAllocator());
+    timingsDoc.AddMember(
+          "trc_cc",     values[DramResult::TRC_CLK] ,   timingsDoc.GetAllocator());
+    timingsDoc.AddMember(
+          "trl_cc",     values[DramResult::TRL_CLK] ,   timingsDoc.GetAllocator());
+    timingsDoc.AddMember(
+          "twl_cc",     values[DramResult::TRL_CLK] - 1 ,   timingsDoc.GetAllocator());
+    timingsDoc.AddMember(
+          "trtp_cc",    values[DramResult::TRTP_CLK] ,  timingsDoc.GetAllocator());
+    timingsDoc.AddMember(
+          "tccd_cc",    values[DramResult::TCCD_CLK] ,  timingsDoc.GetAllocator());
+    timingsDoc.AddMember(
+          "twr_cc",     values[DramResult::TWR_CLK] ,   timingsDoc.GetAllocator());
+    timingsDoc.AddMember(
+          "trfc_cc",    values[DramResult::TRFC_CLK] ,  timingsDoc.GetAllocator());
+    timingsDoc.AddMember(
+          "trefI_cc",   values[DramResult::TREFI_CLK] , timingsDoc.GetAllocator());
+
+    // Convert JSON document to string
+    rapidjson::GenericStringBuffer< rapidjson::UTF8<> > timingbuffer;
+    rapidjson::Writer< rapidjson::GenericStringBuffer<
+    rapidjson::UTF8<> > > timingwriter(timingbuffer);
+    timingsDoc.Accept(timingwriter);
+    const char* timingstr = timingbuffer.GetString();
+
+    //Placing timing results (in clock cycles) in different files according to file number
+    stringstream timingresstr;
+    timingresstr << string("timingresult_")
+                 << result.configID+1
+                 << string(".json");
+    ofstream timingresultfile(timingresstr.str().c_str());
+    timingresultfile << timingstr;
+    timingresultfile.close();
+
+    //parsing the currents
+    rapidjson::Document currentdoc;
+    currentdoc.SetObject();
+
+    currentdoc.AddMember(
+          "IDD0",   values[DramResult::IDD0],   currentdoc.GetAllocator());
+    currentdoc.AddMember(
+          "IPP0",   values[DramResult::IPP0],   currentdoc.GetAllocator());
+    currentdoc.AddMember(
+          "IDD1",   values[DramResult::IDD1],   currentdoc.GetAllocator());
+    currentdoc.AddMember(
+          "IPP1",   values[DramResult::IPP0],   currentdoc.GetAllocator());
+    currentdoc.AddMember(
+          "IDD4R",  values[DramResult::IDD4R],  currentdoc.GetAllocator());
+    currentdoc.AddMember(
+          "IDD4W",  values[DramResult::IDD4W],  currentdoc.GetAllocator());
+    currentdoc.AddMember(
+          "IDD2n",  values[DramResult::IDD2N],  currentdoc.GetAllocator());
+    currentdoc.AddMember(
+          "IDD3n",  values[DramResult::IDD3N],  currentdoc.GetAllocator());
+    currentdoc.AddMember(
+          "IPP3n",  values[DramResult::IPP3N],  currentdoc.GetAllocator());
+    currentdoc.AddMember(
+          "Rho",    values[DramResult::RHO],            currentdoc.GetAllocator());
+    currentdoc.AddMember(
+          "IDD5B",  values[DramResult::IDD5B],  currentdoc.GetAllocator());
+    currentdoc.AddMember(
+          "IPP5B",  values[DramResult::IPP5B],  currentdoc.GetAllocator());
+
+    //convert JSON document to string
+    rapidjson::GenericStringBuffer< rapidjson::UTF8<> > currentbuffer;
+    rapidjson::Writer< rapidjson::GenericStringBuffer
+    < rapidjson::UTF8<> > > currentwriter(currentbuffer);
+    currentdoc.Accept(currentwriter);
+    const char* currentstr = currentbuffer.GetString();
+
+    //Placing current results in different files according to file number
+    stringstream currentresstr;
+    currentresstr << string("currentresult_")
+                  << result.configID+1
+                  << string(".json");
+    ofstream currentresultfile(currentresstr.str().c_str());
+    currentresultfile << currentstr;
+    currentresultfile.close();
+}
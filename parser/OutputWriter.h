@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef OUTPUTWRITER_H
+#define OUTPUTWRITER_H
+
+#include <sstream>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <atomic>
+
+#include "DramResult.h"
+#include "CheckpointJournal.h"
+#include "ResultCache.h"
+#include "ResultFormatter.h"
+#include "../utils/BoundedQueue.h"
+
+#include "rapidjson/include/rapidjson/document.h"
+#include "rapidjson/include/rapidjson/prettywriter.h"
+#include "rapidjson/include/rapidjson/stringbuffer.h"
+
+using namespace std;
+
+// Output stage of a run.
+// Results are handed over through a bounded lock-free queue to a dedicated
+//  thread, which formats them and writes the result files, so that the
+//  computation never waits on file I/O unless the queue is full.
+class OutputWriter
+{
+public:
+    OutputWriter(ostringstream& outputStream, size_t queueCapacity);
+    ~OutputWriter();
+
+    // Starts the writer thread, after the shard table, the journal and
+    //  the cache are set up, and before the first push.
+    void start();
+
+    // Called by the computing thread. The result is moved into the queue.
+    void push(DramResult& result);
+
+    // Writes all pending results and stops the writer thread.
+    // Throws if the writer thread failed to write a result.
+    void finish();
+
+    // Additionally collect every result as one row of a single table,
+    //  as done by sharded runs. Must be called before start().
+    // When resuming, the rows of the table which are not listed in the
+    //  journal of the interrupted run are dropped and new rows are appended.
+    void openShardTable(const string& fileName,
+                        const CheckpointJournal* resumeJournal = NULL);
+
+    // Record every written result in the checkpoint journal.
+    // Must be called before start().
+    void attachJournal(CheckpointJournal* checkpointJournal);
+
+    // Store every evaluated result in the on-disk result cache.
+    // Must be called before start().
+    void attachCache(const ResultCache* resultCache);
+
+    size_t queueCapacity() const { return queue.capacity(); }
+    size_t queueHighWaterMark() const { return queue.highWaterMark(); }
+    unsigned long queueStalls() const { return nStalls; }
+
+private:
+    void run();
+    void stopWriterThread();
+    void discardUntilProducerDone();
+    void commitCheckpoint();
+
+    void writeResult(const DramResult& result);
+    void jsonOutputWrite(const DramResult& result);
+    void arrangeOutput(const DramResult& result);
+    void shardTableWrite(const DramResult& result);
+
+    ostringstream& output;
+    ResultFormatter formatter;
+    ofstream shardTable;
+    string shardTableFileName;
+    CheckpointJournal* journal;
+    const ResultCache* cache;
+
+    BoundedQueue<DramResult> queue;
+    atomic<bool> producerDone;
+    unsigned long nStalls;
+    // Set by the writer thread if it could not write the results
+    string writerError;
+    thread writerThread;
+};
+
+#endif // OUTPUTWRITER_H
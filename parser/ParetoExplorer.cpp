@@ -0,0 +1,684 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "ParetoExplorer.h"
+
+#include <algorithm>
+
+#include "../core/Current.h"
+
+// Relationships which hold in the model for any technology: the value
+//  does not decrease when the parameter increases (direction +1).
+//  CellsPerSubarrayColumn only enters the timings through the local
+//  bitline delay and the local bitline in the subarray height.
+struct KnownMonotonicity
+{
+    const char* parameterName;
+    int valueID;
+    int direction;
+};
+
+static const KnownMonotonicity knownMonotonicities[] = {
+    { "CellsPerSubarrayColumn[]", DramResult::TRCD,            +1 },
+    { "CellsPerSubarrayColumn[]", DramResult::TRCD_CLK,        +1 },
+    { "CellsPerSubarrayColumn[]", DramResult::TRP,             +1 },
+    { "CellsPerSubarrayColumn[]", DramResult::TRP_CLK,         +1 },
+    { "CellsPerSubarrayColumn[]", DramResult::SUBARRAY_HEIGHT, +1 },
+    { "CellsPerSubarrayRow[]",    DramResult::SUBARRAY_WIDTH,  +1 }
+};
+
+ParetoExplorer::ParetoExplorer()
+{
+    IOTerminationCurrentFlag = false;
+    nEvaluated = 0;
+    nInvalid = 0;
+    nSkipped = 0;
+    nJobs = 0;
+    isEvolutionary = false;
+    populationSize = 0;
+    nGenerations = 0;
+    seed = 0;
+}
+
+void
+ParetoExplorer::readSpecification(const string& specificationFileName)
+{
+    rapidjson::Document specification;
+    string exceptionMsgThrown;
+    try {
+        baseInputs = TechnologyValues::readSpecification(
+                         specificationFileName, "exploration", "Exploration",
+                         specification, exceptionMsgThrown);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    if ( !specification.HasMember("parameters")
+         || !specification["parameters"].IsObject()
+         || specification["parameters"].MemberCount() == 0 ) {
+        exceptionMsgThrown.append("needs \"parameters\", ");
+        exceptionMsgThrown.append("an object of value lists or ranges.\n");
+        throw exceptionMsgThrown;
+    }
+    const rapidjson::Value& parameterList = specification["parameters"];
+    for ( rapidjson::Value::ConstMemberIterator member =
+              parameterList.MemberBegin();
+          member != parameterList.MemberEnd(); ++member ) {
+        string name(member->name.GetString());
+        const rapidjson::Value& range = member->value;
+        if ( range.IsObject() ) {
+            if ( !range.HasMember("minimum") || !range["minimum"].IsNumber()
+                 || !range.HasMember("maximum")
+                 || !range["maximum"].IsNumber()
+                 || range["minimum"].GetDouble()
+                    > range["maximum"].GetDouble() ) {
+                exceptionMsgThrown.append("gives no valid \"minimum\" and ");
+                exceptionMsgThrown.append("\"maximum\" for parameter \"");
+                exceptionMsgThrown.append(name);
+                exceptionMsgThrown.append("\".\n");
+                throw exceptionMsgThrown;
+            }
+            try {
+                addParameterRange(name, range["minimum"].GetDouble(),
+                                  range["maximum"].GetDouble());
+            } catch(string exceptionMsgThrown) {
+                throw exceptionMsgThrown;
+            }
+            continue;
+        }
+        vector<double> values;
+        bool isValid = member->value.IsArray() && member->value.Size() > 0;
+        for ( rapidjson::SizeType it = 0;
+              isValid && it < member->value.Size(); it++ ) {
+            isValid = member->value[it].IsNumber();
+            if ( isValid ) {
+                values.push_back(member->value[it].GetDouble());
+            }
+        }
+        if ( !isValid ) {
+            exceptionMsgThrown.append("gives no list of numbers ");
+            exceptionMsgThrown.append("for parameter \"");
+            exceptionMsgThrown.append(name);
+            exceptionMsgThrown.append("\".\n");
+            throw exceptionMsgThrown;
+        }
+        try {
+            addParameter(name, values);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+    }
+
+    if ( !specification.HasMember("objectives")
+         || !specification["objectives"].IsArray()
+         || specification["objectives"].Size() == 0 ) {
+        exceptionMsgThrown.append("needs \"objectives\", ");
+        exceptionMsgThrown.append("a list of result names.\n");
+        throw exceptionMsgThrown;
+    }
+    const rapidjson::Value& objectiveList = specification["objectives"];
+    for ( rapidjson::SizeType it = 0; it < objectiveList.Size(); it++ ) {
+        if ( !objectiveList[it].IsString() ) {
+            exceptionMsgThrown.append("has an objective which is not ");
+            exceptionMsgThrown.append("a result name.\n");
+            throw exceptionMsgThrown;
+        }
+        // Minimized, unless prefixed by "max:"
+        string name(objectiveList[it].GetString());
+        bool isMaximized = ( name.compare(0, 4, "max:") == 0 );
+        try {
+            addObjective(isMaximized ? name.substr(4) : name, isMaximized);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+    }
+
+    if ( specification.HasMember("monotonic") ) {
+        const rapidjson::Value& monotonicList = specification["monotonic"];
+        bool isValid = monotonicList.IsObject();
+        for ( rapidjson::Value::ConstMemberIterator member =
+                  monotonicList.MemberBegin();
+              isValid && member != monotonicList.MemberEnd(); ++member ) {
+            string direction(member->value.IsString()
+                             ? member->value.GetString() : "");
+            isValid = ( direction == "increasing"
+                        || direction == "decreasing" );
+            if ( isValid ) {
+                try {
+                    declareMonotonic(member->name.GetString(),
+                                     direction == "increasing" ? 1 : -1);
+                } catch(string exceptionMsgThrown) {
+                    throw exceptionMsgThrown;
+                }
+            }
+        }
+        if ( !isValid ) {
+            exceptionMsgThrown.append("has a \"monotonic\" entry which is ");
+            exceptionMsgThrown.append("not \"increasing\" or ");
+            exceptionMsgThrown.append("\"decreasing\".\n");
+            throw exceptionMsgThrown;
+        }
+    }
+
+    if ( specification.HasMember("search") ) {
+        const rapidjson::Value& search = specification["search"];
+        string method(search.IsObject() && search.HasMember("method")
+                      && search["method"].IsString()
+                      ? search["method"].GetString() : "");
+        if ( method != "grid" && method != "nsga2" ) {
+            exceptionMsgThrown.append("has a \"search\" whose \"method\" ");
+            exceptionMsgThrown.append("is not \"grid\" or \"nsga2\".\n");
+            throw exceptionMsgThrown;
+        }
+        if ( method == "nsga2" ) {
+            // Defaults of the population, generations and seed
+            unsigned int settings[3] = { 100, 50, 1 };
+            const char* settingNames[3] = { "population", "generations",
+                                            "seed" };
+            for ( unsigned int it = 0; it < 3; it++ ) {
+                if ( !search.HasMember(settingNames[it]) ) {
+                    continue;
+                }
+                if ( !search[settingNames[it]].IsUint()
+                     || ( it == 0 && search[settingNames[it]].GetUint() < 2 ) ) {
+                    exceptionMsgThrown.append("has an invalid \"");
+                    exceptionMsgThrown.append(settingNames[it]);
+                    exceptionMsgThrown.append("\" in its \"search\".\n");
+                    throw exceptionMsgThrown;
+                }
+                settings[it] = search[settingNames[it]].GetUint();
+            }
+            setEvolutionarySearch(settings[0], settings[1], settings[2]);
+        }
+    }
+}
+
+void
+ParetoExplorer::addParameter(const string& name, const vector<double>& values)
+{
+    const TechnologyField* field = TechnologyValues::findField(name);
+    if ( field == NULL || field->isString ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Unknown numeric input parameter \"");
+        exceptionMsgThrown.append(name);
+        exceptionMsgThrown.append("\" can not be explored.\n");
+        throw exceptionMsgThrown;
+    }
+
+    Parameter parameter;
+    parameter.field = field;
+    parameter.values = values;
+    parameter.isRange = false;
+    parameter.minimum = 0;
+    parameter.maximum = 0;
+    parameter.monotonicDirection = 0;
+    parameters.push_back(parameter);
+}
+
+void
+ParetoExplorer::addParameterRange(const string& name,
+                                  double minimum, double maximum)
+{
+    try {
+        addParameter(name, vector<double>());
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+    parameters.back().isRange = true;
+    parameters.back().minimum = minimum;
+    parameters.back().maximum = maximum;
+}
+
+void
+ParetoExplorer::addObjective(const string& name, bool isMaximized)
+{
+    Objective objective;
+    objective.valueID = DramResult::findValue(name);
+    objective.isMaximized = isMaximized;
+    if ( objective.valueID < 0 ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Unknown result \"");
+        exceptionMsgThrown.append(name);
+        exceptionMsgThrown.append("\" can not be an objective.\n");
+        throw exceptionMsgThrown;
+    }
+    objectives.push_back(objective);
+}
+
+void
+ParetoExplorer::declareMonotonic(const string& name, int direction)
+{
+    if ( TechnologyValues::findField(name) == NULL ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Unknown input parameter \"");
+        exceptionMsgThrown.append(name);
+        exceptionMsgThrown.append("\" can not be declared monotonic.\n");
+        throw exceptionMsgThrown;
+    }
+    declaredDirections[name] = direction;
+}
+
+void
+ParetoExplorer::setEvolutionarySearch(unsigned int populationSize,
+                                      unsigned int nGenerations,
+                                      unsigned long long seed)
+{
+    isEvolutionary = true;
+    this->populationSize = populationSize;
+    this->nGenerations = nGenerations;
+    this->seed = seed;
+}
+
+int
+ParetoExplorer::knownDirection(const string& parameterName, int valueID)
+{
+    size_t nKnown = sizeof(knownMonotonicities)
+                    / sizeof(knownMonotonicities[0]);
+    for ( size_t it = 0; it < nKnown; it++ ) {
+        if ( parameterName == knownMonotonicities[it].parameterName
+             && valueID == knownMonotonicities[it].valueID ) {
+            return knownMonotonicities[it].direction;
+        }
+    }
+    return 0;
+}
+
+void
+ParetoExplorer::prepareParameters()
+{
+    for ( unsigned int it = 0; it < parameters.size(); it++ ) {
+        Parameter& parameter = parameters[it];
+        string name(parameter.field->name);
+
+        // Common direction in which no objective improves
+        int direction = 0;
+        map<string, int>::const_iterator declared =
+                                            declaredDirections.find(name);
+        if ( declared != declaredDirections.end() ) {
+            direction = declared->second;
+        }
+        else {
+            for ( unsigned int obj = 0; obj < objectives.size(); obj++ ) {
+                int objectiveDirection =
+                    knownDirection(name, objectives[obj].valueID)
+                    * ( objectives[obj].isMaximized ? -1 : 1 );
+                if ( obj == 0 ) {
+                    direction = objectiveDirection;
+                }
+                else if ( objectiveDirection != direction ) {
+                    direction = 0;
+                }
+            }
+        }
+        parameter.monotonicDirection = direction;
+
+        // Best values first along a monotonic parameter
+        if ( direction > 0 ) {
+            sort(parameter.values.begin(), parameter.values.end());
+        }
+        else if ( direction < 0 ) {
+            sort(parameter.values.rbegin(), parameter.values.rend());
+        }
+    }
+
+    // Monotonic parameters are run innermost, so that the sub-grids
+    //  below them can be bounded by their first configuration
+    stable_partition(parameters.begin(), parameters.end(),
+                     [](const Parameter& parameter)
+                         { return parameter.monotonicDirection == 0; });
+}
+
+unsigned long long
+ParetoExplorer::nGridPoints() const
+{
+    unsigned long long nPoints = 1;
+    for ( unsigned int it = 0; it < parameters.size(); it++ ) {
+        nPoints *= parameters[it].values.size();
+    }
+    return nPoints;
+}
+
+void
+ParetoExplorer::explore()
+{
+    if ( isEvolutionary ) {
+        try {
+            exploreEvolutionary();
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+        return;
+    }
+
+    for ( unsigned int it = 0; it < parameters.size(); it++ ) {
+        if ( parameters[it].isRange ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Parameter \"");
+            exceptionMsgThrown.append(parameters[it].field->name);
+            exceptionMsgThrown.append("\" is a range, which only the ");
+            exceptionMsgThrown.append("\"nsga2\" search can explore.\n");
+            throw exceptionMsgThrown;
+        }
+    }
+
+    prepareParameters();
+    currentValueIDs.assign(parameters.size(), 0);
+    evaluations.clear();
+    archive.clear();
+
+    try {
+        exploreLevel(0);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+}
+
+void
+ParetoExplorer::exploreLevel(unsigned int level)
+{
+    if ( level == parameters.size() ) {
+        const Evaluation& evaluation = evaluate(currentValueIDs);
+        if ( evaluation.isValid ) {
+            insertIntoArchive(evaluation.point);
+        }
+        evaluations.erase(currentValueIDs);
+        return;
+    }
+
+    // All parameters from here on are monotonic (they are innermost)
+    bool isBounded = ( parameters[level].monotonicDirection != 0 );
+    unsigned long long nInnerPoints = 1;
+    for ( unsigned int it = level + 1; it < parameters.size(); it++ ) {
+        nInnerPoints *= parameters[it].values.size();
+    }
+
+    unsigned int nValues = parameters[level].values.size();
+    for ( unsigned int valueID = 0; valueID < nValues; valueID++ ) {
+        currentValueIDs[level] = valueID;
+        for ( unsigned int it = level + 1; it < parameters.size(); it++ ) {
+            currentValueIDs[it] = 0;
+        }
+
+        // The first configuration of the sub-grid is the best one in all
+        //  objectives: if it is dominated, so is the rest of the sub-grid
+        //  and every following value of this parameter
+        if ( isBounded ) {
+            const Evaluation& corner = evaluate(currentValueIDs);
+            if ( corner.isValid && isDominatedByArchive(corner.point) ) {
+                evaluations.erase(currentValueIDs);
+                nSkipped += (nValues - valueID) * nInnerPoints - 1;
+                return;
+            }
+        }
+
+        exploreLevel(level + 1);
+    }
+}
+
+void
+ParetoExplorer::exploreEvolutionary()
+{
+    // Discrete genes index the value lists, continuous genes are
+    //  the values of the ranges
+    vector<Nsga2::Gene> genes;
+    for ( unsigned int it = 0; it < parameters.size(); it++ ) {
+        Nsga2::Gene gene;
+        gene.nValues = parameters[it].isRange
+                       ? 0 : parameters[it].values.size();
+        gene.minimum = parameters[it].minimum;
+        gene.maximum = parameters[it].maximum;
+        genes.push_back(gene);
+    }
+
+    Nsga2 search(genes, populationSize, seed);
+    BatchEvaluator evaluator(nJobs);
+    genomeEvaluations.clear();
+    archive.clear();
+
+    vector<Nsga2::Individual> candidates = search.initialPopulation();
+    for ( unsigned int generation = 0; ; generation++ ) {
+        evaluateGeneration(candidates, evaluator);
+        search.select(candidates);
+        if ( generation == nGenerations ) {
+            break;
+        }
+        candidates = search.makeOffspring();
+    }
+}
+
+void
+ParetoExplorer::evaluateGeneration(vector<Nsga2::Individual>& individuals,
+                                   const BatchEvaluator& evaluator)
+{
+    // Genomes met before are not evaluated again
+    vector<TechnologyValues> batch;
+    vector<vector<double> > batchGenomes;
+    for ( unsigned int it = 0; it < individuals.size(); it++ ) {
+        const vector<double>& genome = individuals[it].genes;
+        if ( genomeEvaluations.count(genome) > 0 ) {
+            continue;
+        }
+        Evaluation& evaluation = genomeEvaluations[genome];
+        evaluation.isValid = false;
+
+        TechnologyValues inputs(baseInputs);
+        for ( unsigned int gene = 0; gene < parameters.size(); gene++ ) {
+            double value = parameters[gene].isRange
+                           ? genome[gene]
+                           : parameters[gene].values[
+                                 static_cast<unsigned int>(genome[gene])];
+            parameters[gene].field->setNumber(inputs, value);
+            evaluation.point.parameterValues.push_back(value);
+        }
+        batch.push_back(inputs);
+        batchGenomes.push_back(genome);
+    }
+
+    vector<DramResult> results;
+    vector<string> errors;
+    evaluator.evaluate(batch, IOTerminationCurrentFlag, results, errors);
+    nEvaluated += batch.size();
+
+    // In the order of the batch, whatever the order of the evaluations
+    for ( unsigned int it = 0; it < batch.size(); it++ ) {
+        Evaluation& evaluation = genomeEvaluations[batchGenomes[it]];
+        if ( !errors[it].empty() ) {
+            // Invalid combination of parameters
+            if ( nInvalid == 0 ) {
+                firstInvalidMessage = errors[it];
+            }
+            nInvalid++;
+            continue;
+        }
+        for ( unsigned int obj = 0; obj < objectives.size(); obj++ ) {
+            double value = results[it].values[objectives[obj].valueID];
+            evaluation.point.objectiveValues.push_back(
+                                objectives[obj].isMaximized ? -value : value);
+        }
+        evaluation.isValid = true;
+        insertIntoArchive(evaluation.point);
+    }
+
+    for ( unsigned int it = 0; it < individuals.size(); it++ ) {
+        const Evaluation& evaluation =
+                                genomeEvaluations[individuals[it].genes];
+        individuals[it].isFeasible = evaluation.isValid;
+        individuals[it].objectiveValues = evaluation.point.objectiveValues;
+    }
+}
+
+const ParetoExplorer::Evaluation&
+ParetoExplorer::evaluate(const vector<unsigned int>& valueIDs)
+{
+    map<vector<unsigned int>, Evaluation>::iterator known =
+                                                    evaluations.find(valueIDs);
+    if ( known != evaluations.end() ) {
+        return known->second;
+    }
+
+    Evaluation& evaluation = evaluations[valueIDs];
+    evaluation.isValid = false;
+    nEvaluated++;
+
+    TechnologyValues inputs(baseInputs);
+    for ( unsigned int it = 0; it < parameters.size(); it++ ) {
+        double value = parameters[it].values[valueIDs[it]];
+        parameters[it].field->setNumber(inputs, value);
+        evaluation.point.parameterValues.push_back(value);
+    }
+
+    try {
+        Current dram(inputs, IOTerminationCurrentFlag);
+        DramResult result;
+        result.collect(dram);
+        for ( unsigned int it = 0; it < objectives.size(); it++ ) {
+            double value = result.values[objectives[it].valueID];
+            evaluation.point.objectiveValues.push_back(
+                                objectives[it].isMaximized ? -value : value);
+        }
+        evaluation.isValid = true;
+    } catch(string exceptionMsgThrown) {
+        // Invalid combination of parameters
+        if ( nInvalid == 0 ) {
+            firstInvalidMessage = exceptionMsgThrown;
+        }
+        nInvalid++;
+    }
+    return evaluation;
+}
+
+bool
+ParetoExplorer::isDominatedByArchive(const ParetoPoint& point) const
+{
+    for ( unsigned int member = 0; member < archive.size(); member++ ) {
+        bool isDominated = true;
+        for ( unsigned int it = 0;
+              isDominated && it < point.objectiveValues.size(); it++ ) {
+            isDominated = archive[member].objectiveValues[it]
+                          <= point.objectiveValues[it];
+        }
+        if ( isDominated ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+ParetoExplorer::insertIntoArchive(const ParetoPoint& point)
+{
+    // Equal objective values count as dominated, the first one is kept
+    if ( isDominatedByArchive(point) ) {
+        return;
+    }
+
+    unsigned int nKept = 0;
+    for ( unsigned int member = 0; member < archive.size(); member++ ) {
+        bool isDominated = true;
+        for ( unsigned int it = 0;
+              isDominated && it < point.objectiveValues.size(); it++ ) {
+            isDominated = point.objectiveValues[it]
+                          <= archive[member].objectiveValues[it];
+        }
+        if ( !isDominated ) {
+            archive[nKept++] = archive[member];
+        }
+    }
+    archive.resize(nKept);
+    archive.push_back(point);
+}
+
+void
+ParetoExplorer::writeFront(ostream& frontFile) const
+{
+    // Sorted by the objectives, in the order they were given
+    vector<ParetoPoint> sortedFront(archive);
+    sort(sortedFront.begin(), sortedFront.end(),
+         [](const ParetoPoint& first, const ParetoPoint& second)
+             { return first.objectiveValues < second.objectiveValues; });
+
+    frontFile << "Point";
+    for ( unsigned int it = 0; it < parameters.size(); it++ ) {
+        frontFile << "," << parameters[it].field->name;
+    }
+    for ( unsigned int it = 0; it < objectives.size(); it++ ) {
+        frontFile << "," << DramResult::names[objectives[it].valueID];
+    }
+    frontFile << "\n";
+
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+    for ( unsigned int point = 0; point < sortedFront.size(); point++ ) {
+        frontFile << point;
+        for ( unsigned int it = 0; it < parameters.size(); it++ ) {
+            shortestDoubleToString(sortedFront[point].parameterValues[it],
+                                   buffer);
+            frontFile << "," << buffer;
+        }
+        for ( unsigned int it = 0; it < objectives.size(); it++ ) {
+            double value = sortedFront[point].objectiveValues[it];
+            shortestDoubleToString(objectives[it].isMaximized ? -value : value,
+                                   buffer);
+            frontFile << "," << buffer;
+        }
+        frontFile << "\n";
+    }
+}
+
+void
+ParetoExplorer::printStatistics(ostream& output) const
+{
+    if ( isEvolutionary ) {
+        output << "Exploration statistics:" << endl
+               << "\tSearch:                   NSGA-II" << endl
+               << "\tPopulation:               " << populationSize << endl
+               << "\tGenerations:              " << nGenerations << endl
+               << "\tSeed:                     " << seed << endl
+               << "\tEvaluated configurations: " << nEvaluated << endl
+               << "\tInvalid configurations:   " << nInvalid << endl
+               << "\tPareto front size:        " << archive.size() << endl;
+        return;
+    }
+    output << "Exploration statistics:" << endl
+           << "\tGrid configurations:      " << nGridPoints() << endl
+           << "\tEvaluated configurations: " << nEvaluated << endl
+           << "\tSkipped (dominated):      " << nSkipped << endl
+           << "\tInvalid configurations:   " << nInvalid << endl
+           << "\tPareto front size:        " << archive.size() << endl;
+}
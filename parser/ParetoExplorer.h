@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef PARETOEXPLORER_H
+#define PARETOEXPLORER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <ostream>
+
+#include "TechnologyValues.h"
+#include "DramResult.h"
+#include "BatchEvaluator.h"
+#include "Nsga2.h"
+
+using namespace std;
+
+// One configuration of an exploration, with its objective values
+//  (sign-adjusted, so that smaller is always better)
+struct ParetoPoint
+{
+    vector<double> parameterValues;
+    vector<double> objectiveValues;
+};
+
+// Multi-objective exploration of a grid of input parameters around
+//  a base configuration (-explore <specification>):
+//   {
+//     "technology": "<technology file>",
+//     "architecture": "<architecture file>",
+//     "parameters": { "CellsPerSubarrayColumn[]": [256, 512, 1024], ... },
+//     "objectives": [ "ChannelArea[mm^2]", "tRC[ns]", "max:DRAMFrequency[MHz]" ],
+//     "monotonic": { "TilesPerBank[]": "increasing" },
+//     "search": { "method": "nsga2", "population": 100,
+//                 "generations": 50, "seed": 1 }
+//   }
+// The configurations which are not dominated by any other one (the
+//  Pareto front) are kept in an archive while the grid is run.
+// Sub-grids are skipped when known monotonic relationships show that
+//  none of their configurations can enter the front: along a parameter
+//  in which no objective improves, a configuration dominated by the
+//  archive is followed by dominated configurations only. The model
+//  relationships known to hold are built in; "monotonic" adds the ones
+//  asserted for all objectives ("increasing": no objective improves when
+//  the parameter increases, "decreasing": when it decreases).
+// Grids too large to run are searched by NSGA-II instead ("search"),
+//  which also takes parameter ranges ({ "minimum": 1.1, "maximum": 1.5 }).
+//  It evaluates at most population * (generations + 1) configurations,
+//  each generation in parallel, and gives the same front for the same
+//  seed whatever the number of parallel evaluations.
+class ParetoExplorer
+{
+public:
+    ParetoExplorer();
+
+    void readSpecification(const string& specificationFileName);
+
+    void addParameter(const string& name, const vector<double>& values);
+    // Only explored by the evolutionary search
+    void addParameterRange(const string& name,
+                           double minimum, double maximum);
+    void addObjective(const string& name, bool isMaximized);
+    // direction: +1 no objective improves when the parameter increases,
+    //  -1 when it decreases
+    void declareMonotonic(const string& name, int direction);
+    void setEvolutionarySearch(unsigned int populationSize,
+                               unsigned int nGenerations,
+                               unsigned long long seed);
+
+    void explore();
+
+    const vector<ParetoPoint>& front() const { return archive; }
+    void writeFront(ostream& frontFile) const;
+    void printStatistics(ostream& output) const;
+
+    // Base configuration, -D overrides and IO termination are applied
+    //  by the caller before exploring
+    TechnologyValues baseInputs;
+    bool IOTerminationCurrentFlag;
+    // Parallel evaluations of the evolutionary search, 0: one per core
+    unsigned int nJobs;
+
+    bool isEvolutionary;
+    unsigned int populationSize;
+    unsigned int nGenerations;
+    unsigned long long seed;
+
+    unsigned long long nGridPoints() const;
+    unsigned long long nEvaluated;
+    unsigned long long nInvalid;
+    unsigned long long nSkipped;
+    // First error message of an invalid configuration
+    string firstInvalidMessage;
+
+private:
+    struct Parameter
+    {
+        const TechnologyField* field;
+        vector<double> values;
+        // Range instead of values
+        bool isRange;
+        double minimum;
+        double maximum;
+        // +1/-1 if no objective improves along increasing/decreasing
+        //  values, 0 if unknown
+        int monotonicDirection;
+    };
+
+    struct Objective
+    {
+        int valueID;
+        bool isMaximized;
+    };
+
+    struct Evaluation
+    {
+        bool isValid;
+        ParetoPoint point;
+    };
+
+    // Direction in which an objective does not decrease along a
+    //  parameter in the model, 0 if not known
+    static int knownDirection(const string& parameterName, int valueID);
+
+    void prepareParameters();
+    void exploreLevel(unsigned int level);
+    void exploreEvolutionary();
+    void evaluateGeneration(vector<Nsga2::Individual>& individuals,
+                            const BatchEvaluator& evaluator);
+    const Evaluation& evaluate(const vector<unsigned int>& valueIDs);
+    bool isDominatedByArchive(const ParetoPoint& point) const;
+    void insertIntoArchive(const ParetoPoint& point);
+
+    vector<Parameter> parameters;
+    vector<Objective> objectives;
+    map<string, int> declaredDirections;
+
+    vector<unsigned int> currentValueIDs;
+    // Evaluations done ahead to bound a sub-grid, used when reached
+    map<vector<unsigned int>, Evaluation> evaluations;
+    // Every genome evaluated by the evolutionary search
+    map<vector<double>, Evaluation> genomeEvaluations;
+
+    vector<ParetoPoint> archive;
+};
+
+#endif // PARETOEXPLORER_H
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "ResultCache.h"
+
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cerrno>
+#include <atomic>
+#include <sys/stat.h>
+#include <unistd.h>
+
+const char* const ResultCache::modelVersion = "1";
+
+// Separates the input key from the values in a cache entry
+static const char* const entrySeparator = "--\n";
+
+ResultCache::ResultCache()
+{
+}
+
+void
+ResultCache::setDirectory(const string& directory)
+{
+    if ( mkdir(directory.c_str(), 0755) != 0 && errno != EEXIST ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Could not create cache directory \'");
+        exceptionMsgThrown.append(directory);
+        exceptionMsgThrown.append("\'.\n");
+        throw exceptionMsgThrown;
+    }
+    cacheDirectory = directory;
+}
+
+string
+ResultCache::inputKey(const TechnologyValues& inputs,
+                      bool IOTerminationCurrentFlag)
+{
+    string key("ModelVersion=");
+    key.append(modelVersion);
+    key.append("\nIOTerminationCurrent=");
+    key.append(IOTerminationCurrentFlag ? "1" : "0");
+    key.append("\n");
+    key.append(inputs.canonicalInputs());
+    return key;
+}
+
+string
+ResultCache::entryFileName(const string& key) const
+{
+    char hashText[17];
+    snprintf(hashText, sizeof(hashText), "%016llx", fnv1aHash(key));
+
+    string fileName(cacheDirectory);
+    fileName.append("/");
+    fileName.append(hashText);
+    fileName.append(".result");
+    return fileName;
+}
+
+bool
+ResultCache::findInRun(DramResult& result) const
+{
+    unordered_map<unsigned long long, RunEntry>::const_iterator entry
+            = runResults.find(fnv1aHash(result.inputKey));
+    if ( entry == runResults.end()
+         || entry->second.inputKey != result.inputKey ) {
+        return false;
+    }
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        result.values[valueID] = entry->second.values[valueID];
+    }
+    result.warning = entry->second.warning;
+    return true;
+}
+
+void
+ResultCache::insertInRun(const DramResult& result)
+{
+    if ( runResults.size() >= maxRunResults ) {
+        runResults.clear();
+    }
+
+    // A colliding key replaces the previous entry
+    RunEntry& entry = runResults[fnv1aHash(result.inputKey)];
+    entry.inputKey = result.inputKey;
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        entry.values[valueID] = result.values[valueID];
+    }
+    entry.warning = result.warning;
+}
+
+bool
+ResultCache::findOnDisk(DramResult& result) const
+{
+    if ( !hasDirectory() ) {
+        return false;
+    }
+
+    ifstream entryFile(entryFileName(result.inputKey));
+    if ( !entryFile.is_open() ) {
+        return false;
+    }
+    stringstream entryText;
+    entryText << entryFile.rdbuf();
+    const string entry = entryText.str();
+
+    // The whole input key is stored, so that hash collisions are harmless
+    string header(result.inputKey);
+    header.append(entrySeparator);
+    if ( entry.compare(0, header.size(), header) != 0 ) {
+        return false;
+    }
+
+    double values[DramResult::N_VALUES];
+    const char* position = entry.c_str() + header.size();
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        char* valueEnd;
+        values[valueID] = strtod(position, &valueEnd);
+        if ( valueEnd == position || *valueEnd != '\n' ) {
+            return false; // Damaged entry
+        }
+        position = valueEnd + 1;
+    }
+
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        result.values[valueID] = values[valueID];
+    }
+    result.warning = string(position);
+    return true;
+}
+
+void
+ResultCache::storeOnDisk(const DramResult& result) const
+{
+    if ( !hasDirectory() ) {
+        return;
+    }
+
+    string entry(result.inputKey);
+    entry.append(entrySeparator);
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        shortestDoubleToString(result.values[valueID], buffer);
+        entry.append(buffer);
+        entry.append("\n");
+    }
+    entry.append(result.warning);
+
+    // Written aside and renamed, so that concurrent runs sharing the
+    //  cache never read a partially written entry
+    static atomic<unsigned long> nTemporaryFiles(0);
+    string fileName = entryFileName(result.inputKey);
+    string temporaryFileName(fileName);
+    temporaryFileName.append(".tmp.");
+    temporaryFileName.append(to_string(getpid()));
+    temporaryFileName.append(".");
+    temporaryFileName.append(to_string(nTemporaryFiles++));
+
+    ofstream entryFile(temporaryFileName, ofstream::trunc);
+    entryFile << entry;
+    entryFile.close();
+    if ( entryFile.fail()
+         || rename(temporaryFileName.c_str(), fileName.c_str()) != 0 ) {
+        remove(temporaryFileName.c_str());
+    }
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef RESULTCACHE_H
+#define RESULTCACHE_H
+
+#include <string>
+#include <unordered_map>
+
+#include "DramResult.h"
+#include "TechnologyValues.h"
+
+using namespace std;
+
+// Reuse of results, keyed by the canonical text of all effective inputs
+//  of a configuration (normalized input parameters, IO termination flag
+//  and model version).
+// Within a run, repeated configurations are evaluated only once; at most
+//  maxRunResults results are kept for that. When the limit is reached,
+//  the whole in-run map is cleared and filled again from then on.
+// With a cache directory, results are additionally stored on disk in
+//  one file per input key, named after its hash, and reused by later runs.
+class ResultCache
+{
+public:
+    // To be increased whenever a change in the model (core/) alters
+    //  any result, so that results of older versions are not reused
+    static const char* const modelVersion;
+
+    ResultCache();
+
+    void setDirectory(const string& directory);
+    bool hasDirectory() const { return !cacheDirectory.empty(); }
+
+    static string inputKey(const TechnologyValues& inputs,
+                           bool IOTerminationCurrentFlag);
+
+    // Fill in values and warning of a result with the same input key
+    bool findInRun(DramResult& result) const;
+    bool findOnDisk(DramResult& result) const;
+
+    void insertInRun(const DramResult& result);
+    size_t nRunResults() const { return runResults.size(); }
+    void clearRun() { runResults.clear(); }
+
+    // Bound of the results kept for reuse within a run
+    static const size_t maxRunResults = 16384;
+
+    // Failing to store an entry is not an error, it is just not reused.
+    // Safe to be called concurrently with the lookups of another thread.
+    void storeOnDisk(const DramResult& result) const;
+
+    string entryFileName(const string& key) const;
+
+private:
+    // Outputs of a result kept for reuse within a run.
+    // The key is only kept to verify a hit, the entries are indexed by its
+    //  hash.
+    struct RunEntry
+    {
+        string inputKey;
+        double values[DramResult::N_VALUES];
+        string warning;
+    };
+
+    string cacheDirectory;
+    unordered_map<unsigned long long, RunEntry> runResults;
+};
+
+#endif // RESULTCACHE_H
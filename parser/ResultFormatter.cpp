@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "ResultFormatter.h"
+
+#include <cstring>
+
+ResultFormatter::ResultFormatter()
+{
+    csvBuffer.reserve(initialCapacity);
+    stdoutBuffer.reserve(initialCapacity);
+}
+
+void
+ResultFormatter::clear()
+{
+    // Keeps the allocated capacity
+    csvBuffer.clear();
+    stdoutBuffer.clear();
+}
+
+void
+ResultFormatter::appendLine(const char* label, double value)
+{
+    char valueStr[SHORTEST_DOUBLE_BUFFER_SIZE];
+    int valueLength = shortestDoubleToString(value, valueStr);
+    size_t labelLength = strlen(label);
+
+    // csv: keep the lines as short as possible
+    //  and add a comma separator between label and value
+    csvBuffer.append(label, labelLength);
+    csvBuffer.push_back(',');
+    csvBuffer.append(valueStr, valueLength);
+    csvBuffer.push_back('\n');
+
+    // stdout: left aligned label padded to the column width
+    stdoutBuffer.append(label, labelLength);
+    if ( labelLength < lineWidth ) {
+        stdoutBuffer.append(lineWidth - labelLength, ' ');
+    }
+    stdoutBuffer.append(valueStr, valueLength);
+    stdoutBuffer.push_back('\n');
+}
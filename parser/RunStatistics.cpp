@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "RunStatistics.h"
+
+#include <iomanip>
+
+RunStatistics::RunStatistics()
+{
+    nEvaluatedConfigurations = 0;
+    nResumedConfigurations = 0;
+    nRepeatedConfigurations = 0;
+    nCacheHits = 0;
+    writerQueueCapacity = 0;
+    writerQueueHighWaterMark = 0;
+    writerQueueStalls = 0;
+}
+
+void
+RunStatistics::print(ostream& out) const
+{
+    out << "Run statistics:" << endl;
+    out << setw(34) << left << "\tEvaluated configurations:"
+        << nEvaluatedConfigurations << endl;
+    out << setw(34) << left << "\tResumed configurations:"
+        << nResumedConfigurations << endl;
+    out << setw(34) << left << "\tRepeated configurations:"
+        << nRepeatedConfigurations << endl;
+    out << setw(34) << left << "\tResult cache hits:"
+        << nCacheHits << endl;
+    out << setw(34) << left << "\tWriter queue capacity:"
+        << writerQueueCapacity << endl;
+    out << setw(34) << left << "\tWriter queue high-water mark:"
+        << writerQueueHighWaterMark << endl;
+    out << setw(34) << left << "\tWriter queue stalls:"
+        << writerQueueStalls << endl;
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef RUNSTATISTICS_H
+#define RUNSTATISTICS_H
+
+#include <iostream>
+#include <cstddef>
+
+using namespace std;
+
+// Counters collected during a run, printed out with the "-stats" flag
+class RunStatistics
+{
+public:
+    RunStatistics();
+
+    void print(ostream& out) const;
+
+    // Number of configurations evaluated
+    unsigned int nEvaluatedConfigurations;
+    // Number of configurations skipped as completed by an interrupted run
+    unsigned int nResumedConfigurations;
+    // Number of configurations repeated within the run (evaluated once)
+    unsigned int nRepeatedConfigurations;
+    // Number of configurations found in the on-disk result cache
+    unsigned int nCacheHits;
+
+    // Maximum number of results the writer queue can hold
+    size_t writerQueueCapacity;
+    // Largest number of results ever waiting in the writer queue
+    size_t writerQueueHighWaterMark;
+    // Number of times a result had to wait for a free slot in the queue
+    unsigned long writerQueueStalls;
+};
+
+#endif // RUNSTATISTICS_H
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "SensitivityAnalyzer.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "../core/Dual.h"
+
+// Clock cycles = ceil(time[ns] * frequency[MHz] / 1000)
+struct ClockCycles
+{
+    int cyclesValueID;
+    int timeValueID;
+    int frequencyValueID;
+};
+
+static const ClockCycles clockCycles[] = {
+    { DramResult::TRCD_CLK,      DramResult::TRCD,  DramResult::DRAM_FREQ },
+    { DramResult::TCAS_CLK,      DramResult::TCAS,  DramResult::DRAM_FREQ },
+    { DramResult::TCAS_CORE_CLK, DramResult::TCAS,  DramResult::CORE_FREQ },
+    { DramResult::TRAS_CLK,      DramResult::TRAS,  DramResult::DRAM_FREQ },
+    { DramResult::TRP_CLK,       DramResult::TRP,   DramResult::DRAM_FREQ },
+    { DramResult::TRC_CLK,       DramResult::TRC,   DramResult::DRAM_FREQ },
+    { DramResult::TRL_CLK,       DramResult::TRL,   DramResult::DRAM_FREQ },
+    { DramResult::TRL_CORE_CLK,  DramResult::TRL,   DramResult::CORE_FREQ },
+    { DramResult::TRTP_CLK,      DramResult::TRTP,  DramResult::DRAM_FREQ },
+    { DramResult::TCCD_CLK,      DramResult::TCCD,  DramResult::DRAM_FREQ },
+    { DramResult::TCCD_CORE_CLK, DramResult::TCCD,  DramResult::CORE_FREQ },
+    { DramResult::TWR_CLK,       DramResult::TWR,   DramResult::DRAM_FREQ },
+    { DramResult::TRFC_CLK,      DramResult::TRFC,  DramResult::DRAM_FREQ },
+    { DramResult::TREFI_CLK,     DramResult::TREFI, DramResult::DRAM_FREQ }
+};
+
+// Results printed with their most influential parameters
+static const int printedValueIDs[] = {
+    DramResult::TRCD, DramResult::TCAS, DramResult::TRAS, DramResult::TRC,
+    DramResult::IDD0, DramResult::IDD4R, DramResult::IDD5B,
+    DramResult::CHANNEL_AREA
+};
+
+static const unsigned int nPrintedParameters = 3;
+
+SensitivityAnalyzer::SensitivityAnalyzer(bool IOTerminationCurrentFlag) :
+    IOTerminationCurrentFlag(IOTerminationCurrentFlag)
+{
+    nEvaluations = 0;
+    fill(nominalValues, nominalValues + DramResult::N_VALUES, 0.0);
+}
+
+void
+SensitivityAnalyzer::setParameters(const vector<const TechnologyField*>& fields)
+{
+    parameterFields = fields;
+}
+
+void
+SensitivityAnalyzer::continuousValues(const DramResult& result,
+                                      double* values)
+{
+    copy(result.values, result.values + DramResult::N_VALUES, values);
+    for ( unsigned int it = 0;
+          it < sizeof(clockCycles) / sizeof(clockCycles[0]); it++ ) {
+        values[clockCycles[it].cyclesValueID]
+                = result.values[clockCycles[it].timeValueID]
+                  * result.values[clockCycles[it].frequencyValueID] / 1000;
+    }
+}
+
+void
+SensitivityAnalyzer::analyze(const TechnologyValues& inputs)
+{
+    parameters.clear();
+
+    // The nominal configuration is rejected as in a normal run
+    try {
+        Current dram(inputs, IOTerminationCurrentFlag);
+        nominalResult.collect(dram);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+    continuousValues(nominalResult, nominalValues);
+
+    vector<const TechnologyField*> fields(parameterFields);
+    if ( fields.empty() ) {
+        const vector<TechnologyField>& registry
+                = TechnologyValues::fieldRegistry();
+        for ( unsigned int it = 0; it < registry.size(); it++ ) {
+            if ( registry[it].document == TECHNOLOGY_DOCUMENT
+                 && registry[it].setDual != NULL ) {
+                fields.push_back(&registry[it]);
+            }
+        }
+    }
+    for ( unsigned int it = 0; it < fields.size(); it++ ) {
+        const TechnologyField& field = *fields[it];
+        if ( field.setDual == NULL ) {
+            throw string("[ERROR] ") + field.name + " is a count, the "
+                  "results have no derivative with respect to it.\n";
+        }
+        double value = field.getNumber(inputs);
+        if ( value == INVALID_VALUE ) {
+            continue;
+        }
+        Sensitivity sensitivity;
+        sensitivity.field = &field;
+        sensitivity.value = value;
+        parameters.push_back(sensitivity);
+    }
+
+    // One evaluation on dual numbers, each parameter seeded with its own
+    //  unit derivative, gives the derivatives of all results
+    TechnologyInputs<Dual> dualInputs(inputs);
+    for ( unsigned int it = 0; it < parameters.size(); it++ ) {
+        parameters[it].field->setDual(dualInputs,
+                                      Dual(parameters[it].value, it,
+                                           parameters.size()));
+    }
+    Dual values[DramResult::N_VALUES];
+    try {
+        BasicCurrent<Dual> dram(dualInputs, IOTerminationCurrentFlag);
+        DramResult::collectValues(dram, values);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+    nEvaluations = 2;
+
+    for ( unsigned int it = 0; it < parameters.size(); it++ ) {
+        for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+            parameters[it].derivatives[valueID]
+                    = values[valueID].derivative(it);
+        }
+    }
+}
+
+double
+SensitivityAnalyzer::elasticity(const Sensitivity& sensitivity,
+                                int valueID) const
+{
+    if ( nominalValues[valueID] == 0 ) {
+        return 0;
+    }
+    return sensitivity.derivatives[valueID] * sensitivity.value
+           / nominalValues[valueID];
+}
+
+void
+SensitivityAnalyzer::writeHeader(ostream& sensitivityFile)
+{
+    sensitivityFile << "Configuration,TechnologyFile,ArchitectureFile,"
+                    << "Parameter,Value,Result,Derivative,Elasticity\n";
+}
+
+void
+SensitivityAnalyzer::writeSensitivities(ostream& sensitivityFile,
+                                        unsigned int configID,
+                                        const string& technologyFileName,
+                                        const string& architectureFileName)
+                                        const
+{
+    string fileNameFields;
+    appendCsvFileNames(fileNameFields, technologyFileName,
+                       architectureFileName);
+
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+    for ( unsigned int it = 0; it < parameters.size(); it++ ) {
+        const Sensitivity& sensitivity = parameters[it];
+        for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+            if ( sensitivity.derivatives[valueID] == 0 ) {
+                continue;
+            }
+            sensitivityFile << configID << "," << fileNameFields << ","
+                            << sensitivity.field->name << ",";
+            shortestDoubleToString(sensitivity.value, buffer);
+            sensitivityFile << buffer << "," << DramResult::names[valueID];
+            shortestDoubleToString(sensitivity.derivatives[valueID], buffer);
+            sensitivityFile << "," << buffer;
+            shortestDoubleToString(elasticity(sensitivity, valueID), buffer);
+            sensitivityFile << "," << buffer << "\n";
+        }
+    }
+}
+
+void
+SensitivityAnalyzer::printSensitivities(ostream& output) const
+{
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+    for ( unsigned int printed = 0;
+          printed < sizeof(printedValueIDs) / sizeof(printedValueIDs[0]);
+          printed++ ) {
+        int valueID = printedValueIDs[printed];
+        vector<pair<double, unsigned int> > ranking;
+        for ( unsigned int it = 0; it < parameters.size(); it++ ) {
+            double valueElasticity = elasticity(parameters[it], valueID);
+            if ( valueElasticity != 0 ) {
+                ranking.push_back(make_pair(-fabs(valueElasticity), it));
+            }
+        }
+        sort(ranking.begin(), ranking.end());
+
+        output << "\t" << DramResult::names[valueID] << ":";
+        if ( ranking.empty() ) {
+            output << " no technology parameter";
+        }
+        for ( unsigned int it = 0;
+              it < ranking.size() && it < nPrintedParameters; it++ ) {
+            const Sensitivity& sensitivity = parameters[ranking[it].second];
+            shortestDoubleToString(elasticity(sensitivity, valueID), buffer);
+            output << ( it > 0 ? "," : "" ) << " "
+                   << sensitivity.field->name << " " << buffer;
+        }
+        output << endl;
+    }
+}
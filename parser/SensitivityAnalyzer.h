@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef SENSITIVITYANALYZER_H
+#define SENSITIVITYANALYZER_H
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+#include "TechnologyValues.h"
+#include "DramResult.h"
+
+using namespace std;
+
+// Derivatives of every result with respect to one technology parameter
+struct Sensitivity
+{
+    const TechnologyField* field;
+    // Parameter value, in the unit of its JSON member
+    double value;
+    double derivatives[DramResult::N_VALUES];
+};
+
+// Jacobian of the results with respect to the technology parameters of
+//  a configuration (-sensitivity). The model is evaluated once on dual
+//  numbers (see Dual.h), which carry the exact derivatives with respect
+//  to all parameters, besides the nominal evaluation. Counts (e.g.
+//  nBanksPerSemiSharedResource) have no derivative and are not analyzed.
+// Clock cycles are steps (ceil(time / clock period)), whose derivative
+//  is zero almost everywhere. The model relaxes them: they carry the
+//  derivative of time / clock period (see Timing.cpp), and so do the
+//  results computed from them (e.g. IDD0 through the cycles of tRC).
+//  Their elasticities are taken at the argument as well. Other steps
+//  (e.g. the rows refreshed per refresh command) have derivative zero.
+class SensitivityAnalyzer
+{
+public:
+    explicit SensitivityAnalyzer(bool IOTerminationCurrentFlag);
+
+    // Parameters to differentiate by, by default all technology ones
+    //  which are not counts
+    void setParameters(const vector<const TechnologyField*>& fields);
+
+    void analyze(const TechnologyValues& inputs);
+
+    const DramResult& nominal() const { return nominalResult; }
+    const vector<Sensitivity>& sensitivities() const { return parameters; }
+    // Relative change of the result per relative change of the parameter,
+    //  0 if the result is 0
+    double elasticity(const Sensitivity& sensitivity, int valueID) const;
+
+    static void writeHeader(ostream& sensitivityFile);
+    // One row per parameter and result which depends on it
+    void writeSensitivities(ostream& sensitivityFile, unsigned int configID,
+                            const string& technologyFileName,
+                            const string& architectureFileName) const;
+    // Parameters with the largest elasticities of the main results
+    void printSensitivities(ostream& output) const;
+
+    unsigned int nEvaluations;
+
+    // Results without steps: the argument of ceil for clock cycles
+    static void continuousValues(const DramResult& result, double* values);
+
+private:
+    bool IOTerminationCurrentFlag;
+    vector<const TechnologyField*> parameterFields;
+    DramResult nominalResult;
+    // continuousValues of the nominal result, the base of the elasticities
+    double nominalValues[DramResult::N_VALUES];
+    vector<Sensitivity> parameters;
+};
+
+#endif // SENSITIVITYANALYZER_H
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "ShardMerger.h"
+
+#include <cstdlib>
+
+#include "../utils/utils.h"
+
+ShardMerger::ShardMerger()
+{
+}
+
+void
+ShardMerger::readShard(istream& shardFile, const string& shardFileName)
+{
+    string line;
+    if ( !getline(shardFile, line) ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Shard result file \'");
+        exceptionMsgThrown.append(shardFileName);
+        exceptionMsgThrown.append("\' is empty.\n");
+        throw exceptionMsgThrown;
+    }
+
+    if ( header.empty() ) {
+        header = line;
+    }
+    else if ( line != header ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Shard result file \'");
+        exceptionMsgThrown.append(shardFileName);
+        exceptionMsgThrown.append("\' has a different table header ");
+        exceptionMsgThrown.append("than the previous shards.\n");
+        throw exceptionMsgThrown;
+    }
+
+    // Rows are kept whole, quoted file name fields included
+    while ( getCsvRecord(shardFile, line) ) {
+        if ( line.empty() ) {
+            continue;
+        }
+
+        // The configuration id is the first column
+        const char* rowStart = line.c_str();
+        char* idEnd;
+        unsigned long configID = strtoul(rowStart, &idEnd, 10);
+        if ( idEnd == rowStart || *idEnd != ',' ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Invalid row in shard result file \'");
+            exceptionMsgThrown.append(shardFileName);
+            exceptionMsgThrown.append("\': ");
+            exceptionMsgThrown.append(line);
+            exceptionMsgThrown.append("\n");
+            throw exceptionMsgThrown;
+        }
+
+        if ( !rows.insert(make_pair(configID, line)).second ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Configuration ");
+            exceptionMsgThrown.append(to_string(configID));
+            exceptionMsgThrown.append(" found more than once (last in \'");
+            exceptionMsgThrown.append(shardFileName);
+            exceptionMsgThrown.append("\').\n");
+            throw exceptionMsgThrown;
+        }
+    }
+}
+
+void
+ShardMerger::writeMerged(ostream& mergedFile) const
+{
+    mergedFile << header << "\n";
+    for ( map<unsigned long, string>::const_iterator it = rows.begin();
+          it != rows.end(); ++it ) {
+        mergedFile << it->second << "\n";
+    }
+}
@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "SobolAnalyzer.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "BatchEvaluator.h"
+#include "MonteCarloSimulator.h"
+
+// Results printed with their most influential parameters
+static const int printedValueIDs[] = {
+    DramResult::TRCD, DramResult::TRAS, DramResult::TRC,
+    DramResult::IDD0, DramResult::IDD5B, DramResult::CHANNEL_AREA
+};
+
+static const unsigned int nPrintedParameters = 3;
+
+SobolAnalyzer::SobolAnalyzer(bool IOTerminationCurrentFlag,
+                             unsigned int nJobs) :
+    IOTerminationCurrentFlag(IOTerminationCurrentFlag),
+    nJobs(nJobs)
+{
+    nSamples = 4096;
+    seed = 1;
+    nRejected = 0;
+    nEvaluations = 0;
+    nRows = 0;
+}
+
+void
+SobolAnalyzer::readSpecification(const string& specificationFileName)
+{
+    rapidjson::Document specification;
+    string exceptionMsgThrown;
+    try {
+        baseInputs = TechnologyValues::readSpecification(
+                         specificationFileName, "Sobol", "Sobol specification",
+                         specification, exceptionMsgThrown);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    if ( specification.HasMember("samples") ) {
+        if ( !specification["samples"].IsUint64()
+             || specification["samples"].GetUint64() < 2 ) {
+            exceptionMsgThrown.append("gives no number of \"samples\" ");
+            exceptionMsgThrown.append("from 2.\n");
+            throw exceptionMsgThrown;
+        }
+        nSamples = specification["samples"].GetUint64();
+    }
+    if ( specification.HasMember("seed") ) {
+        if ( !specification["seed"].IsUint64() ) {
+            exceptionMsgThrown.append("gives no \"seed\" of a number ");
+            exceptionMsgThrown.append("from 0.\n");
+            throw exceptionMsgThrown;
+        }
+        seed = specification["seed"].GetUint64();
+    }
+
+    if ( !specification.HasMember("parameters")
+         || !specification["parameters"].IsObject()
+         || specification["parameters"].MemberCount() == 0 ) {
+        exceptionMsgThrown.append("needs \"parameters\", an object of ");
+        exceptionMsgThrown.append("input parameter ranges.\n");
+        throw exceptionMsgThrown;
+    }
+    sobolParameters.clear();
+    const rapidjson::Value& parameterList = specification["parameters"];
+    for ( rapidjson::Value::ConstMemberIterator member
+                = parameterList.MemberBegin();
+          member != parameterList.MemberEnd(); ++member ) {
+        string name(member->name.GetString());
+        const rapidjson::Value& range = member->value;
+        bool isRange = range.IsArray() && range.Size() == 2
+                       && range[0].IsNumber() && range[1].IsNumber();
+        if ( !range.IsNumber() && !isRange ) {
+            exceptionMsgThrown.append("gives \"");
+            exceptionMsgThrown.append(name);
+            exceptionMsgThrown.append("\" neither a relative range nor a ");
+            exceptionMsgThrown.append("pair of numbers.\n");
+            throw exceptionMsgThrown;
+        }
+        try {
+            if ( isRange ) {
+                addRange(name, range[0].GetDouble(), range[1].GetDouble());
+            }
+            else {
+                addRelativeRange(name, range.GetDouble());
+            }
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+    }
+}
+
+void
+SobolAnalyzer::addRelativeRange(const string& name, double relativeRange)
+{
+    double value;
+    try {
+        value = TechnologyValues::findContinuousField(
+                    name, baseInputs, "Range", "range")->getNumber(baseInputs);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+    double deviation = fabs(relativeRange * value);
+    try {
+        addRange(name, value - deviation, value + deviation);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+}
+
+void
+SobolAnalyzer::addRange(const string& name, double minimum, double maximum)
+{
+    SobolParameter parameter;
+    try {
+        parameter.field = TechnologyValues::findContinuousField(
+                name, baseInputs, "Range", "range");
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+    if ( minimum >= maximum ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Range of \"");
+        exceptionMsgThrown.append(name);
+        exceptionMsgThrown.append("\" must not be empty.\n");
+        throw exceptionMsgThrown;
+    }
+    parameter.minimum = minimum;
+    parameter.maximum = maximum;
+    sobolParameters.push_back(parameter);
+}
+
+TechnologyValues
+SobolAnalyzer::rowInputs(unsigned long row, unsigned int matrix) const
+{
+    TechnologyValues inputs(baseInputs);
+    unsigned int nParameters = sobolParameters.size();
+    for ( unsigned int it = 0; it < nParameters; it++ ) {
+        // Column of B: the draws after the ones of A
+        bool isFromB = ( matrix == 1 || matrix == it + 2 );
+        double uniform = MonteCarloSimulator::counterUniform(
+                             seed, row, it + ( isFromB ? nParameters : 0 ));
+        const SobolParameter& parameter = sobolParameters[it];
+        parameter.field->setNumber(inputs, parameter.minimum
+                                           + uniform * (parameter.maximum
+                                                        - parameter.minimum));
+    }
+    return inputs;
+}
+
+void
+SobolAnalyzer::analyze()
+{
+    unsigned int nParameters = sobolParameters.size();
+    unsigned int nMatrices = nParameters + 2;
+
+    DramResult base;
+    try {
+        Current dram(baseInputs, IOTerminationCurrentFlag);
+        base.collect(dram);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    nRows = 0;
+    nRejected = 0;
+    nEvaluations = 1;
+    sums.assign(DramResult::N_VALUES, 0.0);
+    squareSums.assign(DramResult::N_VALUES, 0.0);
+    firstOrderSums.assign(nParameters,
+                          vector<double>(DramResult::N_VALUES, 0.0));
+    totalEffectSums.assign(nParameters,
+                           vector<double>(DramResult::N_VALUES, 0.0));
+
+    BatchEvaluator evaluator(nJobs);
+    unsigned long nBatchRows = max(1u, batchSize / nMatrices);
+    vector<TechnologyValues> batch;
+    vector<DramResult> results;
+    vector<string> errors;
+    for ( unsigned long first = 0; first < nSamples; first += nBatchRows ) {
+        unsigned long last = min(nSamples, first + nBatchRows);
+        batch.clear();
+        for ( unsigned long row = first; row < last; row++ ) {
+            for ( unsigned int matrix = 0; matrix < nMatrices; matrix++ ) {
+                batch.push_back(rowInputs(row, matrix));
+            }
+        }
+        evaluator.evaluate(batch, IOTerminationCurrentFlag, results, errors);
+        nEvaluations += batch.size();
+
+        for ( unsigned long row = 0; row < last - first; row++ ) {
+            unsigned long offset = row * nMatrices;
+            bool isRejected = false;
+            for ( unsigned int matrix = 0; matrix < nMatrices; matrix++ ) {
+                isRejected = isRejected || !errors[offset + matrix].empty();
+            }
+            if ( isRejected ) {
+                nRejected++;
+                continue;
+            }
+            nRows++;
+            for ( int valueID = 0; valueID < DramResult::N_VALUES;
+                  valueID++ ) {
+                double center = base.values[valueID];
+                double a = results[offset].values[valueID] - center;
+                double b = results[offset + 1].values[valueID] - center;
+                sums[valueID] += a + b;
+                squareSums[valueID] += a*a + b*b;
+                for ( unsigned int it = 0; it < nParameters; it++ ) {
+                    double ab = results[offset + it + 2].values[valueID]
+                                - center;
+                    firstOrderSums[it][valueID] += b * (ab - a);
+                    totalEffectSums[it][valueID] += (a - ab) * (a - ab);
+                }
+            }
+        }
+    }
+}
+
+double
+SobolAnalyzer::variance(int valueID) const
+{
+    // Results of A and B together
+    unsigned long nValues = 2 * nRows;
+    if ( nValues < 2 ) {
+        return 0;
+    }
+    double mean = sums[valueID] / nValues;
+    return max(0.0, ( squareSums[valueID] - nValues * mean * mean )
+                    / (nValues - 1));
+}
+
+double
+SobolAnalyzer::firstOrder(unsigned int it, int valueID) const
+{
+    double resultVariance = variance(valueID);
+    if ( resultVariance == 0 ) {
+        return 0;
+    }
+    return firstOrderSums[it][valueID] / nRows / resultVariance;
+}
+
+double
+SobolAnalyzer::totalEffect(unsigned int it, int valueID) const
+{
+    double resultVariance = variance(valueID);
+    if ( resultVariance == 0 ) {
+        return 0;
+    }
+    return totalEffectSums[it][valueID] / (2.0 * nRows) / resultVariance;
+}
+
+void
+SobolAnalyzer::writeIndices(ostream& indexFile) const
+{
+    indexFile << "Result,Variance,Parameter,FirstOrder,TotalEffect\n";
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        if ( variance(valueID) == 0 ) {
+            continue;
+        }
+        for ( unsigned int it = 0; it < sobolParameters.size(); it++ ) {
+            indexFile << DramResult::names[valueID];
+            shortestDoubleToString(variance(valueID), buffer);
+            indexFile << "," << buffer << ","
+                      << sobolParameters[it].field->name;
+            shortestDoubleToString(firstOrder(it, valueID), buffer);
+            indexFile << "," << buffer;
+            shortestDoubleToString(totalEffect(it, valueID), buffer);
+            indexFile << "," << buffer << "\n";
+        }
+    }
+}
+
+void
+SobolAnalyzer::printIndices(ostream& output) const
+{
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+    for ( unsigned int printed = 0;
+          printed < sizeof(printedValueIDs) / sizeof(printedValueIDs[0]);
+          printed++ ) {
+        int valueID = printedValueIDs[printed];
+        output << DramResult::names[valueID] << ":";
+        if ( variance(valueID) == 0 ) {
+            output << " no variance" << endl;
+            continue;
+        }
+        vector<pair<double, unsigned int> > ranking;
+        for ( unsigned int it = 0; it < sobolParameters.size(); it++ ) {
+            ranking.push_back(make_pair(-totalEffect(it, valueID), it));
+        }
+        sort(ranking.begin(), ranking.end());
+        for ( unsigned int it = 0;
+              it < ranking.size() && it < nPrintedParameters; it++ ) {
+            unsigned int parameter = ranking[it].second;
+            output << ( it > 0 ? "," : "" ) << " "
+                   << sobolParameters[parameter].field->name << " ";
+            shortestDoubleToString(firstOrder(parameter, valueID), buffer);
+            output << buffer << "/";
+            shortestDoubleToString(totalEffect(parameter, valueID), buffer);
+            output << buffer;
+        }
+        output << endl;
+    }
+    output << "(first-order/total-effect indices) " << nSamples
+           << " samples of " << sobolParameters.size() << " parameters, "
+           << nEvaluations << " evaluations, " << nRejected
+           << " samples rejected by the model" << endl;
+}
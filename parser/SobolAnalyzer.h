@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef SOBOLANALYZER_H
+#define SOBOLANALYZER_H
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <cstdint>
+
+#include "TechnologyValues.h"
+#include "DramResult.h"
+
+using namespace std;
+
+// Range of one input parameter, drawn uniformly
+struct SobolParameter
+{
+    const TechnologyField* field;
+    double minimum;
+    double maximum;
+};
+
+// Variance-based (Sobol) sensitivity indices of the results over ranges of
+//  input parameters (-sobol <specification>):
+//   {
+//     "technology": "<technology file>",
+//     "architecture": "<architecture file>",
+//     "samples": 4096,
+//     "seed": 1,
+//     "parameters": {
+//       "CellCapacitance[fF]": 0.2,
+//       "Temperature[C]": [25, 80]
+//     }
+//   }
+// A number is a relative range (0.2: +-20%), a pair an absolute one.
+// Saltelli scheme: two independent sample matrices A and B, and for each
+//  parameter i the matrix A with column i taken from B. The results of A
+//  and B are shared by the estimators of all parameters, so k parameters
+//  take samples * (k + 2) evaluations. First-order indices by Saltelli
+//  (2010), total effects by Jansen (1999). Rows are evaluated in batches
+//  and only sums are kept.
+class SobolAnalyzer
+{
+public:
+    SobolAnalyzer(bool IOTerminationCurrentFlag, unsigned int nJobs);
+
+    void readSpecification(const string& specificationFileName);
+
+    void addRelativeRange(const string& name, double relativeRange);
+    void addRange(const string& name, double minimum, double maximum);
+
+    void analyze();
+
+    const vector<SobolParameter>& parameters() const { return sobolParameters; }
+    // Indices of parameter it (in the order of parameters())
+    double firstOrder(unsigned int it, int valueID) const;
+    double totalEffect(unsigned int it, int valueID) const;
+    // Variance of the result over the ranges
+    double variance(int valueID) const;
+
+    void writeIndices(ostream& indexFile) const;
+    void printIndices(ostream& output) const;
+
+    // Base configuration, -D overrides are applied by the caller
+    TechnologyValues baseInputs;
+
+    unsigned long nSamples;
+    uint64_t seed;
+    // Rows with an evaluation which the model rejects, left out
+    unsigned long nRejected;
+    unsigned long nEvaluations;
+
+    // Evaluations of a batch of rows, at most
+    static const unsigned int batchSize = 1024;
+
+private:
+    // Row of matrix A (0) or B (1), or of A with column i from B (i + 2)
+    TechnologyValues rowInputs(unsigned long row, unsigned int matrix) const;
+
+    bool IOTerminationCurrentFlag;
+    unsigned int nJobs;
+    vector<SobolParameter> sobolParameters;
+
+    // Sums over the rows, results centered on the base configuration
+    unsigned long nRows;
+    vector<double> sums;
+    vector<double> squareSums;
+    // Per parameter and result
+    vector<vector<double> > firstOrderSums;
+    vector<vector<double> > totalEffectSums;
+};
+
+#endif // SOBOLANALYZER_H
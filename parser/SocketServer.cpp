@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "SocketServer.h"
+
+#include <cstring>
+#include <cerrno>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+// A client which went away must not terminate the server by SIGPIPE:
+//  Linux suppresses it per send, macOS per socket (SO_NOSIGPIPE)
+#ifdef MSG_NOSIGNAL
+static const int sendFlags = MSG_NOSIGNAL;
+#else
+static const int sendFlags = 0;
+#endif
+
+SocketServer::SocketServer(const string& socketPath,
+                           EvaluationService& service) :
+    socketPath(socketPath),
+    service(service)
+{
+    listenSocket = -1;
+}
+
+SocketServer::~SocketServer()
+{
+    reapClients(true);
+    if ( listenSocket >= 0 ) {
+        close(listenSocket);
+        unlink(socketPath.c_str());
+    }
+}
+
+void
+SocketServer::open()
+{
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if ( socketPath.size() >= sizeof(address.sun_path) ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Socket path \'");
+        exceptionMsgThrown.append(socketPath);
+        exceptionMsgThrown.append("\' is too long.\n");
+        throw exceptionMsgThrown;
+    }
+    strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+    // A socket left behind by a previous server would block the address.
+    // Anything else found at the path, as well as the socket of a server
+    //  which is still running, is left alone.
+    struct stat pathStatus;
+    if ( lstat(socketPath.c_str(), &pathStatus) == 0 ) {
+        string reason;
+        if ( !S_ISSOCK(pathStatus.st_mode) ) {
+            reason = "exists and is not a socket";
+        }
+        else {
+            int probeSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+            int probeError = 0;
+            if ( probeSocket < 0 ) {
+                probeError = errno;
+            }
+            else if ( connect(probeSocket, (struct sockaddr*) &address,
+                              sizeof(address)) != 0 ) {
+                probeError = errno;
+            }
+            if ( probeSocket >= 0 ) {
+                close(probeSocket);
+            }
+
+            if ( probeError == 0 ) {
+                reason = "is used by a running server";
+            }
+            else if ( probeError != ECONNREFUSED ) {
+                reason = "could not be checked: ";
+                reason.append(strerror(probeError));
+            }
+            else if ( unlink(socketPath.c_str()) != 0 && errno != ENOENT ) {
+                reason = "could not be removed: ";
+                reason.append(strerror(errno));
+            }
+        }
+
+        if ( !reason.empty() ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Socket path \'");
+            exceptionMsgThrown.append(socketPath);
+            exceptionMsgThrown.append("\' ");
+            exceptionMsgThrown.append(reason);
+            exceptionMsgThrown.append(".\n");
+            throw exceptionMsgThrown;
+        }
+    }
+
+    listenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+    if ( listenSocket < 0 ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Could not create a socket: ");
+        exceptionMsgThrown.append(strerror(errno));
+        exceptionMsgThrown.append(".\n");
+        throw exceptionMsgThrown;
+    }
+
+    if ( bind(listenSocket, (struct sockaddr*) &address, sizeof(address)) != 0
+         || listen(listenSocket, SOMAXCONN) != 0 ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Could not listen on socket \'");
+        exceptionMsgThrown.append(socketPath);
+        exceptionMsgThrown.append("\': ");
+        exceptionMsgThrown.append(strerror(errno));
+        exceptionMsgThrown.append(".\n");
+        close(listenSocket);
+        listenSocket = -1;
+        throw exceptionMsgThrown;
+    }
+}
+
+void
+SocketServer::run()
+{
+    while ( !service.isShutdownRequested() ) {
+        struct pollfd listenPoll = {listenSocket, POLLIN, 0};
+        int nReady = poll(&listenPoll, 1, pollInterval);
+        reapClients(false);
+        if ( nReady <= 0 ) {
+            continue;
+        }
+
+        int clientSocket = accept(listenSocket, NULL, NULL);
+        if ( clientSocket < 0 ) {
+            continue;
+        }
+#ifdef SO_NOSIGPIPE
+        int noSigPipe = 1;
+        setsockopt(clientSocket, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe,
+                   sizeof(noSigPipe));
+#endif
+
+        clients.push_back(unique_ptr<Client>(new Client));
+        Client* client = clients.back().get();
+        client->socket = clientSocket;
+        client->isDone.store(false);
+        client->worker = thread(&SocketServer::serveClient, this, client);
+    }
+
+    reapClients(true);
+}
+
+void
+SocketServer::serveClient(Client* client)
+{
+    string pending;
+    char buffer[4096];
+    bool isOpen = true;
+
+    while ( isOpen && !service.isShutdownRequested() ) {
+        struct pollfd clientPoll = {client->socket, POLLIN, 0};
+        if ( poll(&clientPoll, 1, pollInterval) <= 0 ) {
+            continue;
+        }
+
+        ssize_t nRead = recv(client->socket, buffer, sizeof(buffer), 0);
+        if ( nRead <= 0 ) {
+            break;
+        }
+        pending.append(buffer, nRead);
+
+        size_t lineEnd;
+        while ( isOpen && (lineEnd = pending.find('\n')) != string::npos ) {
+            string requestLine(pending, 0, lineEnd);
+            pending.erase(0, lineEnd + 1);
+            if ( requestLine.find_first_not_of(" \t\r") == string::npos ) {
+                continue;
+            }
+            isOpen = sendLine(client->socket,
+                              service.handleRequest(requestLine));
+        }
+
+        if ( pending.size() > maxRequestLength ) {
+            sendLine(client->socket,
+                     "{\"ok\":false,\"error\":\"[ERROR] Request is too long.\"}");
+            break;
+        }
+    }
+
+    close(client->socket);
+    client->isDone.store(true);
+}
+
+bool
+SocketServer::sendLine(int socket, const string& line)
+{
+    string message(line + "\n");
+    size_t nSent = 0;
+    while ( nSent < message.size() ) {
+        ssize_t n = send(socket, message.data() + nSent,
+                         message.size() - nSent, sendFlags);
+        if ( n < 0 && errno == EINTR ) {
+            continue;
+        }
+        if ( n <= 0 ) {
+            return false;
+        }
+        nSent += n;
+    }
+    return true;
+}
+
+void
+SocketServer::reapClients(bool waitForAll)
+{
+    list<unique_ptr<Client>>::iterator client = clients.begin();
+    while ( client != clients.end() ) {
+        if ( waitForAll || (*client)->isDone.load() ) {
+            (*client)->worker.join();
+            client = clients.erase(client);
+        }
+        else {
+            ++client;
+        }
+    }
+}
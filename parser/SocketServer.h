@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef SOCKETSERVER_H
+#define SOCKETSERVER_H
+
+#include <string>
+#include <list>
+#include <thread>
+#include <atomic>
+#include <memory>
+
+#include "EvaluationService.h"
+
+using namespace std;
+
+// Accepts connections on a Unix domain socket and hands every request
+//  line of a client to the evaluation service, answering with one line.
+// Each client is served by its own thread, so a slow client does not
+//  hold up the others. Runs until the service is asked to shut down.
+class SocketServer
+{
+public:
+    SocketServer(const string& socketPath, EvaluationService& service);
+    ~SocketServer();
+
+    void open();
+    void run();
+
+    // Longest accepted request line, longer requests close the connection
+    static const size_t maxRequestLength = 1 << 20;
+    // Interval at which waiting threads look for a shutdown request [ms]
+    static const int pollInterval = 200;
+
+private:
+    struct Client {
+        int socket;
+        thread worker;
+        atomic<bool> isDone;
+    };
+
+    void serveClient(Client* client);
+    bool sendLine(int socket, const string& line);
+    void reapClients(bool waitForAll);
+
+    string socketPath;
+    EvaluationService& service;
+    int listenSocket;
+    list<unique_ptr<Client>> clients;
+};
+
+#endif // SOCKETSERVER_H
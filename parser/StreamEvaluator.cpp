@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "StreamEvaluator.h"
+
+StreamEvaluator::StreamEvaluator(EvaluationService& service,
+                                 unsigned int nWorkers, size_t maxInFlight) :
+    service(service),
+    nWorkers(nWorkers > 0 ? nWorkers : 1),
+    maxInFlight(maxInFlight > 0 ? maxInFlight : 1)
+{
+    nInFlight = 0;
+    isInputDone = false;
+}
+
+void
+StreamEvaluator::run(istream& in, ostream& out)
+{
+    vector<thread> workers;
+    for ( unsigned int it = 0; it < nWorkers; it++ ) {
+        workers.push_back(thread(&StreamEvaluator::work, this, ref(out)));
+    }
+
+    string requestLine;
+    unsigned long lineNumber = 0;
+    while ( getline(in, requestLine) ) {
+        lineNumber++;
+        // Lines after a shutdown request are left unanswered
+        if ( service.isShutdownRequested() ) {
+            break;
+        }
+        if ( requestLine.find_first_not_of(" \t\r") == string::npos ) {
+            continue;
+        }
+
+        unique_lock<mutex> lock(queueMutex);
+        slotAvailable.wait(lock, [this]() {
+            return nInFlight < maxInFlight;
+        });
+        requests.push_back(make_pair(lineNumber, requestLine));
+        nInFlight++;
+        lock.unlock();
+        requestAvailable.notify_one();
+    }
+
+    {
+        lock_guard<mutex> lock(queueMutex);
+        isInputDone = true;
+    }
+    requestAvailable.notify_all();
+
+    for ( unsigned int it = 0; it < workers.size(); it++ ) {
+        workers[it].join();
+    }
+}
+
+void
+StreamEvaluator::work(ostream& out)
+{
+    while ( true ) {
+        string requestLine;
+        unsigned long lineNumber;
+        {
+            unique_lock<mutex> lock(queueMutex);
+            requestAvailable.wait(lock, [this]() {
+                return !requests.empty() || isInputDone;
+            });
+            if ( requests.empty() ) {
+                return;
+            }
+            lineNumber = requests.front().first;
+            requestLine.swap(requests.front().second);
+            requests.pop_front();
+        }
+
+        string response = service.handleRequest(requestLine, lineNumber);
+        {
+            // Each answer is flushed, the reader may be waiting for it
+            lock_guard<mutex> lock(outputMutex);
+            out << response << '\n';
+            out.flush();
+        }
+
+        {
+            lock_guard<mutex> lock(queueMutex);
+            nInFlight--;
+        }
+        slotAvailable.notify_one();
+    }
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef STREAMEVALUATOR_H
+#define STREAMEVALUATOR_H
+
+#include <iostream>
+#include <string>
+#include <deque>
+#include <utility>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "EvaluationService.h"
+
+using namespace std;
+
+// Evaluates request lines read from an input stream (see -stream), each
+//  answered by one line on the output stream as soon as it is evaluated,
+//  so answers may come in another order than the requests. Every answer
+//  carries the "id" of its request, or the line number of the request
+//  (counting from 1) if it has none.
+// At most maxInFlight requests are read ahead of their answers: when the
+//  workers fall behind, reading the input waits, and when the output is
+//  not read, the workers wait.
+class StreamEvaluator
+{
+public:
+    StreamEvaluator(EvaluationService& service, unsigned int nWorkers,
+                    size_t maxInFlight);
+
+    void run(istream& in, ostream& out);
+
+private:
+    void work(ostream& out);
+
+    EvaluationService& service;
+    unsigned int nWorkers;
+    size_t maxInFlight;
+
+    mutex queueMutex;
+    condition_variable requestAvailable;
+    condition_variable slotAvailable;
+    // Request lines with their line numbers
+    deque<pair<unsigned long, string>> requests;
+    size_t nInFlight;
+    bool isInputDone;
+
+    mutex outputMutex;
+};
+
+#endif // STREAMEVALUATOR_H
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "StreamingStatistics.h"
+
+#include <algorithm>
+#include <limits>
+
+QuantileEstimator::QuantileEstimator(double probability) :
+    probability(probability)
+{
+    nValues = 0;
+    for ( int marker = 0; marker < 5; marker++ ) {
+        heights[marker] = 0;
+        positions[marker] = marker + 1;
+    }
+    desiredPositions[0] = 1;
+    desiredPositions[1] = 1 + 2 * probability;
+    desiredPositions[2] = 1 + 4 * probability;
+    desiredPositions[3] = 3 + 2 * probability;
+    desiredPositions[4] = 5;
+    increments[0] = 0;
+    increments[1] = probability / 2;
+    increments[2] = probability;
+    increments[3] = (1 + probability) / 2;
+    increments[4] = 1;
+}
+
+double
+QuantileEstimator::parabolic(int marker, double direction) const
+{
+    return heights[marker]
+           + direction / (positions[marker+1] - positions[marker-1])
+             * ( (positions[marker] - positions[marker-1] + direction)
+                 * (heights[marker+1] - heights[marker])
+                 / (positions[marker+1] - positions[marker])
+                 + (positions[marker+1] - positions[marker] - direction)
+                   * (heights[marker] - heights[marker-1])
+                   / (positions[marker] - positions[marker-1]) );
+}
+
+double
+QuantileEstimator::linear(int marker, int direction) const
+{
+    return heights[marker]
+           + direction * (heights[marker+direction] - heights[marker])
+             / (positions[marker+direction] - positions[marker]);
+}
+
+void
+QuantileEstimator::add(double value)
+{
+    // The first five values are the markers
+    if ( nValues < 5 ) {
+        heights[nValues] = value;
+        nValues++;
+        if ( nValues == 5 ) {
+            sort(heights, heights + 5);
+        }
+        return;
+    }
+    nValues++;
+
+    int cell;
+    if ( value < heights[0] ) {
+        heights[0] = value;
+        cell = 0;
+    }
+    else if ( value >= heights[4] ) {
+        heights[4] = value;
+        cell = 3;
+    }
+    else {
+        cell = 0;
+        while ( value >= heights[cell+1] ) {
+            cell++;
+        }
+    }
+    for ( int marker = cell + 1; marker < 5; marker++ ) {
+        positions[marker]++;
+    }
+    for ( int marker = 0; marker < 5; marker++ ) {
+        desiredPositions[marker] += increments[marker];
+    }
+
+    for ( int marker = 1; marker < 4; marker++ ) {
+        double offset = desiredPositions[marker] - positions[marker];
+        if ( ( offset >= 1 && positions[marker+1] - positions[marker] > 1 )
+             || ( offset <= -1
+                  && positions[marker-1] - positions[marker] < -1 ) ) {
+            int direction = ( offset > 0 ? 1 : -1 );
+            double height = parabolic(marker, direction);
+            if ( heights[marker-1] < height && height < heights[marker+1] ) {
+                heights[marker] = height;
+            }
+            else {
+                heights[marker] = linear(marker, direction);
+            }
+            positions[marker] += direction;
+        }
+    }
+}
+
+double
+QuantileEstimator::quantile() const
+{
+    if ( nValues == 0 ) {
+        return 0;
+    }
+    if ( nValues >= 5 ) {
+        return heights[2];
+    }
+    // Nearest rank of the few values so far
+    vector<double> values(heights, heights + nValues);
+    sort(values.begin(), values.end());
+    unsigned int rank = probability * (nValues - 1) + 0.5;
+    return values[rank];
+}
+
+static const double defaultProbabilities[] = { 0.05, 0.5, 0.95 };
+
+StreamingStatistics::StreamingStatistics()
+{
+    nValues = 0;
+    runningMean = 0;
+    squaredDeviations = 0;
+    smallest = numeric_limits<double>::max();
+    largest = -numeric_limits<double>::max();
+    for ( unsigned int it = 0;
+          it < sizeof(defaultProbabilities) / sizeof(defaultProbabilities[0]);
+          it++ ) {
+        estimators.push_back(QuantileEstimator(defaultProbabilities[it]));
+    }
+}
+
+StreamingStatistics::StreamingStatistics(const vector<double>& probabilities)
+{
+    nValues = 0;
+    runningMean = 0;
+    squaredDeviations = 0;
+    smallest = numeric_limits<double>::max();
+    largest = -numeric_limits<double>::max();
+    for ( unsigned int it = 0; it < probabilities.size(); it++ ) {
+        estimators.push_back(QuantileEstimator(probabilities[it]));
+    }
+}
+
+void
+StreamingStatistics::add(double value)
+{
+    nValues++;
+    double deviation = value - runningMean;
+    runningMean += deviation / nValues;
+    squaredDeviations += deviation * (value - runningMean);
+    smallest = min(smallest, value);
+    largest = max(largest, value);
+    for ( unsigned int it = 0; it < estimators.size(); it++ ) {
+        estimators[it].add(value);
+    }
+}
+
+double
+StreamingStatistics::variance() const
+{
+    return ( nValues < 2 ? 0 : squaredDeviations / (nValues - 1) );
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef STREAMINGSTATISTICS_H
+#define STREAMINGSTATISTICS_H
+
+#include <vector>
+
+using namespace std;
+
+// Estimate of one quantile which keeps five markers instead of the values
+//  (P-square algorithm, R. Jain and I. Chlamtac, Communications of the
+//  ACM 28(10), 1985). The markers follow the minimum, the quantile, the
+//  maximum and the quantiles halfway between, adjusted by piecewise
+//  parabolic interpolation.
+class QuantileEstimator
+{
+public:
+    explicit QuantileEstimator(double probability);
+
+    void add(double value);
+    double quantile() const;
+
+    double probability;
+
+private:
+    double parabolic(int marker, double direction) const;
+    double linear(int marker, int direction) const;
+
+    unsigned long nValues;
+    double heights[5];
+    double positions[5];
+    double desiredPositions[5];
+    double increments[5];
+};
+
+// Count, mean, variance (Welford), extremes and quantiles of a stream of
+//  values, none of which is stored
+class StreamingStatistics
+{
+public:
+    // Quantiles of the given probabilities, by default 5%, 50% and 95%
+    StreamingStatistics();
+    explicit StreamingStatistics(const vector<double>& probabilities);
+
+    void add(double value);
+
+    unsigned long count() const { return nValues; }
+    double mean() const { return runningMean; }
+    // Sample variance (n - 1), 0 for fewer than two values
+    double variance() const;
+    double minimum() const { return smallest; }
+    double maximum() const { return largest; }
+    const vector<QuantileEstimator>& quantiles() const { return estimators; }
+
+private:
+    unsigned long nValues;
+    double runningMean;
+    double squaredDeviations;
+    double smallest;
+    double largest;
+    vector<QuantileEstimator> estimators;
+};
+
+#endif // STREAMINGSTATISTICS_H
@@ -0,0 +1,419 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "SubarraySizer.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "../core/Timing.h"
+
+static const double defaultCandidates[] = { 128, 256, 512, 1024, 2048 };
+
+SubarraySizer::SubarraySizer()
+{
+    nTimingEvaluations = 0;
+    nGeometryEvaluations = 0;
+    trcdBudget = 0;
+    trasBudget = 0;
+    vector<double> candidates(defaultCandidates,
+                              defaultCandidates
+                              + sizeof(defaultCandidates)
+                                / sizeof(defaultCandidates[0]));
+    setCandidates(candidates, candidates);
+}
+
+// List of cell counts from the specification, empty without the member
+static vector<double>
+readCandidates(const rapidjson::Document& specification, const char* name,
+               const string& exceptionMsgThrown)
+{
+    vector<double> candidates;
+    if ( !specification.HasMember(name) ) {
+        return candidates;
+    }
+    const rapidjson::Value& list = specification[name];
+    bool isValid = list.IsArray() && list.Size() > 0;
+    for ( rapidjson::SizeType it = 0; isValid && it < list.Size(); it++ ) {
+        isValid = list[it].IsNumber();
+        if ( isValid ) {
+            candidates.push_back(list[it].GetDouble());
+        }
+    }
+    if ( !isValid ) {
+        string listMsgThrown(exceptionMsgThrown);
+        listMsgThrown.append("gives no list of numbers as \"");
+        listMsgThrown.append(name);
+        listMsgThrown.append("\".\n");
+        throw listMsgThrown;
+    }
+    return candidates;
+}
+
+void
+SubarraySizer::readSpecification(const string& specificationFileName)
+{
+    rapidjson::Document specification;
+    string exceptionMsgThrown;
+    try {
+        baseInputs = TechnologyValues::readSpecification(
+                         specificationFileName, "subarray", "Subarray specification",
+                         specification, exceptionMsgThrown);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    const char* const overriddenNames[] = {
+        "ChannelSize[Gb]",
+        "RedundantCellsPerSubarrayRow[]",
+        "RedundantCellsPerSubarrayColumn[]"
+    };
+    for ( unsigned int it = 0; it < 3; it++ ) {
+        const char* name = overriddenNames[it];
+        if ( !specification.HasMember(name) ) {
+            continue;
+        }
+        // The channel size is positive, the redundant cells may be none
+        bool isCount = TechnologyValues::findField(name)->isInteger;
+        double value = ( specification[name].IsNumber()
+                         ? specification[name].GetDouble() : -1 );
+        if ( isCount && ( value < 0 || !isInteger(value) ) ) {
+            exceptionMsgThrown.append("gives no count (0 or more) as \"");
+            exceptionMsgThrown.append(name);
+            exceptionMsgThrown.append("\".\n");
+            throw exceptionMsgThrown;
+        }
+        if ( !isCount && value <= 0 ) {
+            exceptionMsgThrown.append("gives no positive number as \"");
+            exceptionMsgThrown.append(name);
+            exceptionMsgThrown.append("\".\n");
+            throw exceptionMsgThrown;
+        }
+        TechnologyValues::findField(name)->setNumber(baseInputs, value);
+    }
+
+    if ( !specification.HasMember("budget")
+         || !specification["budget"].IsObject() ) {
+        exceptionMsgThrown.append("needs a \"budget\" of \"tRCD[ns]\" ");
+        exceptionMsgThrown.append("and/or \"tRAS[ns]\".\n");
+        throw exceptionMsgThrown;
+    }
+    const rapidjson::Value& budget = specification["budget"];
+    double budgets[2] = { 0, 0 };
+    const char* const budgetNames[] = { "tRCD[ns]", "tRAS[ns]" };
+    for ( unsigned int it = 0; it < 2; it++ ) {
+        if ( !budget.HasMember(budgetNames[it]) ) {
+            continue;
+        }
+        if ( !budget[budgetNames[it]].IsNumber()
+             || budget[budgetNames[it]].GetDouble() <= 0 ) {
+            exceptionMsgThrown.append("gives no positive budget for \"");
+            exceptionMsgThrown.append(budgetNames[it]);
+            exceptionMsgThrown.append("\".\n");
+            throw exceptionMsgThrown;
+        }
+        budgets[it] = budget[budgetNames[it]].GetDouble();
+    }
+    if ( budgets[0] == 0 && budgets[1] == 0 ) {
+        exceptionMsgThrown.append("needs a \"budget\" of \"tRCD[ns]\" ");
+        exceptionMsgThrown.append("and/or \"tRAS[ns]\".\n");
+        throw exceptionMsgThrown;
+    }
+    setBudget(budgets[0], budgets[1]);
+
+    try {
+        vector<double> rows = readCandidates(specification,
+                                             "CellsPerSubarrayRow[]",
+                                             exceptionMsgThrown);
+        vector<double> columns = readCandidates(specification,
+                                                "CellsPerSubarrayColumn[]",
+                                                exceptionMsgThrown);
+        if ( !rows.empty() || !columns.empty() ) {
+            setCandidates( rows.empty()
+                           ? vector<double>(rowCandidates.begin(),
+                                            rowCandidates.end())
+                           : rows,
+                           columns.empty()
+                           ? vector<double>(columnCandidates.begin(),
+                                            columnCandidates.end())
+                           : columns );
+        }
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+}
+
+void
+SubarraySizer::setBudget(double trcdBudget, double trasBudget)
+{
+    this->trcdBudget = trcdBudget;
+    this->trasBudget = trasBudget;
+}
+
+// Sorted, without duplicates
+static vector<unsigned int>
+cellCounts(const vector<double>& candidates, const char* name)
+{
+    vector<unsigned int> counts;
+    for ( unsigned int it = 0; it < candidates.size(); it++ ) {
+        if ( candidates[it] < 1 || candidates[it] != floor(candidates[it]) ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Candidate \"");
+            exceptionMsgThrown.append(name);
+            exceptionMsgThrown.append("\" must be positive integers.\n");
+            throw exceptionMsgThrown;
+        }
+        counts.push_back(candidates[it]);
+    }
+    sort(counts.begin(), counts.end());
+    counts.erase(unique(counts.begin(), counts.end()), counts.end());
+    return counts;
+}
+
+void
+SubarraySizer::setCandidates(const vector<double>& cellsPerRow,
+                             const vector<double>& cellsPerColumn)
+{
+    try {
+        rowCandidates = cellCounts(cellsPerRow, "CellsPerSubarrayRow[]");
+        columnCandidates = cellCounts(cellsPerColumn,
+                                      "CellsPerSubarrayColumn[]");
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+}
+
+TechnologyValues
+SubarraySizer::inputsOf(unsigned int cellsPerRow,
+                        unsigned int cellsPerColumn) const
+{
+    TechnologyValues inputs(baseInputs);
+    inputs.cellsPerLWL = cellsPerRow + baseInputs.cellsPerLWLRedundancy;
+    inputs.cellsPerLBL = cellsPerColumn + baseInputs.cellsPerLBLRedundancy;
+    return inputs;
+}
+
+const SubarraySizer::Evaluation&
+SubarraySizer::geometry(unsigned int cellsPerRow, unsigned int cellsPerColumn)
+{
+    pair<unsigned int, unsigned int> key(cellsPerRow, cellsPerColumn);
+    map<pair<unsigned int, unsigned int>, Evaluation>::iterator found
+            = geometries.find(key);
+    if ( found != geometries.end() ) {
+        return found->second;
+    }
+
+    Evaluation evaluation;
+    evaluation.size.cellsPerRow = cellsPerRow;
+    evaluation.size.cellsPerColumn = cellsPerColumn;
+    evaluation.size.trcd = INVALID_VALUE;
+    evaluation.size.tras = INVALID_VALUE;
+    nGeometryEvaluations++;
+    try {
+        Channel channel(inputsOf(cellsPerRow, cellsPerColumn));
+        evaluation.size.channelArea = channel.channelArea.value();
+        evaluation.isValid = true;
+    } catch(string exceptionMsgThrown) {
+        evaluation.size.channelArea = INVALID_VALUE;
+        evaluation.isValid = false;
+    }
+    return geometries[key] = evaluation;
+}
+
+const SubarraySizer::Evaluation&
+SubarraySizer::timing(unsigned int cellsPerRow, unsigned int cellsPerColumn)
+{
+    pair<unsigned int, unsigned int> key(cellsPerRow, cellsPerColumn);
+    map<pair<unsigned int, unsigned int>, Evaluation>::iterator found
+            = timings.find(key);
+    if ( found != timings.end() ) {
+        return found->second;
+    }
+
+    Evaluation evaluation;
+    evaluation.size.cellsPerRow = cellsPerRow;
+    evaluation.size.cellsPerColumn = cellsPerColumn;
+    nTimingEvaluations++;
+    try {
+        Timing dram(inputsOf(cellsPerRow, cellsPerColumn));
+        evaluation.size.channelArea = dram.channelArea.value();
+        evaluation.size.trcd = dram.trcd.value();
+        evaluation.size.tras = dram.tras.value();
+        evaluation.isValid = true;
+    } catch(string exceptionMsgThrown) {
+        evaluation.size.channelArea = INVALID_VALUE;
+        evaluation.size.trcd = INVALID_VALUE;
+        evaluation.size.tras = INVALID_VALUE;
+        evaluation.isValid = false;
+    }
+    return timings[key] = evaluation;
+}
+
+bool
+SubarraySizer::meetsTrcd(const Evaluation& evaluation) const
+{
+    return evaluation.isValid
+           && ( trcdBudget == 0 || evaluation.size.trcd <= trcdBudget );
+}
+
+bool
+SubarraySizer::meetsBudget(const Evaluation& evaluation) const
+{
+    return meetsTrcd(evaluation)
+           && ( trasBudget == 0 || evaluation.size.tras <= trasBudget );
+}
+
+static bool
+isSmallerArea(const SubarraySize& size, const SubarraySize& otherSize)
+{
+    if ( size.channelArea != otherSize.channelArea ) {
+        return size.channelArea < otherSize.channelArea;
+    }
+    // Ties go to the larger subarrays, which need fewer periphery stripes
+    if ( size.cellsPerRow != otherSize.cellsPerRow ) {
+        return size.cellsPerRow > otherSize.cellsPerRow;
+    }
+    return size.cellsPerColumn > otherSize.cellsPerColumn;
+}
+
+void
+SubarraySizer::solve()
+{
+    rowBests.clear();
+    geometries.clear();
+    timings.clear();
+    nTimingEvaluations = 0;
+    nGeometryEvaluations = 0;
+
+    for ( unsigned int row = 0; row < rowCandidates.size(); row++ ) {
+        unsigned int cellsPerRow = rowCandidates[row];
+
+        // Number of column sizes up to the last one within the tRCD budget.
+        //  Rejected configurations do not bound the search, they are
+        //  rejected again below.
+        unsigned int nColumns = columnCandidates.size();
+        if ( trcdBudget > 0 ) {
+            unsigned int lower = 0;
+            unsigned int upper = columnCandidates.size();
+            while ( lower < upper ) {
+                unsigned int middle = lower + (upper - lower) / 2;
+                const Evaluation& evaluation
+                        = timing(cellsPerRow, columnCandidates[middle]);
+                if ( !evaluation.isValid || meetsTrcd(evaluation) ) {
+                    lower = middle + 1;
+                }
+                else {
+                    upper = middle;
+                }
+            }
+            nColumns = lower;
+        }
+
+        vector<SubarraySize> candidates;
+        for ( unsigned int column = 0; column < nColumns; column++ ) {
+            const Evaluation& evaluation
+                    = geometry(cellsPerRow, columnCandidates[column]);
+            if ( evaluation.isValid ) {
+                candidates.push_back(evaluation.size);
+            }
+        }
+        sort(candidates.begin(), candidates.end(), isSmallerArea);
+
+        // The area does not follow the cell counts (whole numbers of
+        //  subarrays, tiles and banks), so each candidate is checked
+        for ( unsigned int it = 0; it < candidates.size(); it++ ) {
+            const Evaluation& evaluation
+                    = timing(cellsPerRow, candidates[it].cellsPerColumn);
+            if ( meetsBudget(evaluation) ) {
+                rowBests.push_back(evaluation.size);
+                break;
+            }
+        }
+    }
+    stable_sort(rowBests.begin(), rowBests.end(), isSmallerArea);
+}
+
+void
+SubarraySizer::writeSizes(ostream& sizeFile) const
+{
+    sizeFile << "CellsPerSubarrayRow[],CellsPerSubarrayColumn[],"
+             << "RedundantCellsPerSubarrayRow[],"
+             << "RedundantCellsPerSubarrayColumn[],"
+             << "ChannelArea[mm^2],tRCD[ns],tRAS[ns]\n";
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+    for ( unsigned int it = 0; it < rowBests.size(); it++ ) {
+        const SubarraySize& size = rowBests[it];
+        sizeFile << size.cellsPerRow << "," << size.cellsPerColumn << ",";
+        shortestDoubleToString(baseInputs.cellsPerLWLRedundancy, buffer);
+        sizeFile << buffer << ",";
+        shortestDoubleToString(baseInputs.cellsPerLBLRedundancy, buffer);
+        sizeFile << buffer << ",";
+        shortestDoubleToString(size.channelArea, buffer);
+        sizeFile << buffer << ",";
+        shortestDoubleToString(size.trcd, buffer);
+        sizeFile << buffer << ",";
+        shortestDoubleToString(size.tras, buffer);
+        sizeFile << buffer << "\n";
+    }
+}
+
+void
+SubarraySizer::printStatistics(ostream& output) const
+{
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+    if ( rowBests.empty() ) {
+        output << "No subarray size meets the budget";
+    }
+    else {
+        const SubarraySize& best = rowBests[0];
+        shortestDoubleToString(best.channelArea, buffer);
+        output << "Smallest channel: " << buffer << " mm^2 with "
+               << best.cellsPerRow << " x " << best.cellsPerColumn
+               << " data cells per subarray (tRCD ";
+        shortestDoubleToString(best.trcd, buffer);
+        output << buffer << " ns, tRAS ";
+        shortestDoubleToString(best.tras, buffer);
+        output << buffer << " ns)";
+    }
+    output << endl << nTimingEvaluations << " timing and "
+           << nGeometryEvaluations << " area evaluations for "
+           << rowCandidates.size() * columnCandidates.size()
+           << " subarray sizes" << endl;
+}
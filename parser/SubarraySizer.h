@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef SUBARRAYSIZER_H
+#define SUBARRAYSIZER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <ostream>
+
+#include "TechnologyValues.h"
+
+using namespace std;
+
+// Subarray dimensions and what they give
+struct SubarraySize
+{
+    // Data cells, without the redundant ones
+    unsigned int cellsPerRow;
+    unsigned int cellsPerColumn;
+    double channelArea;
+    double trcd;
+    double tras;
+};
+
+// Area-minimal subarray dimensions within a timing budget
+//  (-subarray <specification>):
+//   {
+//     "technology": "<technology file>",
+//     "architecture": "<architecture file>",
+//     "ChannelSize[Gb]": 8,
+//     "budget": { "tRCD[ns]": 14, "tRAS[ns]": 35 },
+//     "CellsPerSubarrayRow[]": [256, 512, 1024],
+//     "CellsPerSubarrayColumn[]": [256, 512, 1024],
+//     "RedundantCellsPerSubarrayRow[]": 12,
+//     "RedundantCellsPerSubarrayColumn[]": 12
+//   }
+// The cell counts are data cells; the redundant cells (by default the
+//  ones of the architecture) are added to each of them. Without lists,
+//  the powers of two from 128 to 2048 are tried.
+// tRCD does not decrease with the cells per column (local bitline), so
+//  for each row size the largest column size within the tRCD budget is
+//  bisected. The area only needs the geometry (subarray to channel), so
+//  it is computed for every remaining size, and the timings are checked
+//  in order of increasing area until one meets the whole budget.
+class SubarraySizer
+{
+public:
+    SubarraySizer();
+
+    void readSpecification(const string& specificationFileName);
+
+    // 0: no budget
+    void setBudget(double trcdBudget, double trasBudget);
+    void setCandidates(const vector<double>& cellsPerRow,
+                       const vector<double>& cellsPerColumn);
+
+    void solve();
+
+    // Smallest area for each row size which meets the budget, by area
+    const vector<SubarraySize>& sizes() const { return rowBests; }
+    void writeSizes(ostream& sizeFile) const;
+    void printStatistics(ostream& output) const;
+
+    // Base configuration (with its redundant cells) and -D overrides are
+    //  applied by the caller before solving
+    TechnologyValues baseInputs;
+
+    unsigned int nTimingEvaluations;
+    unsigned int nGeometryEvaluations;
+
+private:
+    struct Evaluation
+    {
+        bool isValid;
+        SubarraySize size;
+    };
+
+    TechnologyValues inputsOf(unsigned int cellsPerRow,
+                              unsigned int cellsPerColumn) const;
+    const Evaluation& geometry(unsigned int cellsPerRow,
+                               unsigned int cellsPerColumn);
+    const Evaluation& timing(unsigned int cellsPerRow,
+                             unsigned int cellsPerColumn);
+    bool meetsTrcd(const Evaluation& evaluation) const;
+    bool meetsBudget(const Evaluation& evaluation) const;
+
+    double trcdBudget;
+    double trasBudget;
+    vector<unsigned int> rowCandidates;
+    vector<unsigned int> columnCandidates;
+
+    map<pair<unsigned int, unsigned int>, Evaluation> geometries;
+    map<pair<unsigned int, unsigned int>, Evaluation> timings;
+
+    vector<SubarraySize> rowBests;
+};
+
+#endif // SUBARRAYSIZER_H
@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "TechnologyLibrary.h"
+
+#include <algorithm>
+#include <fstream>
+#include <cstring>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+const char TechnologyLibrary::magic[8] = {'D','R','S','T','E','C','H','L'};
+
+TechnologyLibrary::TechnologyLibrary()
+{
+    data = NULL;
+    dataSize = 0;
+    header = NULL;
+    index = NULL;
+    records = NULL;
+    names = NULL;
+}
+
+TechnologyLibrary::~TechnologyLibrary()
+{
+    close();
+}
+
+// Technology files only have numbers
+static vector<const TechnologyField*>
+technologyNumberFields()
+{
+    vector<const TechnologyField*> fields;
+    const vector<TechnologyField>& registry = TechnologyValues::fieldRegistry();
+    for ( unsigned int it = 0; it < registry.size(); it++ ) {
+        if ( registry[it].document == TECHNOLOGY_DOCUMENT
+             && !registry[it].isString ) {
+            fields.push_back(&registry[it]);
+        }
+    }
+    return fields;
+}
+
+const vector<const TechnologyField*>&
+TechnologyLibrary::recordFields()
+{
+    static const vector<const TechnologyField*> fields =
+                                                technologyNumberFields();
+    return fields;
+}
+
+uint64_t
+TechnologyLibrary::fieldsFingerprint()
+{
+    string fieldNames;
+    const vector<const TechnologyField*>& fields = recordFields();
+    for ( unsigned int it = 0; it < fields.size(); it++ ) {
+        fieldNames.append(fields[it]->name);
+        fieldNames.append("\n");
+    }
+    return fnv1aHash(fieldNames);
+}
+
+string
+TechnologyLibrary::technologyName(const string& technologyFileName)
+{
+    string name(technologyFileName);
+    size_t directoryEnd = name.find_last_of('/');
+    if ( directoryEnd != string::npos ) {
+        name.erase(0, directoryEnd + 1);
+    }
+    if ( name.size() > 5
+         && name.compare(name.size() - 5, 5, ".json") == 0 ) {
+        name.erase(name.size() - 5);
+    }
+    return name;
+}
+
+unsigned int
+TechnologyLibrary::compile(const vector<string>& technologyFileNames,
+                           const string& libraryFileName)
+{
+    const vector<const TechnologyField*>& fields = recordFields();
+
+    // Technologies by name, with the file they were read from
+    vector<pair<string, unsigned int>> sortedNames;
+    vector<double> recordValues;
+    recordValues.reserve(technologyFileNames.size() * fields.size());
+
+    for ( unsigned int fileID = 0; fileID < technologyFileNames.size();
+          fileID++ ) {
+        const string& fileName = technologyFileNames[fileID];
+        TechnologyValues values;
+        values.techFileName = fileName;
+        try {
+            ExtendedDocument techDocument;
+            TechnologyValues::readJSONFile(fileName, "technology",
+                                           techDocument);
+            values.readTechnology(techDocument);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+
+        for ( unsigned int it = 0; it < fields.size(); it++ ) {
+            recordValues.push_back(fields[it]->getNumber(values));
+        }
+        sortedNames.push_back(make_pair(technologyName(fileName), fileID));
+    }
+
+    sort(sortedNames.begin(), sortedNames.end());
+    for ( unsigned int it = 1; it < sortedNames.size(); it++ ) {
+        if ( sortedNames[it].first == sortedNames[it-1].first ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Technology files \'");
+            exceptionMsgThrown.append(
+                        technologyFileNames[sortedNames[it-1].second]);
+            exceptionMsgThrown.append("\' and \'");
+            exceptionMsgThrown.append(
+                        technologyFileNames[sortedNames[it].second]);
+            exceptionMsgThrown.append("\' have the same name \'");
+            exceptionMsgThrown.append(sortedNames[it].first);
+            exceptionMsgThrown.append("\'.\n");
+            throw exceptionMsgThrown;
+        }
+    }
+
+    Header libraryHeader;
+    memset(&libraryHeader, 0, sizeof(libraryHeader));
+    memcpy(libraryHeader.magic, magic, sizeof(magic));
+    libraryHeader.version = formatVersion;
+    libraryHeader.nFields = fields.size();
+    libraryHeader.fieldsFingerprint = fieldsFingerprint();
+    libraryHeader.nTechnologies = sortedNames.size();
+
+    vector<IndexEntry> libraryIndex(sortedNames.size());
+    string libraryNames;
+    for ( unsigned int it = 0; it < sortedNames.size(); it++ ) {
+        libraryIndex[it].nameOffset = libraryNames.size();
+        libraryIndex[it].nameLength = sortedNames[it].first.size();
+        libraryIndex[it].recordID = sortedNames[it].second;
+        libraryIndex[it].reserved = 0;
+        libraryNames.append(sortedNames[it].first);
+    }
+    libraryHeader.namesSize = libraryNames.size();
+
+    // Written aside and renamed, so that running evaluations never map
+    //  a partially written library
+    string temporaryFileName(libraryFileName);
+    temporaryFileName.append(".tmp.");
+    temporaryFileName.append(to_string(getpid()));
+
+    ofstream libraryFile(temporaryFileName, ofstream::trunc | ofstream::binary);
+    libraryFile.write(reinterpret_cast<const char*>(&libraryHeader),
+                      sizeof(libraryHeader));
+    if ( !libraryIndex.empty() ) {
+        libraryFile.write(reinterpret_cast<const char*>(&libraryIndex[0]),
+                          libraryIndex.size() * sizeof(IndexEntry));
+    }
+    if ( !recordValues.empty() ) {
+        libraryFile.write(reinterpret_cast<const char*>(&recordValues[0]),
+                          recordValues.size() * sizeof(double));
+    }
+    libraryFile.write(libraryNames.data(), libraryNames.size());
+    libraryFile.close();
+
+    if ( libraryFile.fail()
+         || rename(temporaryFileName.c_str(), libraryFileName.c_str()) != 0 ) {
+        remove(temporaryFileName.c_str());
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Could not write technology library \'");
+        exceptionMsgThrown.append(libraryFileName);
+        exceptionMsgThrown.append("\'.\n");
+        throw exceptionMsgThrown;
+    }
+
+    return sortedNames.size();
+}
+
+void
+TechnologyLibrary::open(const string& libraryFileName)
+{
+    close();
+    this->libraryFileName = libraryFileName;
+
+    int fileDescriptor = ::open(libraryFileName.c_str(), O_RDONLY);
+    struct stat fileStat;
+    if ( fileDescriptor < 0 || fstat(fileDescriptor, &fileStat) != 0 ) {
+        if ( fileDescriptor >= 0 ) {
+            ::close(fileDescriptor);
+        }
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Could not open technology library \'");
+        exceptionMsgThrown.append(libraryFileName);
+        exceptionMsgThrown.append("\'.\n");
+        throw exceptionMsgThrown;
+    }
+
+    size_t fileSize = fileStat.st_size;
+    void* mapping = MAP_FAILED;
+    if ( fileSize >= sizeof(Header) ) {
+        mapping = mmap(NULL, fileSize, PROT_READ, MAP_PRIVATE,
+                       fileDescriptor, 0);
+    }
+    ::close(fileDescriptor);
+
+    bool isValid = ( mapping != MAP_FAILED );
+    if ( isValid ) {
+        data = static_cast<const char*>(mapping);
+        dataSize = fileSize;
+        header = reinterpret_cast<const Header*>(data);
+        isValid = memcmp(header->magic, magic, sizeof(magic)) == 0
+                  && header->version == formatVersion
+                  && header->nFields == recordFields().size()
+                  && header->fieldsFingerprint == fieldsFingerprint();
+    }
+    if ( isValid ) {
+        size_t indexSize = size_t(header->nTechnologies)
+                           * sizeof(IndexEntry);
+        size_t recordsSize = size_t(header->nTechnologies)
+                             * header->nFields * sizeof(double);
+        isValid = ( dataSize == sizeof(Header) + indexSize + recordsSize
+                                + header->namesSize );
+        if ( isValid ) {
+            index = reinterpret_cast<const IndexEntry*>(
+                                                    data + sizeof(Header));
+            records = reinterpret_cast<const double*>(
+                                        data + sizeof(Header) + indexSize);
+            names = data + sizeof(Header) + indexSize + recordsSize;
+        }
+        for ( uint32_t it = 0; isValid && it < header->nTechnologies; it++ ) {
+            isValid = index[it].recordID < header->nTechnologies
+                      && index[it].nameOffset <= header->namesSize
+                      && index[it].nameLength
+                         <= header->namesSize - index[it].nameOffset;
+        }
+    }
+
+    if ( !isValid ) {
+        close();
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("\'");
+        exceptionMsgThrown.append(libraryFileName);
+        exceptionMsgThrown.append("\' is not a technology library of this ");
+        exceptionMsgThrown.append("DRAMSpec version, ");
+        exceptionMsgThrown.append("compile it again with -compiletech.\n");
+        throw exceptionMsgThrown;
+    }
+}
+
+void
+TechnologyLibrary::close()
+{
+    if ( data != NULL ) {
+        munmap(const_cast<char*>(data), dataSize);
+    }
+    data = NULL;
+    dataSize = 0;
+    header = NULL;
+    index = NULL;
+    records = NULL;
+    names = NULL;
+}
+
+unsigned int
+TechnologyLibrary::nTechnologies() const
+{
+    return header == NULL ? 0 : header->nTechnologies;
+}
+
+bool
+TechnologyLibrary::find(const string& technologyName,
+                        TechnologyValues& inputs) const
+{
+    if ( !isOpen() ) {
+        return false;
+    }
+
+    // Binary search in the name index
+    uint32_t first = 0;
+    uint32_t last = header->nTechnologies;
+    while ( first < last ) {
+        uint32_t middle = first + (last - first) / 2;
+        const IndexEntry& entry = index[middle];
+        int comparison = technologyName.compare(0, string::npos,
+                                                names + entry.nameOffset,
+                                                entry.nameLength);
+        if ( comparison == 0 ) {
+            const vector<const TechnologyField*>& fields = recordFields();
+            const double* record = records
+                                   + size_t(entry.recordID) * fields.size();
+            for ( unsigned int it = 0; it < fields.size(); it++ ) {
+                fields[it]->setNumber(inputs, record[it]);
+            }
+            inputs.deriveTechnologyConstants();
+            return true;
+        }
+        if ( comparison < 0 ) {
+            last = middle;
+        }
+        else {
+            first = middle + 1;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef TECHNOLOGYLIBRARY_H
+#define TECHNOLOGYLIBRARY_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#include "TechnologyValues.h"
+
+using namespace std;
+
+// Technologies compiled into one binary file (-compiletech), so that runs
+//  (-techlib) look them up by name instead of parsing their JSON files.
+// The file is mapped into memory as it is, in the byte order of the
+//  machine which compiled it:
+//   header | name index, sorted by name | records | names
+// A record holds all technology parameters (numbers, validated when
+//  compiled) in the unit of their JSON member, in field registry order.
+// The name of a technology is its file name without directory and .json.
+class TechnologyLibrary
+{
+public:
+    // To be increased whenever the layout of the file changes
+    static const uint32_t formatVersion = 1;
+
+    TechnologyLibrary();
+    ~TechnologyLibrary();
+
+    // Reads the technology files and writes them to a library,
+    //  returns the number of technologies
+    static unsigned int compile(const vector<string>& technologyFileNames,
+                                const string& libraryFileName);
+
+    void open(const string& libraryFileName);
+    bool isOpen() const { return data != NULL; }
+    unsigned int nTechnologies() const;
+
+    // Sets the technology parameters (and constants) of the inputs,
+    //  false if the library has no technology of that name
+    bool find(const string& technologyName, TechnologyValues& inputs) const;
+
+    static string technologyName(const string& technologyFileName);
+
+private:
+    struct Header
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t nFields;
+        uint64_t fieldsFingerprint;
+        uint32_t nTechnologies;
+        uint32_t namesSize;
+    };
+
+    struct IndexEntry
+    {
+        uint32_t nameOffset;
+        uint32_t nameLength;
+        uint32_t recordID;
+        uint32_t reserved;
+    };
+
+    static const char magic[8];
+
+    // Technology parameters stored in the records
+    static const vector<const TechnologyField*>& recordFields();
+    // Hash of their names, a library is only used with the same fields
+    static uint64_t fieldsFingerprint();
+
+    void close();
+
+    // Not copyable, the mapping is owned
+    TechnologyLibrary(const TechnologyLibrary&);
+    TechnologyLibrary& operator=(const TechnologyLibrary&);
+
+    const char* data;
+    size_t dataSize;
+    string libraryFileName;
+
+    const Header* header;
+    const IndexEntry* index;
+    const double* records;
+    const char* names;
+};
+
+#endif // TECHNOLOGYLIBRARY_H
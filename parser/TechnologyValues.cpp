@@ -40,12 +40,98 @@
 
 #include "TechnologyValues.h"
 
-void
-TechnologyValues::technologyValuesInitialize()
+#include "../core/Dual.h"
+#include "../core/Interval.h"
+
+#include <cstdlib>
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+template<typename Scalar>
+template<typename Other>
+TechnologyInputs<Scalar>::TechnologyInputs(
+                                    const TechnologyInputs<Other>& inputs) :
+    technologyNode(inputs.technologyNode),
+    vpp(inputs.vpp),
+    vdd(inputs.vdd),
+    wireResistance(inputs.wireResistance),
+    wireCapacitance(inputs.wireCapacitance),
+    capacitancePerCell(inputs.capacitancePerCell),
+    resistancePerCell(inputs.resistancePerCell),
+    cellWidth(inputs.cellWidth),
+    cellHeight(inputs.cellHeight),
+    capacitancePerBLCell(inputs.capacitancePerBLCell),
+    resistancePerBLCell(inputs.resistancePerBLCell),
+    capacitancePerWLCell(inputs.capacitancePerWLCell),
+    resistancePerWLCell(inputs.resistancePerWLCell),
+    BLSenseAmpHeight(inputs.BLSenseAmpHeight),
+    LWLDriverWidth(inputs.LWLDriverWidth),
+    LWLDriverResistance(inputs.LWLDriverResistance),
+    rowDecoderWidth(inputs.rowDecoderWidth),
+    GWLDriverResistance(inputs.GWLDriverResistance),
+    Issa(inputs.Issa),
+    WRDriverResistance(inputs.WRDriverResistance),
+    colDecoderHeight(inputs.colDecoderHeight),
+    CSLDriverResistance(inputs.CSLDriverResistance),
+    CSLLoadCapacitance(inputs.CSLLoadCapacitance),
+    GDLDriverResistance(inputs.GDLDriverResistance),
+    DQDriverHeight(inputs.DQDriverHeight),
+    DQtoTSVWireLength(inputs.DQtoTSVWireLength),
+    DQDriverResistance(inputs.DQDriverResistance),
+    idd2nFreqSlope(inputs.idd2nFreqSlope),
+    idd2nTempAlpha(inputs.idd2nTempAlpha),
+    idd2nTempBeta(inputs.idd2nTempBeta),
+    idd2nRefTemp(inputs.idd2nRefTemp),
+    idd2nOffset(inputs.idd2nOffset),
+    IddOcdRcvSlope(inputs.IddOcdRcvSlope),
+    fullySharedResourcesCurrent(inputs.fullySharedResourcesCurrent),
+    semiSharedResourcesCurrent(inputs.semiSharedResourcesCurrent),
+    nBanksPerSemiSharedResource(inputs.nBanksPerSemiSharedResource),
+    TSVHeight(inputs.TSVHeight),
+    additionalLatencyTrl(inputs.additionalLatencyTrl),
+    driverEnableDelay(inputs.driverEnableDelay),
+    inOutSSADelay(inputs.inOutSSADelay),
+    cmdDecoderDelay(inputs.cmdDecoderDelay),
+    IODelay(inputs.IODelay),
+    SSAPrechargeDelay(inputs.SSAPrechargeDelay),
+    tWRMargin(inputs.tWRMargin),
+    equalizerDelay(inputs.equalizerDelay),
+    vppPumpsEfficiency(inputs.vppPumpsEfficiency),
+    dramType(inputs.dramType),
+    is3D(inputs.is3D),
+    isDLL(inputs.isDLL),
+    hasExternalVpp(inputs.hasExternalVpp),
+    channelSize(inputs.channelSize),
+    nBanks(inputs.nBanks),
+    nHorizontalBanks(inputs.nHorizontalBanks),
+    nVerticalBanks(inputs.nVerticalBanks),
+    cellsPerLWL(inputs.cellsPerLWL),
+    cellsPerLWLRedundancy(inputs.cellsPerLWLRedundancy),
+    cellsPerLBL(inputs.cellsPerLBL),
+    cellsPerLBLRedundancy(inputs.cellsPerLBLRedundancy),
+    interface(inputs.interface),
+    prefetch(inputs.prefetch),
+    dramFreq(inputs.dramFreq),
+    dramCoreFreq(inputs.dramCoreFreq),
+    nTilesPerBank(inputs.nTilesPerBank),
+    pageStorage(inputs.pageStorage),
+    pageSpanningFactor(inputs.pageSpanningFactor),
+    subArrayToPageFactor(inputs.subArrayToPageFactor),
+    BLArchitecture(inputs.BLArchitecture),
+    retentionTime(inputs.retentionTime),
+    trefIBase(inputs.trefIBase),
+    refreshMode(inputs.refreshMode),
+    temperature(inputs.temperature),
+    warning(inputs.warning)
 {
-    techFileName = "";
-    archFileName = "";
+    technologyConstants.isValid = false;
+}
 
+template<typename Scalar>
+void
+TechnologyInputs<Scalar>::technologyInputsInitialize()
+{
     technologyNode = INVALID_VALUE*drs::nanometer;
     vpp = INVALID_VALUE*si::volt;
     vdd = INVALID_VALUE*si::volt;
@@ -119,15 +205,18 @@ TechnologyValues::technologyValuesInitialize()
     refreshMode = INVALID_VALUE;
     temperature = INVALID_VALUE*bu::celsius::degrees;
 
+    technologyConstants.isValid = false;
+
     warning = "";
 }
 
 double
-TechnologyValues::getJSONNumber(const rapidjson::Document& jsonDoc,
+TechnologyValues::getJSONNumber(const JSONMembers& jsonDoc,
                                 const char* memberName,
                                 const string& attributeType)
 {
-  if ( jsonDoc.HasMember( memberName ) == false )
+  const rapidjson::Value* member = jsonDoc.find( memberName );
+  if ( member == NULL )
   {
     if ( attributeType == "mandatory" ) {
       string exceptionMsgThrown;
@@ -157,7 +246,7 @@ TechnologyValues::getJSONNumber(const rapidjson::Document& jsonDoc,
       throw exceptionMsgThrown;
     }
   }
-  if ( jsonDoc[ memberName ].IsNumber() == false )
+  if ( member->IsNumber() == false )
   {
     string exceptionMsgThrown;
     exceptionMsgThrown.append("[ERROR] ");
@@ -171,11 +260,11 @@ TechnologyValues::getJSONNumber(const rapidjson::Document& jsonDoc,
     throw exceptionMsgThrown;
   }
 
-  return jsonDoc[ memberName ].GetDouble();
+  return member->GetDouble();
 }
 
 double
-TechnologyValues::getJSONNumber(const rapidjson::Document& jsonDoc,
+TechnologyValues::getJSONNumber(const JSONMembers& jsonDoc,
                                 const char* memberName,
                                 const string& attributeType,
                                 double defaultValue)
@@ -193,11 +282,12 @@ TechnologyValues::getJSONNumber(const rapidjson::Document& jsonDoc,
 }
 
 string
-TechnologyValues::getJSONString(const rapidjson::Document& jsonDoc,
+TechnologyValues::getJSONString(const JSONMembers& jsonDoc,
                                 const char* memberName,
                                 const string& attributeType)
 {
-  if ( jsonDoc.HasMember( memberName ) == false )
+  const rapidjson::Value* member = jsonDoc.find( memberName );
+  if ( member == NULL )
   {
     if ( attributeType == "mandatory" ) {
       string exceptionMsgThrown;
@@ -227,7 +317,7 @@ TechnologyValues::getJSONString(const rapidjson::Document& jsonDoc,
       throw exceptionMsgThrown;
     }
   }
-  if ( jsonDoc[ memberName ].IsString() == false )
+  if ( member->IsString() == false )
   {
     string exceptionMsgThrown;
     exceptionMsgThrown.append("[ERROR] ");
@@ -241,393 +331,852 @@ TechnologyValues::getJSONString(const rapidjson::Document& jsonDoc,
     throw exceptionMsgThrown;
   }
 
-  return jsonDoc[ memberName ].GetString();
+  return member->GetString();
 }
 
-void 
-TechnologyValues::readjson(const string& t,const string& p)
+// Registry of all input parameters, in the order they are read.
+// Numbers are got and set in the unit given in the JSON member name.
+// Setting a technology parameter invalidates the technology constants.
+// Counts and factors taking a few values are NUMBER_FIELDs, numbers the
+//  model computes on as Scalar FACTOR_FIELDs (see TechnologyInputs).
+#define NUMBER_FIELD(document, name, attributeType, defaultValue, member, \
+                     isInteger) \
+    { name, document, attributeType, false, isInteger, defaultValue, \
+      [](const TechnologyValues& values) -> double \
+          { return values.member; }, \
+      [](TechnologyValues& values, double value) \
+          { values.member = value; \
+            if ( document == TECHNOLOGY_DOCUMENT ) { \
+                values.technologyConstants.isValid = false; } }, \
+      NULL, NULL, NULL, NULL, ANY_NUMBER }
+
+#define FACTOR_FIELD(document, name, attributeType, defaultValue, member) \
+    { name, document, attributeType, false, false, defaultValue, \
+      [](const TechnologyValues& values) -> double \
+          { return values.member; }, \
+      [](TechnologyValues& values, double value) \
+          { values.member = value; \
+            if ( document == TECHNOLOGY_DOCUMENT ) { \
+                values.technologyConstants.isValid = false; } }, \
+      NULL, NULL, \
+      [](TechnologyInputs<Dual>& values, const Dual& value) \
+          { values.member = value; \
+            if ( document == TECHNOLOGY_DOCUMENT ) { \
+                values.technologyConstants.isValid = false; } }, \
+      [](TechnologyInputs<Interval>& values, const Interval& value) \
+          { values.member = value; \
+            if ( document == TECHNOLOGY_DOCUMENT ) { \
+                values.technologyConstants.isValid = false; } }, \
+      ANY_NUMBER }
+
+#define QUANTITY_FIELD(document, name, attributeType, defaultValue, \
+                       member, unit) \
+    BOUNDED_QUANTITY_FIELD(document, name, attributeType, defaultValue, \
+                           member, unit, false, ANY_NUMBER)
+
+// Quantities in whole units (e.g. bits, clock cycles) are counts as well
+#define COUNTED_QUANTITY_FIELD(document, name, attributeType, defaultValue, \
+                               member, unit, isInteger) \
+    BOUNDED_QUANTITY_FIELD(document, name, attributeType, defaultValue, \
+                           member, unit, isInteger, ANY_NUMBER)
+
+#define BOUNDED_QUANTITY_FIELD(document, name, attributeType, defaultValue, \
+                               member, unit, isInteger, domain) \
+    { name, document, attributeType, false, isInteger, defaultValue, \
+      [](const TechnologyValues& values) -> double \
+          { return values.member.value(); }, \
+      [](TechnologyValues& values, double value) \
+          { values.member = value * unit; \
+            if ( document == TECHNOLOGY_DOCUMENT ) { \
+                values.technologyConstants.isValid = false; } }, \
+      NULL, NULL, \
+      [](TechnologyInputs<Dual>& values, const Dual& value) \
+          { values.member = value * unit; \
+            if ( document == TECHNOLOGY_DOCUMENT ) { \
+                values.technologyConstants.isValid = false; } }, \
+      [](TechnologyInputs<Interval>& values, const Interval& value) \
+          { values.member = value * unit; \
+            if ( document == TECHNOLOGY_DOCUMENT ) { \
+                values.technologyConstants.isValid = false; } }, \
+      domain }
+
+const vector<TechnologyField>&
+TechnologyValues::fieldRegistry()
 {
-    techFileName = t;
-    archFileName = p;
+    static const vector<TechnologyField> registry = {
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "TechnologyNode[nm]",
+                       "mandatory", INVALID_VALUE,
+                       technologyNode, drs::nanometer),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "Vpp[V]",
+                       "mandatory", INVALID_VALUE,
+                       vpp, si::volt),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "Vdd[V]",
+                       "mandatory", INVALID_VALUE,
+                       vdd, si::volt),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "WireResistance[Ohm/mm]",
+                       "mandatory", INVALID_VALUE,
+                       wireResistance, drs::ohm_per_millimeter),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "WireCapacitance[fF/mm]",
+                       "mandatory", INVALID_VALUE,
+                       wireCapacitance, drs::femtofarad_per_millimeter),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "CellCapacitance[fF]",
+                       "mandatory", INVALID_VALUE,
+                       capacitancePerCell, drs::femtofarads),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "CellResistance[KOhm]",
+                       "mandatory", INVALID_VALUE,
+                       resistancePerCell, drs::kiloohm),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "CellWidth[um]",
+                       "mandatory", INVALID_VALUE,
+                       cellWidth, drs::micrometers),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "CellHeight[um]",
+                       "mandatory", INVALID_VALUE,
+                       cellHeight, drs::micrometers),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "BitlineCapacitancePerCell[aF]",
+                       "mandatory", INVALID_VALUE,
+                       capacitancePerBLCell, drs::attofarads),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "BitlineResistancePerCell[Ohm]",
+                       "mandatory", INVALID_VALUE,
+                       resistancePerBLCell, drs::ohm),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "WordlineCapacitancePerCell[aF]",
+                       "mandatory", INVALID_VALUE,
+                       capacitancePerWLCell, drs::attofarads),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "WordlineResistancePerCell[Ohm]",
+                       "mandatory", INVALID_VALUE,
+                       resistancePerWLCell, drs::ohm),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "PrimarySenseAmpHeight[um]",
+                       "mandatory", INVALID_VALUE,
+                       BLSenseAmpHeight, drs::micrometer),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "LocalWordlineDriverWitdh[um]",
+                       "mandatory", INVALID_VALUE,
+                       LWLDriverWidth, drs::micrometer),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "LocalWordlineDriverResistance[Ohm]",
+                       "mandatory", INVALID_VALUE,
+                       LWLDriverResistance, drs::ohm),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "RowDecoderWidth[um]",
+                       "mandatory", INVALID_VALUE,
+                       rowDecoderWidth, drs::micrometer),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "GlobalWordlineDriverResistance[Ohm]",
+                       "mandatory", INVALID_VALUE,
+                       GWLDriverResistance, si::ohm),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "SecondarySenseAmpCurrent[uA]",
+                       "mandatory", INVALID_VALUE,
+                       Issa, drs::microampere_per_bit),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "WriteDriverResistance[Ohm]",
+                       "mandatory", INVALID_VALUE,
+                       WRDriverResistance, drs::ohm),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "ColumnDecoderHeight[um]",
+                       "mandatory", INVALID_VALUE,
+                       colDecoderHeight, drs::micrometer),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "CSLDriverResistance[Ohm]",
+                       "mandatory", INVALID_VALUE,
+                       CSLDriverResistance, si::ohm),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "CSLLoadCapacitance[fF]",
+                       "mandatory", INVALID_VALUE,
+                       CSLLoadCapacitance, drs::femtofarads),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "GlobalDataLineDriverResistance[Ohm]",
+                       "mandatory", INVALID_VALUE,
+                       GDLDriverResistance, si::ohm),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "DQDriverHeight[um]",
+                       "mandatory", INVALID_VALUE,
+                       DQDriverHeight, drs::micrometer),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "DQtoTSVWireLength[um]",
+                       "mandatory", INVALID_VALUE,
+                       DQtoTSVWireLength, drs::micrometers),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "DQDriverResistance[Ohm]",
+                       "mandatory", INVALID_VALUE,
+                       DQDriverResistance, si::ohm),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "IDD2NFreqSlope[mA/MHz]",
+                       "mandatory", INVALID_VALUE,
+                       idd2nFreqSlope, drs::milliamperes_per_megahertz_clock),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "IDD2NTempAlpha[mA]",
+                       "mandatory", INVALID_VALUE,
+                       idd2nTempAlpha, drs::milliamperes),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "IDD2NTempBeta[C^-1]",
+                       "mandatory", INVALID_VALUE,
+                       idd2nTempBeta, drs::eergeds),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "IDD2NRefTemp[C]",
+                       "mandatory", INVALID_VALUE,
+                       idd2nRefTemp, bu::celsius::degrees),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "IDD2NOffset[mA]",
+                       "mandatory", INVALID_VALUE,
+                       idd2nOffset, drs::milliamperes),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "OCDCurrentSlope[uA/MHz]",
+                       "mandatory", INVALID_VALUE,
+                       IddOcdRcvSlope, drs::microamperes_per_megahertz_clock),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "FullySharedResourcesCurrent[mA]",
+                       "mandatory", INVALID_VALUE,
+                       fullySharedResourcesCurrent, drs::milliamperes),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "SemiSharedResourcesCurrent[mA]",
+                       "mandatory", INVALID_VALUE,
+                       semiSharedResourcesCurrent, drs::milliamperes),
+        NUMBER_FIELD(TECHNOLOGY_DOCUMENT, "nBanksPerSemiSharedResource[]",
+                     "mandatory", INVALID_VALUE,
+                     nBanksPerSemiSharedResource, true),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "TSVHeight[um]",
+                       "mandatory", INVALID_VALUE,
+                       TSVHeight, drs::micrometer),
+        COUNTED_QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "AdditionalTRLLatency[cc]",
+                               "mandatory", INVALID_VALUE,
+                               additionalLatencyTrl, drs::clock, true),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "DriverEnableDelay[ns]",
+                       "mandatory", INVALID_VALUE,
+                       driverEnableDelay, drs::nanoseconds),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "InOutSSADelay[ns]",
+                       "mandatory", INVALID_VALUE,
+                       inOutSSADelay, drs::nanoseconds),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "CommandDecoderDelay[ns]",
+                       "mandatory", INVALID_VALUE,
+                       cmdDecoderDelay, drs::nanoseconds),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "IODelay[ns]",
+                       "mandatory", INVALID_VALUE,
+                       IODelay, drs::nanoseconds),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "SSAPrechargeDelay[ns]",
+                       "mandatory", INVALID_VALUE,
+                       SSAPrechargeDelay, drs::nanoseconds),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "tWRMargin[ns]",
+                       "mandatory", INVALID_VALUE,
+                       tWRMargin, drs::nanoseconds),
+        QUANTITY_FIELD(TECHNOLOGY_DOCUMENT, "EqualizerDelay[ns]",
+                       "mandatory", INVALID_VALUE,
+                       equalizerDelay, drs::nanoseconds),
+        FACTOR_FIELD(TECHNOLOGY_DOCUMENT, "VppPumpEfficiency[-]",
+                     "optional", 0.3,
+                     vppPumpsEfficiency),
+
+        { "DRAMType[-]", ARCHITECTURE_DOCUMENT,
+          "mandatory", true, false, INVALID_VALUE,
+          NULL, NULL,
+          [](const TechnologyValues& values) -> string
+              { return values.dramType; },
+          [](TechnologyValues& values, const string& value)
+              { values.dramType = value; },
+          NULL, NULL, ANY_NUMBER },
+        { "3D[-]", ARCHITECTURE_DOCUMENT,
+          "mandatory", true, false, INVALID_VALUE,
+          NULL, NULL,
+          [](const TechnologyValues& values) -> string
+              { return values.is3D ? "ON" : "OFF"; },
+          [](TechnologyValues& values, const string& value)
+              { values.is3D = ( value == "ON" ); },
+          NULL, NULL, ANY_NUMBER },
+        { "DLL[-]", ARCHITECTURE_DOCUMENT,
+          "mandatory", true, false, INVALID_VALUE,
+          NULL, NULL,
+          [](const TechnologyValues& values) -> string
+              { return values.isDLL ? "ON" : "OFF"; },
+          [](TechnologyValues& values, const string& value)
+              { values.isDLL = ( value == "ON" ); },
+          NULL, NULL, ANY_NUMBER },
+        { "ExternalVPP[-]", ARCHITECTURE_DOCUMENT,
+          "optional", true, false, INVALID_VALUE,
+          NULL, NULL,
+          [](const TechnologyValues& values) -> string
+              { return values.hasExternalVpp ? "YES" : "NO"; },
+          [](TechnologyValues& values, const string& value)
+              { values.hasExternalVpp = ( value == "YES" ); },
+          NULL, NULL, ANY_NUMBER },
+        QUANTITY_FIELD(ARCHITECTURE_DOCUMENT, "ChannelSize[Gb]",
+                       "mandatory", INVALID_VALUE,
+                       channelSize, drs::gibibits),
+        NUMBER_FIELD(ARCHITECTURE_DOCUMENT, "NumberOfBanksPerChannel[]",
+                     "mandatory", INVALID_VALUE,
+                     nBanks, true),
+        NUMBER_FIELD(ARCHITECTURE_DOCUMENT, "NumberOfHorizontalBanksPerChannel[]",
+                     "optional", INVALID_VALUE,
+                     nHorizontalBanks, true),
+        NUMBER_FIELD(ARCHITECTURE_DOCUMENT, "NumberOfVerticalBanksPerChannel[]",
+                     "optional", INVALID_VALUE,
+                     nVerticalBanks, true),
+        NUMBER_FIELD(ARCHITECTURE_DOCUMENT, "CellsPerSubarrayRow[]",
+                     "mandatory", INVALID_VALUE,
+                     cellsPerLWL, true),
+        NUMBER_FIELD(ARCHITECTURE_DOCUMENT, "RedundantCellsPerSubarrayRow[]",
+                     "mandatory", INVALID_VALUE,
+                     cellsPerLWLRedundancy, true),
+        NUMBER_FIELD(ARCHITECTURE_DOCUMENT, "CellsPerSubarrayColumn[]",
+                     "mandatory", INVALID_VALUE,
+                     cellsPerLBL, true),
+        NUMBER_FIELD(ARCHITECTURE_DOCUMENT, "RedundantCellsPerSubarrayColumn[]",
+                     "mandatory", INVALID_VALUE,
+                     cellsPerLBLRedundancy, true),
+        COUNTED_QUANTITY_FIELD(ARCHITECTURE_DOCUMENT, "Interface[bit]",
+                               "mandatory", INVALID_VALUE,
+                               interface, drs::bits, true),
+        NUMBER_FIELD(ARCHITECTURE_DOCUMENT, "Prefetch[]",
+                     "mandatory", INVALID_VALUE,
+                     prefetch, true),
+        BOUNDED_QUANTITY_FIELD(ARCHITECTURE_DOCUMENT, "Frequency[MHz]",
+                               "mandatory", INVALID_VALUE,
+                               dramFreq, drs::megahertz_clock,
+                               false, POSITIVE_NUMBER),
+        // A core frequency of 0 is derived from the frequency
+        BOUNDED_QUANTITY_FIELD(ARCHITECTURE_DOCUMENT, "CoreFrequency[MHz]",
+                               "mandatory", INVALID_VALUE,
+                               dramCoreFreq, drs::megahertz_clock,
+                               false, NON_NEGATIVE_NUMBER),
+        NUMBER_FIELD(ARCHITECTURE_DOCUMENT, "TilesPerBank[]",
+                     "mandatory", INVALID_VALUE,
+                     nTilesPerBank, true),
+        QUANTITY_FIELD(ARCHITECTURE_DOCUMENT, "PageSize[KB]",
+                       "mandatory", INVALID_VALUE,
+                       pageStorage, drs::kibibyte),
+        NUMBER_FIELD(ARCHITECTURE_DOCUMENT, "PageSpanningFactor[]",
+                     "mandatory", INVALID_VALUE,
+                     pageSpanningFactor, false),
+        NUMBER_FIELD(ARCHITECTURE_DOCUMENT, "SubarrayToPageFactor[]",
+                     "mandatory", INVALID_VALUE,
+                     subArrayToPageFactor, true),
+        { "BitlineArchitecture[-]", ARCHITECTURE_DOCUMENT,
+          "mandatory", true, false, INVALID_VALUE,
+          NULL, NULL,
+          [](const TechnologyValues& values) -> string
+              { return values.BLArchitecture; },
+          [](TechnologyValues& values, const string& value)
+              { values.BLArchitecture = value; },
+          NULL, NULL, ANY_NUMBER },
+        QUANTITY_FIELD(ARCHITECTURE_DOCUMENT, "RetentionTime[ms]",
+                       "mandatory", INVALID_VALUE,
+                       retentionTime, drs::millisecond),
+        QUANTITY_FIELD(ARCHITECTURE_DOCUMENT, "tREFI(base)[us]",
+                       "mandatory", INVALID_VALUE,
+                       trefIBase, drs::microsecond),
+        NUMBER_FIELD(ARCHITECTURE_DOCUMENT, "RefreshMode[]",
+                     "mandatory", INVALID_VALUE,
+                     refreshMode, true),
+        QUANTITY_FIELD(ARCHITECTURE_DOCUMENT, "Temperature[C]",
+                       "mandatory", INVALID_VALUE,
+                       temperature, bu::celsius::degrees)
+    };
+    return registry;
+}
+
+#undef NUMBER_FIELD
+#undef FACTOR_FIELD
+#undef QUANTITY_FIELD
+#undef COUNTED_QUANTITY_FIELD
+#undef BOUNDED_QUANTITY_FIELD
+
+const TechnologyField*
+TechnologyValues::findField(const string& name)
+{
+    const vector<TechnologyField>& registry = fieldRegistry();
+    for ( unsigned int it = 0; it < registry.size(); it++ ) {
+        if ( name == registry[it].name ) {
+            return &registry[it];
+        }
+    }
+    return NULL;
+}
+
+const TechnologyField*
+TechnologyValues::findContinuousField(const string& name,
+                                      const TechnologyValues& inputs,
+                                      const char* use, const char* taken)
+{
+    const TechnologyField* field = findField(name);
+    if ( field == NULL || field->isString
+         || field->getNumber(inputs) == INVALID_VALUE ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append(use);
+        exceptionMsgThrown.append(" of \"");
+        exceptionMsgThrown.append(name);
+        exceptionMsgThrown.append("\", which is no numeric input parameter ");
+        exceptionMsgThrown.append("of the configuration.\n");
+        throw exceptionMsgThrown;
+    }
+    if ( field->setInterval == NULL || field->isInteger ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append(use);
+        exceptionMsgThrown.append(" of \"");
+        exceptionMsgThrown.append(name);
+        exceptionMsgThrown.append("\", which is a count, the model takes ");
+        exceptionMsgThrown.append("no ");
+        exceptionMsgThrown.append(taken);
+        exceptionMsgThrown.append(" of it.\n");
+        throw exceptionMsgThrown;
+    }
+    return field;
+}
+
+void
+TechnologyValues::overrideField(const string& name, const string& value)
+{
+    const TechnologyField* field = findField(name);
+    if ( field == NULL ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Unknown input parameter \"");
+        exceptionMsgThrown.append(name);
+        exceptionMsgThrown.append("\" can not be overridden.\n");
+        throw exceptionMsgThrown;
+    }
+
+    if ( field->isString ) {
+        field->setString(*this, value);
+        return;
+    }
+
+    // Decimal numbers only, no "nan", "inf" or hexadecimal ones
+    char* numberEnd = NULL;
+    double number = strtod(value.c_str(), &numberEnd);
+    if ( value.empty() || *numberEnd != '\0'
+         || value.find_first_not_of("0123456789+-.eE") != string::npos ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Input parameter \"");
+        exceptionMsgThrown.append(name);
+        exceptionMsgThrown.append("\" expects a number, got \'");
+        exceptionMsgThrown.append(value);
+        exceptionMsgThrown.append("\'.\n");
+        throw exceptionMsgThrown;
+    }
+    try {
+        checkNumber(*field, number);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+    field->setNumber(*this, number);
+}
+
+bool
+TechnologyValues::isAllowedNumber(const TechnologyField& field, double value)
+{
+    if ( !isfinite(value) || ( field.isInteger && value != round(value) ) ) {
+        return false;
+    }
+    switch ( field.domain ) {
+    case POSITIVE_NUMBER:
+        return value > 0;
+    case NON_NEGATIVE_NUMBER:
+        return value >= 0;
+    default:
+        return true;
+    }
+}
+
+void
+TechnologyValues::checkNumber(const TechnologyField& field, double value)
+{
+    if ( isAllowedNumber(field, value) ) {
+        return;
+    }
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+    shortestDoubleToString(value, buffer);
+    string exceptionMsgThrown("[ERROR] ");
+    exceptionMsgThrown.append("Input parameter \"");
+    exceptionMsgThrown.append(field.name);
+    exceptionMsgThrown.append("\" expects a ");
+    if ( !isfinite(value) ) {
+        exceptionMsgThrown.append("finite");
+    }
+    else if ( field.isInteger && value != round(value) ) {
+        exceptionMsgThrown.append("whole");
+    }
+    else if ( field.domain == POSITIVE_NUMBER ) {
+        exceptionMsgThrown.append("positive");
+    }
+    else {
+        exceptionMsgThrown.append("non-negative");
+    }
+    exceptionMsgThrown.append(" number, got ");
+    exceptionMsgThrown.append(buffer);
+    exceptionMsgThrown.append(".\n");
+    throw exceptionMsgThrown;
+}
+
+void
+TechnologyValues::readFields(const JSONMembers& jsonDoc,
+                             InputDocument document)
+{
+    const vector<TechnologyField>& registry = fieldRegistry();
+    for ( unsigned int it = 0; it < registry.size(); it++ ) {
+        const TechnologyField& field = registry[it];
+        if ( field.document != document ) {
+            continue;
+        }
+
+        if ( field.isString ) {
+            field.setString(*this, getJSONString(jsonDoc,
+                                                 field.name,
+                                                 field.attributeType));
+        }
+        else {
+            field.setNumber(*this, getJSONNumber(jsonDoc,
+                                                 field.name,
+                                                 field.attributeType,
+                                                 field.defaultValue));
+        }
+    }
+}
+
+string
+TechnologyValues::canonicalInputs() const
+{
+    // One "name=value" line per field, numbers in their shortest
+    //  round-trip form, so equal inputs always give the same text
+    //  regardless of formatting or member order in the JSON files.
+    string canonical;
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+
+    const vector<TechnologyField>& registry = fieldRegistry();
+    for ( unsigned int it = 0; it < registry.size(); it++ ) {
+        const TechnologyField& field = registry[it];
+        canonical.append(field.name);
+        canonical.append("=");
+        if ( field.isString ) {
+            canonical.append(field.getString(*this));
+        }
+        else {
+            shortestDoubleToString(field.getNumber(*this), buffer);
+            canonical.append(buffer);
+        }
+        canonical.append("\n");
+    }
+    return canonical;
+}
 
-    // Try to open technology file given by the user
-    ifstream techFile(techFileName);
+void
+TechnologyValues::parseJSONFile(const string& fileName,
+                                const string& fileType,
+                                rapidjson::Document& jsonDoc)
+{
+    // Try to open the file given by the user
+    ifstream jsonFile(fileName);
     // Test if file was (and still is) opened
-    if ( techFile.is_open() == false ) {
+    if ( jsonFile.is_open() == false ) {
         string exceptionMsgThrown;
         exceptionMsgThrown.append("[ERROR] ");
-        exceptionMsgThrown.append("Could not open technology file: ");
-        exceptionMsgThrown.append(techFileName);
+        exceptionMsgThrown.append("Could not open ");
+        exceptionMsgThrown.append(fileType);
+        exceptionMsgThrown.append(" file: ");
+        exceptionMsgThrown.append(fileName);
         exceptionMsgThrown.append("!\n");
         throw exceptionMsgThrown;
     }
 
-    // Find length of the file
-    int techFileLength;
-    techFile.seekg(0, ios::end);
-    techFileLength = techFile.tellg();
-    techFile.seekg(0, ios::beg);
-
-    // Create an internal copy as a C-style string
-    char* techFileText = new char[techFileLength + 1];
-    techFile.read(techFileText, techFileLength);
-    techFileText[ techFileLength ] = '\0';
-
-    // Close the file
-    techFile.close();
+    // Internal copy of the whole file
+    stringstream jsonText;
+    jsonText << jsonFile.rdbuf();
+    jsonFile.close();
 
     // Parse the file as a JSON Document
-    rapidjson::Document techDocument;
-    techDocument.Parse(techFileText);
-    if ( techDocument.HasParseError() ) {
+    jsonDoc.Parse(jsonText.str().c_str());
+    if ( jsonDoc.HasParseError() ) {
         string exceptionMsgThrown;
         exceptionMsgThrown.append("[ERROR] ");
         exceptionMsgThrown.append("Could not parse ");
-        exceptionMsgThrown.append(techFileName);
+        exceptionMsgThrown.append(fileName);
         exceptionMsgThrown.append(" as a JSON document.\n");
         throw exceptionMsgThrown;
     }
+}
+
+// Modification time and size of a file, empty if it can not be found
+static string
+getFileStamp(const string& fileName)
+{
+    long long modificationTime;
+    long modificationTimeNs;
+    long long size;
+    if ( !getFileModification(fileName.c_str(), modificationTime,
+                              modificationTimeNs, size) ) {
+        return "";
+    }
+    ostringstream stamp;
+    stamp << modificationTime << "." << modificationTimeNs << ":" << size;
+    return stamp.str();
+}
+
+const rapidjson::Value*
+ExtendedDocument::findMember(const char* memberName) const
+{
+    for ( const ExtendedDocument* layer = this; layer != NULL;
+          layer = layer->base.get() ) {
+        if ( !layer->document.IsObject() ) {
+            continue;
+        }
+        rapidjson::Value::ConstMemberIterator member
+                = layer->document.FindMember(memberName);
+        if ( member != layer->document.MemberEnd() ) {
+            return &member->value;
+        }
+    }
+    return NULL;
+}
+
+const rapidjson::Value*
+JSONMembers::find(const char* memberName) const
+{
+    if ( extended != NULL ) {
+        return extended->findMember(memberName);
+    }
+    rapidjson::Value::ConstMemberIterator member
+            = value->FindMember(memberName);
+    if ( member == value->MemberEnd() ) {
+        return NULL;
+    }
+    return &member->value;
+}
 
+void
+TechnologyValues::readJSONFile(const string& fileName,
+                               const string& fileType,
+                               ExtendedDocument& jsonDoc,
+                               vector<string>* baseFileNames)
+{
+    vector<string> extendingFileNames;
+    vector<string> readBaseFileNames;
     try {
-        //Technology node in nm
-        technologyNode = getJSONNumber(techDocument,
-                                       "TechnologyNode[nm]",
-                                       "mandatory")
-                         * drs::nanometer;
-
-        //voltage vpp
-        vpp = getJSONNumber(techDocument,
-                            "Vpp[V]",
-                            "mandatory")
-              * si::volt;
-        //voltage vdd
-        vdd = getJSONNumber(techDocument,
-                            "Vdd[V]",
-                            "mandatory")
-              * si::volt;
-
-        //wire resistance in ohm/mm
-        wireResistance = getJSONNumber(techDocument,
-                                       "WireResistance[Ohm/mm]",
-                                       "mandatory")
-                         * drs::ohm_per_millimeter;
-
-        //wire capa in ff/mm
-        wireCapacitance = getJSONNumber(techDocument,
-                                        "WireCapacitance[fF/mm]",
-                                        "mandatory")
-                          * drs::femtofarad_per_millimeter;
-
-        //cell capa
-        capacitancePerCell = getJSONNumber(techDocument,
-                                           "CellCapacitance[fF]",
-                                           "mandatory")
-                             * drs::femtofarads;
-
-        //cell resistance
-        resistancePerCell = getJSONNumber(techDocument,
-                                          "CellResistance[KOhm]",
-                                          "mandatory")
-                            * drs::kiloohm;
-
-        //cell width
-        cellWidth = getJSONNumber(techDocument,
-                                  "CellWidth[um]",
-                                  "mandatory")
-                    * drs::micrometers;
-
-        //cell height
-        cellHeight = getJSONNumber(techDocument,
-                                   "CellHeight[um]",
-                                   "mandatory")
-                     * drs::micrometers;
-
-        //Bitline per cell capa
-        capacitancePerBLCell = getJSONNumber(techDocument,
-                                             "BitlineCapacitancePerCell[aF]",
-                                             "mandatory")
-                               * drs::attofarads;
-
-        //Bitline per cell resistance
-        resistancePerBLCell = getJSONNumber(techDocument,
-                                            "BitlineResistancePerCell[Ohm]",
-                                            "mandatory")
-                              * drs::ohm;
-
-        //Wordline per cell capa
-        capacitancePerWLCell = getJSONNumber(techDocument,
-                                             "WordlineCapacitancePerCell[aF]",
-                                             "mandatory")
-                               * drs::attofarads;
-
-        //Wordline per cell resistance
-        resistancePerWLCell = getJSONNumber(techDocument,
-                                            "WordlineResistancePerCell[Ohm]",
-                                            "mandatory")
-                              * drs::ohm;
-
-        //Sense amp height
-        BLSenseAmpHeight = getJSONNumber(techDocument,
-                                         "PrimarySenseAmpHeight[um]",
-                                         "mandatory")
-                           * drs::micrometer;
-
-        //Local wordline driver width
-        LWLDriverWidth = getJSONNumber(techDocument,
-                                       "LocalWordlineDriverWitdh[um]",
-                                       "mandatory")
-                        * drs::micrometer;
-
-        //Local wordline driver resistance in ohm
-        LWLDriverResistance = getJSONNumber(techDocument,
-                                            "LocalWordlineDriverResistance[Ohm]",
-                                            "mandatory")
-                              * drs::ohm;
-
-        //Row decoder (between tiles) width
-        rowDecoderWidth = getJSONNumber(techDocument,
-                                        "RowDecoderWidth[um]",
-                                        "mandatory")
-                          * drs::micrometer;
-
-        //Global wordline driver resistance in ohm
-        GWLDriverResistance = getJSONNumber(techDocument,
-                                            "GlobalWordlineDriverResistance[Ohm]",
-                                            "mandatory")
-                              * si::ohm;
-
-        //current of SSA in milliamperes
-        Issa = getJSONNumber(techDocument,
-                             "SecondarySenseAmpCurrent[uA]",
-                             "mandatory")
-               * drs::microampere_per_bit;
-
-        // Write Restore Driver resistance
-        WRDriverResistance = getJSONNumber(techDocument,
-                                           "WriteDriverResistance[Ohm]",
-                                           "mandatory")
-                       * drs::ohm;
-
-        //Column decoder (between tiles) height
-        colDecoderHeight = getJSONNumber(techDocument,
-                                         "ColumnDecoderHeight[um]",
-                                         "mandatory")
-                           * drs::micrometer;
-
-        //CSL driver resistance in ohm
-        CSLDriverResistance = getJSONNumber(techDocument,
-                                            "CSLDriverResistance[Ohm]",
-                                            "mandatory")
-                              * si::ohm;
-
-        //CSL load capacitance
-        CSLLoadCapacitance = getJSONNumber(techDocument,
-                                           "CSLLoadCapacitance[fF]",
-                                           "mandatory")
-                         * drs::femtofarads;
-
-        //GDL driver resistance in ohm
-        GDLDriverResistance = getJSONNumber(techDocument,
-                                            "GlobalDataLineDriverResistance[Ohm]",
-                                            "mandatory")
-                              * si::ohm;
-
-        //DQ driver (between banks) height
-        DQDriverHeight = getJSONNumber(techDocument,
-                                       "DQDriverHeight[um]",
-                                       "mandatory")
-                         * drs::micrometer;
-
-        //Length of the wire going from the DQ main wiring to the TSV
-        DQtoTSVWireLength = getJSONNumber(techDocument,
-                                          "DQtoTSVWireLength[um]",
-                                          "mandatory")
-                             * drs::micrometers;
-
-        //DQ driver resistance in ohm
-        DQDriverResistance = getJSONNumber(techDocument,
-                                           "DQDriverResistance[Ohm]",
-                                           "mandatory")
-                             * si::ohm;
-
-        //Background current slope with frequency
-        idd2nFreqSlope = getJSONNumber(techDocument,
-                                       "IDD2NFreqSlope[mA/MHz]",
-                                       "mandatory")
-                                 * drs::milliamperes_per_megahertz_clock;
-
-        //Background current alpha coefficient (models temperature dependency)
-        idd2nTempAlpha = getJSONNumber(techDocument,
-                                       "IDD2NTempAlpha[mA]",
-                                       "mandatory")
-                                 * drs::milliamperes;
-
-        //Background current beta coefficient (models temperature dependency)
-        idd2nTempBeta = getJSONNumber(techDocument,
-                                      "IDD2NTempBeta[C^-1]",
-                                      "mandatory")
-                                 * drs::eergeds;
-
-        //Background current reference temperature (models temperature dependency)
-        idd2nRefTemp = getJSONNumber(techDocument,
-                                     "IDD2NRefTemp[C]",
-                                     "mandatory")
-                                 * bu::celsius::degrees;
-
-        //Background current offset (current at ref temp and 0 MHz)
-        idd2nOffset = getJSONNumber(techDocument,
-                                    "IDD2NOffset[mA]",
-                                    "mandatory")
-                                  * drs::milliamperes;
-
-        //Current slope per IO pin (Off Channel Driver)
-        IddOcdRcvSlope = getJSONNumber(techDocument,
-                                       "OCDCurrentSlope[uA/MHz]",
-                                       "mandatory")
-                                    * drs::microamperes_per_megahertz_clock;
-
-        //Current of the resources shared by all banks
-        fullySharedResourcesCurrent = getJSONNumber(techDocument,
-                                              "FullySharedResourcesCurrent[mA]",
-                                                    "mandatory")
-                                      * drs::milliamperes;
-
-        //Current of the resources shared by blocks of banks
-        semiSharedResourcesCurrent = getJSONNumber(techDocument,
-                                              "SemiSharedResourcesCurrent[mA]",
-                                                   "mandatory")
-                                     * drs::milliamperes;
-
-        //Size of the block of banks that share the same "semi shared" resources
-        nBanksPerSemiSharedResource = getJSONNumber(techDocument,
-                                                "nBanksPerSemiSharedResource[]",
-                                                    "mandatory");
-
-
-        //Height of the TSV area needed for each bank I/O
-        TSVHeight = getJSONNumber(techDocument,
-                                  "TSVHeight[um]",
-                                  "mandatory")
-                    * drs::micrometer;
-
-        //Additional latency required for trl calculation
-        additionalLatencyTrl = getJSONNumber(techDocument,
-                                             "AdditionalTRLLatency[cc]",
-                                             "mandatory")
-                         * drs::clock;
-
-        //Driver enabling delay
-        driverEnableDelay = getJSONNumber(techDocument,
-                                          "DriverEnableDelay[ns]",
-                                          "mandatory")
-                         * drs::nanoseconds;
-
-        //Signal delay from input to output of SSA
-        inOutSSADelay = getJSONNumber(techDocument,
-                                      "InOutSSADelay[ns]",
-                                      "mandatory")
-                         * drs::nanoseconds;
-
-        //Command decoder delay - clock wave pipeline delay
-        cmdDecoderDelay = getJSONNumber(techDocument,
-                                        "CommandDecoderDelay[ns]",
-                                        "mandatory")
-                         * drs::nanoseconds;
-
-        //I/O interface delay
-        IODelay = getJSONNumber(techDocument,
-                                "IODelay[ns]",
-                                "mandatory")
-                         * drs::nanoseconds;
-
-        //Delay for SSA precharging
-        SSAPrechargeDelay = getJSONNumber(techDocument,
-                                          "SSAPrechargeDelay[ns]",
-                                          "mandatory")
-                         * drs::nanoseconds;
-
-        // Security margin for Write Recovery
-        tWRMargin = getJSONNumber(techDocument,
-                                  "tWRMargin[ns]",
-                                  "mandatory")
-                         * drs::nanoseconds;
-
-        //Equalizer circuit enabling delay
-        equalizerDelay = getJSONNumber(techDocument,
-                                       "EqualizerDelay[ns]",
-                                       "mandatory")
-                         * drs::nanoseconds;
-
-        //Vdd -> Vpp pump circuitry efficiency
-        vppPumpsEfficiency = getJSONNumber(techDocument,
-                                           "VppPumpEfficiency[-]",
-                                           "optional",
-                                           0.3);
+        readExtendingJSONFile(fileName, fileType, jsonDoc,
+                              extendingFileNames, readBaseFileNames);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
 
+    if ( baseFileNames != NULL ) {
+        baseFileNames->insert(baseFileNames->end(),
+                              readBaseFileNames.begin(),
+                              readBaseFileNames.end());
+    }
+}
+
+void
+TechnologyValues::readJSONFile(const string& fileName,
+                               const string& fileType,
+                               rapidjson::Document& jsonDoc,
+                               vector<string>* baseFileNames)
+{
+    ExtendedDocument extendedDoc;
+    try {
+        readJSONFile(fileName, fileType, extendedDoc, baseFileNames);
     } catch(string exceptionMsgThrown) {
         throw exceptionMsgThrown;
     }
 
+    if ( !extendedDoc.base ) {
+        jsonDoc.Swap(extendedDoc.document);
+        return;
+    }
 
+    // Members of each file replace those of the bases it extends
+    vector<const rapidjson::Document*> layers;
+    for ( const ExtendedDocument* layer = &extendedDoc; layer != NULL;
+          layer = layer->base.get() ) {
+        layers.insert(layers.begin(), &layer->document);
+    }
+    rapidjson::Document mergedDoc;
+    rapidjson::Document::AllocatorType& allocator = mergedDoc.GetAllocator();
+    mergedDoc.SetObject();
+    for ( unsigned int it = 0; it < layers.size(); it++ ) {
+        for ( rapidjson::Value::ConstMemberIterator member
+                      = layers[it]->MemberBegin();
+              member != layers[it]->MemberEnd(); ++member ) {
+            const char* memberName = member->name.GetString();
+            if ( string(memberName) == "extends" ) {
+                continue;
+            }
+            mergedDoc.RemoveMember(memberName);
+            mergedDoc.AddMember(rapidjson::Value(member->name, allocator),
+                                rapidjson::Value(member->value, allocator),
+                                allocator);
+        }
+    }
+    jsonDoc.Swap(mergedDoc);
+}
 
+TechnologyValues
+TechnologyValues::readSpecification(const string& fileName,
+                                    const string& fileType,
+                                    const string& title,
+                                    rapidjson::Document& jsonDoc,
+                                    string& exceptionMsgThrown)
+{
+    try {
+        readJSONFile(fileName, fileType, jsonDoc);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
 
-    // Try to open architecture file given by the user
-    ifstream archFile(archFileName);
-    // Test if file was (and still is) opened
-    if ( archFile.is_open() == false ) {
-        string exceptionMsgThrown;
-        exceptionMsgThrown.append("[ERROR] ");
-        exceptionMsgThrown.append("Could not open architecture file: ");
-        exceptionMsgThrown.append(archFileName);
-        exceptionMsgThrown.append("!\n");
+    exceptionMsgThrown = "[ERROR] ";
+    exceptionMsgThrown.append(title);
+    exceptionMsgThrown.append(" \'");
+    exceptionMsgThrown.append(fileName);
+    exceptionMsgThrown.append("\' ");
+
+    if ( !jsonDoc.HasMember("technology")
+         || !jsonDoc["technology"].IsString()
+         || !jsonDoc.HasMember("architecture")
+         || !jsonDoc["architecture"].IsString() ) {
+        string missingMsgThrown(exceptionMsgThrown);
+        missingMsgThrown.append("needs \"technology\" and ");
+        missingMsgThrown.append("\"architecture\" file names.\n");
+        throw missingMsgThrown;
+    }
+    try {
+        return TechnologyValues(jsonDoc["technology"].GetString(),
+                                jsonDoc["architecture"].GetString());
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+}
+
+void
+TechnologyValues::readExtendingJSONFile(const string& fileName,
+                                        const string& fileType,
+                                        ExtendedDocument& jsonDoc,
+                                        vector<string>& extendingFileNames,
+                                        vector<string>& baseFileNames)
+{
+    if ( find(extendingFileNames.begin(), extendingFileNames.end(), fileName)
+             != extendingFileNames.end()
+         || extendingFileNames.size() >= maxExtendsDepth ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Could not resolve \"extends\" of ");
+        exceptionMsgThrown.append(extendingFileNames.front());
+        exceptionMsgThrown.append(", it extends itself or more than ");
+        exceptionMsgThrown.append(to_string(maxExtendsDepth));
+        exceptionMsgThrown.append(" files in a row.\n");
         throw exceptionMsgThrown;
     }
+    extendingFileNames.push_back(fileName);
 
-    // Find length of the file
-    int archFileLength;
-    archFile.seekg(0, ios::end);
-    archFileLength = archFile.tellg();
-    archFile.seekg(0, ios::beg);
+    rapidjson::Document& document = jsonDoc.document;
+    jsonDoc.base.reset();
+    try {
+        parseJSONFile(fileName, fileType, document);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
 
-    // Create an internal copy as a C-style string
-    char* archFileText = new char[archFileLength + 1];
-    archFile.read(archFileText, archFileLength);
-    archFileText[ archFileLength ] = '\0';
+    if ( !document.IsObject() || !document.HasMember("extends") ) {
+        return;
+    }
+    if ( !document["extends"].IsString() ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Member \"extends\" of ");
+        exceptionMsgThrown.append(fileName);
+        exceptionMsgThrown.append(" is expected to be a file path.\n");
+        throw exceptionMsgThrown;
+    }
 
-    // Close the file
-    archFile.close();
+    // Relative to the directory of the extending file
+    string baseFileName(document["extends"].GetString());
+    size_t directoryEnd = fileName.rfind('/');
+    if ( !baseFileName.empty() && baseFileName[0] != '/'
+         && directoryEnd != string::npos ) {
+        baseFileName.insert(0, fileName, 0, directoryEnd + 1);
+    }
 
-    // Parse the file as a JSON Document
-    rapidjson::Document archDocument;
-    archDocument.Parse(archFileText);
-    if ( archDocument.HasParseError() ) {
-        string exceptionMsgThrown;
-        exceptionMsgThrown.append("[ERROR] ");
-        exceptionMsgThrown.append("Could not parse ");
-        exceptionMsgThrown.append(archFileName);
-        exceptionMsgThrown.append(" as a JSON document.\n");
+    try {
+        jsonDoc.base = getBaseDocument(baseFileName, fileType,
+                                       extendingFileNames, baseFileNames);
+    } catch(string exceptionMsgThrown) {
         throw exceptionMsgThrown;
     }
+}
+
+shared_ptr<const ExtendedDocument>
+TechnologyValues::getBaseDocument(const string& fileName,
+                                  const string& fileType,
+                                  vector<string>& extendingFileNames,
+                                  vector<string>& baseFileNames)
+{
+    // Parsed base, valid while the files it was read from are unchanged
+    struct BaseDocument {
+        vector<string> fileNames;
+        vector<string> fileStamps;
+        shared_ptr<const ExtendedDocument> document;
+    };
+    static mutex baseDocumentsMutex;
+    static map<string, BaseDocument> baseDocuments;
+
+    {
+        lock_guard<mutex> lock(baseDocumentsMutex);
+        map<string, BaseDocument>::const_iterator cached
+                = baseDocuments.find(fileName);
+        if ( cached != baseDocuments.end() ) {
+            bool isUnchanged = true;
+            for ( unsigned int it = 0;
+                  isUnchanged && it < cached->second.fileNames.size(); it++ ) {
+                isUnchanged = getFileStamp(cached->second.fileNames[it])
+                              == cached->second.fileStamps[it];
+            }
+            if ( isUnchanged ) {
+                baseFileNames.insert(baseFileNames.end(),
+                                     cached->second.fileNames.begin(),
+                                     cached->second.fileNames.end());
+                return cached->second.document;
+            }
+        }
+    }
 
+    BaseDocument base;
+    base.fileNames.push_back(fileName);
+    ExtendedDocument* document = new ExtendedDocument;
+    base.document.reset(document);
     try {
-        //DRAM Type
-        dramType = getJSONString(archDocument,
-                                 "DRAMType[-]",
-                                 "mandatory");
+        readExtendingJSONFile(fileName, fileType, *document,
+                              extendingFileNames, base.fileNames);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+    for ( unsigned int it = 0; it < base.fileNames.size(); it++ ) {
+        base.fileStamps.push_back(getFileStamp(base.fileNames[it]));
+    }
+
+    baseFileNames.insert(baseFileNames.end(),
+                         base.fileNames.begin(), base.fileNames.end());
+
+    lock_guard<mutex> lock(baseDocumentsMutex);
+    baseDocuments[fileName] = base;
+    return base.document;
+}
+
+void
+TechnologyValues::readTechnology(const JSONMembers& techDocument)
+{
+    try {
+        readFields(techDocument, TECHNOLOGY_DOCUMENT);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+    deriveTechnologyConstants();
+}
 
-        //3D ON/OFF Feature
-        //set 3D on for HMC/WideIO/HBM
-        is3D = ( getJSONString(archDocument, "3D[-]", "mandatory") == "ON" );
+template<typename Scalar>
+void
+TechnologyInputs<Scalar>::deriveTechnologyConstants()
+{
+    technologyConstants.cellDelay = timeToPercentage(90)
+            * SCALE_QUANTITY(capacitancePerCell, drs::nanofarad_unit)
+            * SCALE_QUANTITY(resistancePerCell, drs::ohm_unit);
+
+    technologyConstants.wireCapacitancePerMillimeter =
+            SCALE_QUANTITY(wireCapacitance,
+                           drs::nanofarad_per_millimeter_unit);
+    technologyConstants.wireCapacitancePerMicrometer =
+            SCALE_QUANTITY(wireCapacitance,
+                           drs::nanofarad_per_micrometer_unit);
+    technologyConstants.capacitancePerWLCell =
+            SCALE_QUANTITY(capacitancePerWLCell, drs::nanofarad_unit);
+    technologyConstants.capacitancePerBLCell =
+            SCALE_QUANTITY(capacitancePerBLCell, drs::nanofarad_unit);
+    technologyConstants.CSLLoadCapacitance =
+            SCALE_QUANTITY(CSLLoadCapacitance, drs::nanofarad_unit);
+    technologyConstants.Issa =
+            SCALE_QUANTITY(Issa, drs::ampere_per_bit_unit);
+
+    technologyConstants.isValid = true;
+}
 
-        // DLL ON/OFF Feature
-        isDLL = ( getJSONString(archDocument, "DLL[-]", "mandatory") == "ON" );
+void
+TechnologyValues::readArchitecture(const JSONMembers& archDocument)
+{
+    try {
+        readFields(archDocument, ARCHITECTURE_DOCUMENT);
 
         // External Vpp source
+        //  (DDR4, HBM and WideIO have it unless stated otherwise)
         string hasExternalVppStr = getJSONString(archDocument,
                                       "ExternalVPP[-]", "optional");
-        if ( hasExternalVppStr == "YES" ) {
-          hasExternalVpp = true;
-        }
         if ( dramType.find("DDR4")    != string::npos ||
              dramType.find("HBM")     != string::npos ||
              dramType.find("WideIO")  != string::npos
@@ -642,122 +1191,55 @@ TechnologyValues::readjson(const string& t,const string& p)
             warning.append(" should have external Vpp source.\n");
           }
         }
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+}
 
-        //size of DRAM Channel
-        channelSize = getJSONNumber(archDocument,
-                                    "ChannelSize[Gb]",
-                                    "mandatory")
-                      * drs::gibibits;
-
-        //# of banks
-        nBanks = getJSONNumber(archDocument,
-                               "NumberOfBanksPerChannel[]",
-                               "mandatory");
-
-        //# of banks in the row direction
-        nHorizontalBanks = getJSONNumber(archDocument,
-                                         "NumberOfHorizontalBanksPerChannel[]",
-                                         "optional");
-
-        //# of banks in the column direction
-        nVerticalBanks = getJSONNumber(archDocument,
-                                       "NumberOfVerticalBanksPerChannel[]",
-                                       "optional");
-
-        //cells per subarray row
-        cellsPerLWL = getJSONNumber(archDocument,
-                                    "CellsPerSubarrayRow[]",
-                                    "mandatory");
-
-        //cells per subarray row redundancy
-        cellsPerLWLRedundancy = getJSONNumber(archDocument,
-                                              "RedundantCellsPerSubarrayRow[]",
-                                              "mandatory");
-
-        //cells per subarray column
-        cellsPerLBL = getJSONNumber(archDocument,
-                                    "CellsPerSubarrayColumn[]",
-                                    "mandatory");
-
-        //cells per subarray column redundancy
-        cellsPerLBLRedundancy = getJSONNumber(archDocument,
-                                              "RedundantCellsPerSubarrayColumn[]",
-                                              "mandatory");
-
-        //Interface (channel-wise)
-        interface = getJSONNumber(archDocument,
-                                  "Interface[bit]",
-                                  "mandatory")
-                    * drs::bits;
-
-        //Number of prefetched words (interface wide) per CAS
-        prefetch = getJSONNumber(archDocument,
-                                 "Prefetch[]",
-                                 "mandatory");
-
-        //DRAM Frequency
-        dramFreq = getJSONNumber(archDocument,
-                                 "Frequency[MHz]",
-                                 "mandatory")
-                         * drs::megahertz_clock;
-
-        //DRAM Core Frequency
-        dramCoreFreq = getJSONNumber(archDocument,
-                                     "CoreFrequency[MHz]",
-                                     "mandatory")
-                         * drs::megahertz_clock;
-
-        // Number of tiles per bank
-        nTilesPerBank = getJSONNumber(archDocument,
-                                      "TilesPerBank[]",
-                                      "mandatory");
-
-        // Page size - number of local sense amp. activated in a row access
-        pageStorage = getJSONNumber(archDocument,
-                                    "PageSize[KB]",
-                                    "mandatory")
-                         * drs::kibibyte;
-
-        // Spanning factor of pages across tiles
-        pageSpanningFactor = getJSONNumber(archDocument,
-                                           "PageSpanningFactor[]",
-                                           "mandatory");
-
-        // Subarray to page factor (inverse percentage bitlines that are sensed per row access)
-        subArrayToPageFactor = getJSONNumber(archDocument,
-                                             "SubarrayToPageFactor[]",
-                                             "mandatory");
-
-        // DRAM Bitline Architecture: OPEN or FOLDED bitline
-        BLArchitecture = getJSONString(archDocument,
-                                       "BitlineArchitecture[-]",
-                                       "mandatory");
-
-        // Retention time
-        retentionTime = getJSONNumber(archDocument,
-                                      "RetentionTime[ms]",
-                                      "mandatory")
-                         * drs::millisecond;
-
-        // Normal mode and temp. average interval between AR commands
-        trefIBase = getJSONNumber(archDocument,
-                                  "tREFI(base)[us]",
-                                  "mandatory")
-                         * drs::microsecond;
-
-        // Refresh mode according to JEDEC (eg., JESD79-4B)
-        refreshMode = getJSONNumber(archDocument,
-                                    "RefreshMode[]",
-                                    "mandatory");
-
-        // Temperature used for timings and currents calculations
-        temperature = getJSONNumber(archDocument,
-                                    "Temperature[C]",
-                                    "mandatory")
-                         * bu::celsius::degrees;
+void
+TechnologyValues::readjson(const string& t,const string& p)
+{
+    techFileName = t;
+    archFileName = p;
 
+    try {
+        readTechnologyFile();
+        readArchitectureFile();
     } catch(string exceptionMsgThrown) {
         throw exceptionMsgThrown;
     }
+}
 
+void
+TechnologyValues::readTechnologyFile()
+{
+    try {
+        ExtendedDocument techDocument;
+        readJSONFile(techFileName, "technology", techDocument,
+                     &baseFileNames);
+        readTechnology(techDocument);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
 }
+
+void
+TechnologyValues::readArchitectureFile()
+{
+    try {
+        ExtendedDocument archDocument;
+        readJSONFile(archFileName, "architecture", archDocument,
+                     &baseFileNames);
+        readArchitecture(archDocument);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+}
+
+template class TechnologyInputs<double>;
+template class TechnologyInputs<Dual>;
+template class TechnologyInputs<Interval>;
+template TechnologyInputs<Dual>::TechnologyInputs(
+                                    const TechnologyInputs<double>& inputs);
+template TechnologyInputs<Interval>::TechnologyInputs(
+                                    const TechnologyInputs<double>& inputs);
@@ -49,6 +49,7 @@
 #include <vector>
 #include <stdio.h>
 #include <string>
+#include <memory>
 
 #include "rapidjson/include/rapidjson/document.h"
 
@@ -64,170 +65,255 @@ namespace drs=boost::units::dramspec;
 
 using namespace std;
 
-class TechnologyValues
+class Dual;
+class Interval;
+template<typename Scalar> class TechnologyInputs;
+class TechnologyValues;
+
+// A parsed input file and the parsed base it extends, if any (see
+//  readJSONFile). Bases are shared, members are looked up in the file
+//  first and then along its bases, so that no base is ever copied.
+struct ExtendedDocument
+{
+    rapidjson::Document document;
+    shared_ptr<const ExtendedDocument> base;
+
+    // NULL if neither the file nor its bases have this member
+    const rapidjson::Value* findMember(const char* memberName) const;
+};
+
+// Members of an input document, given inline or read from a file
+class JSONMembers
 {
   public:
+    JSONMembers(const rapidjson::Value& document)
+        : value(&document), extended(NULL) {}
+    JSONMembers(const ExtendedDocument& document)
+        : value(NULL), extended(&document) {}
 
-    TechnologyValues() //Empty constructor for test proposes
-    {
-        technologyValuesInitialize();
-    }
+    // NULL if there is no member with this name
+    const rapidjson::Value* find(const char* memberName) const;
 
-    TechnologyValues(const string& technologyFileName,
-                     const string& architectureFileName)
-    {
-        technologyValuesInitialize();
-        try {
-            readjson(technologyFileName, architectureFileName);
-        } catch(string exceptionMsgThrown) {
-            throw exceptionMsgThrown;
-        }
+  private:
+    const rapidjson::Value* value;
+    const ExtendedDocument* extended;
+};
 
-    }
+// Input file an input parameter is read from
+enum InputDocument { TECHNOLOGY_DOCUMENT, ARCHITECTURE_DOCUMENT };
 
-    // Technologyfile name to be read
-    string techFileName;
+// Numbers the model takes for an input parameter, besides finite ones
+enum NumberDomain { ANY_NUMBER, POSITIVE_NUMBER, NON_NEGATIVE_NUMBER };
 
-    // Parameter file name to be read
-    string archFileName;
+// Description of one input parameter, which gives access to it by the
+//  name of its JSON member (e.g. "Vpp[V]"), see fieldRegistry().
+struct TechnologyField
+{
+    const char* name;
+    InputDocument document;
+    const char* attributeType; // "mandatory" or "optional"
+    bool isString;
+    bool isInteger;            // Counts, which take whole numbers only
+    double defaultValue;       // Value of a missing optional number
+
+    // Numbers, in the unit of the JSON member
+    double (*getNumber)(const TechnologyValues& values);
+    void (*setNumber)(TechnologyValues& values, double value);
+
+    // Strings (and ON/OFF, YES/NO switches)
+    string (*getString)(const TechnologyValues& values);
+    void (*setString)(TechnologyValues& values, const string& value);
+
+    // Numbers the model computes on as Scalar (quantities and factors, not
+    //  counts), set with their derivatives or as an interval. NULL for the
+    //  others.
+    void (*setDual)(TechnologyInputs<Dual>& values, const Dual& value);
+    void (*setInterval)(TechnologyInputs<Interval>& values,
+                        const Interval& value);
+
+    // E.g. no frequency of 0, which gives no finite results
+    NumberDomain domain;
+};
+
+// Quantities which depend on the technology parameters only. They are
+//  derived once per technology (deriveTechnologyConstants) and copied with
+//  the input parameters into every evaluation against that technology.
+template<typename Scalar>
+struct TechnologyConstants
+{
+    // Cleared whenever a technology parameter is set
+    bool isValid;
+
+    // Delay of the cell (90% of its charge shared with the bitline)
+    bu::quantity<drs::nanosecond_unit, Scalar> cellDelay;
+
+    // Technology parameters in the units they are calculated with
+    bu::quantity<drs::nanofarad_per_millimeter_unit, Scalar>
+                                              wireCapacitancePerMillimeter;
+    bu::quantity<drs::nanofarad_per_micrometer_unit, Scalar>
+                                              wireCapacitancePerMicrometer;
+    bu::quantity<drs::nanofarad_unit, Scalar> capacitancePerWLCell;
+    bu::quantity<drs::nanofarad_unit, Scalar> capacitancePerBLCell;
+    bu::quantity<drs::nanofarad_unit, Scalar> CSLLoadCapacitance;
+    bu::quantity<drs::ampere_per_bit_unit, Scalar> Issa;
+};
+
+// Input parameters the model computes with. The model is generic over
+//  the type of its numbers (see BasicSubArray): quantities and factors
+//  are of type Scalar (double, or e.g. Dual to differentiate the model),
+//  counts and switches are plain values.
+template<typename Scalar>
+class TechnologyInputs
+{
+  public:
+
+    TechnologyInputs()
+    {
+        technologyInputsInitialize();
+    }
+
+    // Same inputs on another scalar type. The technology constants are
+    //  left to be derived again on the new type.
+    template<typename Other>
+    explicit TechnologyInputs(const TechnologyInputs<Other>& inputs);
 
     //Technology node in nm
-    bu::quantity<drs::nanometer_unit> technologyNode;
+    bu::quantity<drs::nanometer_unit, Scalar> technologyNode;
 
     //voltage vpp
-    bu::quantity<si::electric_potential> vpp;
+    bu::quantity<si::electric_potential, Scalar> vpp;
 
     //voltage vdd
-    bu::quantity<si::electric_potential> vdd;
+    bu::quantity<si::electric_potential, Scalar> vdd;
 
     //wire resistance in ohm/mm
-    bu::quantity<drs::ohm_per_millimeter_unit> wireResistance;
+    bu::quantity<drs::ohm_per_millimeter_unit, Scalar> wireResistance;
 
     //wire capa in ff/mm
-    bu::quantity<drs::femtofarad_per_millimeter_unit> wireCapacitance;
+    bu::quantity<drs::femtofarad_per_millimeter_unit, Scalar> wireCapacitance;
 
     //cell capacitance
-    bu::quantity<drs::femtofarad_unit> capacitancePerCell;
+    bu::quantity<drs::femtofarad_unit, Scalar> capacitancePerCell;
 
     //cell resistance
-    bu::quantity<drs::kiloohm_unit> resistancePerCell;
+    bu::quantity<drs::kiloohm_unit, Scalar> resistancePerCell;
 
     //cell width
-    bu::quantity<drs::micrometer_unit> cellWidth;
+    bu::quantity<drs::micrometer_unit, Scalar> cellWidth;
 
     //cell height
-    bu::quantity<drs::micrometer_unit> cellHeight;
+    bu::quantity<drs::micrometer_unit, Scalar> cellHeight;
 
     //Bitline per cell capa
-    bu::quantity<drs::attofarad_unit> capacitancePerBLCell;
+    bu::quantity<drs::attofarad_unit, Scalar> capacitancePerBLCell;
 
     //Bitline per cell resistance
-    bu::quantity<drs::ohm_unit> resistancePerBLCell;
+    bu::quantity<drs::ohm_unit, Scalar> resistancePerBLCell;
 
     //Wordline per cell capa
-    bu::quantity<drs::attofarad_unit> capacitancePerWLCell;
+    bu::quantity<drs::attofarad_unit, Scalar> capacitancePerWLCell;
 
     //Wordline per cell resistance
-    bu::quantity<drs::ohm_unit> resistancePerWLCell;
+    bu::quantity<drs::ohm_unit, Scalar> resistancePerWLCell;
 
     //sense amp height
-    bu::quantity<drs::micrometer_unit> BLSenseAmpHeight;
+    bu::quantity<drs::micrometer_unit, Scalar> BLSenseAmpHeight;
 
     //wordline driver width
-    bu::quantity<drs::micrometer_unit> LWLDriverWidth;
+    bu::quantity<drs::micrometer_unit, Scalar> LWLDriverWidth;
 
     //Local wordline driver resistance in ohm
-    bu::quantity<drs::ohm_unit> LWLDriverResistance;
+    bu::quantity<drs::ohm_unit, Scalar> LWLDriverResistance;
 
     //Row decoder (between tiles) width
-    bu::quantity<drs::micrometer_unit> rowDecoderWidth;
+    bu::quantity<drs::micrometer_unit, Scalar> rowDecoderWidth;
 
     //global wordline driver resistance in ohm
-    bu::quantity<drs::ohm_unit> GWLDriverResistance;
+    bu::quantity<drs::ohm_unit, Scalar> GWLDriverResistance;
 
     //current of SSA in microamperes
-    bu::quantity<drs::microampere_per_bit_unit> Issa;
+    bu::quantity<drs::microampere_per_bit_unit, Scalar> Issa;
 
     //Write Restore Driver Resistance
-    bu::quantity<drs::ohm_unit> WRDriverResistance;
+    bu::quantity<drs::ohm_unit, Scalar> WRDriverResistance;
 
     //Column decoder (between tiles) height
-    bu::quantity<drs::micrometer_unit> colDecoderHeight;
+    bu::quantity<drs::micrometer_unit, Scalar> colDecoderHeight;
 
     //CSL driver resistance in ohm
-    bu::quantity<drs::ohm_unit> CSLDriverResistance;
+    bu::quantity<drs::ohm_unit, Scalar> CSLDriverResistance;
 
     //Load capacitance
-    bu::quantity<drs::femtofarad_unit> CSLLoadCapacitance;
+    bu::quantity<drs::femtofarad_unit, Scalar> CSLLoadCapacitance;
 
     //GDL driver resistance in ohm
-    bu::quantity<drs::ohm_unit> GDLDriverResistance;
+    bu::quantity<drs::ohm_unit, Scalar> GDLDriverResistance;
 
     //DQ driver (between banks) height
-    bu::quantity<drs::micrometer_unit> DQDriverHeight;
+    bu::quantity<drs::micrometer_unit, Scalar> DQDriverHeight;
 
     //Length of the wire going from the DQ main wiring to the TSV
-    bu::quantity<drs::micrometer_unit> DQtoTSVWireLength;
+    bu::quantity<drs::micrometer_unit, Scalar> DQtoTSVWireLength;
 
     //DQ driver resistance in ohm
-    bu::quantity<drs::ohm_unit> DQDriverResistance;
+    bu::quantity<drs::ohm_unit, Scalar> DQDriverResistance;
 
     //Background current slope with frequency
-    bu::quantity<drs::milliampere_per_megahertz_clock_unit> idd2nFreqSlope;
+    bu::quantity<drs::milliampere_per_megahertz_clock_unit, Scalar> idd2nFreqSlope;
 
     //Background current alpha coefficient (models temperature dependency)
-    bu::quantity<drs::milliampere_unit> idd2nTempAlpha;
+    bu::quantity<drs::milliampere_unit, Scalar> idd2nTempAlpha;
 
     //Background current beta coefficient (models temperature dependency)
-    bu::quantity<drs::per_temperature_unit> idd2nTempBeta;
+    bu::quantity<drs::per_temperature_unit, Scalar> idd2nTempBeta;
 
     //Background current reference temperature (models temperature dependency)
-    bu::quantity<bu::celsius::temperature> idd2nRefTemp;
+    bu::quantity<bu::celsius::temperature, Scalar> idd2nRefTemp;
 
     //Background current offset (current at ref temp and 0 MHz)
-    bu::quantity<drs::milliampere_unit> idd2nOffset;
+    bu::quantity<drs::milliampere_unit, Scalar> idd2nOffset;
 
     //Current slope per IO pin in relation to clock frequency
-    bu::quantity<drs::microampere_per_megahertz_clock_unit> IddOcdRcvSlope;
+    bu::quantity<drs::microampere_per_megahertz_clock_unit, Scalar> IddOcdRcvSlope;
 
     //Current of the resources shared by all banks
-    bu::quantity<drs::milliampere_unit> fullySharedResourcesCurrent;
+    bu::quantity<drs::milliampere_unit, Scalar> fullySharedResourcesCurrent;
 
     //Current of the resources shared by blocks of banks
-    bu::quantity<drs::milliampere_unit> semiSharedResourcesCurrent;
+    bu::quantity<drs::milliampere_unit, Scalar> semiSharedResourcesCurrent;
 
     //Size of the block of banks that share the same "semi shared" resources
     double nBanksPerSemiSharedResource;
 
     //Height of the TSV area needed for each bank I/O
-    bu::quantity<drs::micrometer_unit> TSVHeight;
+    bu::quantity<drs::micrometer_unit, Scalar> TSVHeight;
 
     //Additional latency required for trl calculation
-    bu::quantity<drs::clock_unit> additionalLatencyTrl;
+    bu::quantity<drs::clock_unit, Scalar> additionalLatencyTrl;
 
     //Driver enabling delay
-    bu::quantity<drs::nanosecond_unit> driverEnableDelay;
+    bu::quantity<drs::nanosecond_unit, Scalar> driverEnableDelay;
 
     //Signal delay from input to output of SSA
-    bu::quantity<drs::nanosecond_unit> inOutSSADelay;
+    bu::quantity<drs::nanosecond_unit, Scalar> inOutSSADelay;
 
     //Command decoder delay - clock wave pipeline delay
-    bu::quantity<drs::nanosecond_unit> cmdDecoderDelay;
+    bu::quantity<drs::nanosecond_unit, Scalar> cmdDecoderDelay;
 
     //I/O interface delay
-    bu::quantity<drs::nanosecond_unit> IODelay;
+    bu::quantity<drs::nanosecond_unit, Scalar> IODelay;
 
     //Delay for SSA precharging
-    bu::quantity<drs::nanosecond_unit> SSAPrechargeDelay;
+    bu::quantity<drs::nanosecond_unit, Scalar> SSAPrechargeDelay;
 
     // Security margin for Write Recovery
-    bu::quantity<drs::nanosecond_unit> tWRMargin;
+    bu::quantity<drs::nanosecond_unit, Scalar> tWRMargin;
 
     //Equalizer circuit enabling delay
-    bu::quantity<drs::nanosecond_unit> equalizerDelay;
+    bu::quantity<drs::nanosecond_unit, Scalar> equalizerDelay;
 
     //Vdd -> Vpp pump circuitry efficiency
-    double vppPumpsEfficiency;
+    Scalar vppPumpsEfficiency;
 
 
 
@@ -244,7 +330,7 @@ class TechnologyValues
     bool hasExternalVpp;
 
     //size of DRAM Channel
-    bu::quantity<drs::gibibit_unit> channelSize;
+    bu::quantity<drs::gibibit_unit, Scalar> channelSize;
 
     //# of banks
     double nBanks;
@@ -268,22 +354,22 @@ class TechnologyValues
     double cellsPerLBLRedundancy;
 
     //Interface (channel-wise)
-    bu::quantity<drs::bit_unit> interface;
+    bu::quantity<drs::bit_unit, Scalar> interface;
 
     //Number of prefetched words (interface wide) per CAS
     double prefetch;
 
     //DRAM Frequency
-    bu::quantity<drs::megahertz_clock_unit> dramFreq;
+    bu::quantity<drs::megahertz_clock_unit, Scalar> dramFreq;
 
     //DRAM Core Frequency
-    bu::quantity<drs::megahertz_clock_unit> dramCoreFreq;
+    bu::quantity<drs::megahertz_clock_unit, Scalar> dramCoreFreq;
 
     // Number of tiles per bank
     double nTilesPerBank;
 
     // Page size - number of local sense amp. activated in a row access
-    bu::quantity<drs::kibibyte_unit> pageStorage;
+    bu::quantity<drs::kibibyte_unit, Scalar> pageStorage;
 
     // Spanning factor of a page across tiles
     //  How much of the page storage is in each tile
@@ -296,16 +382,20 @@ class TechnologyValues
     string BLArchitecture;
 
     // Retention time
-    bu::quantity<drs::millisecond_unit> retentionTime;
+    bu::quantity<drs::millisecond_unit, Scalar> retentionTime;
 
     // Normal mode and temp. average interval between AR commands
-    bu::quantity<drs::microsecond_unit> trefIBase;
+    bu::quantity<drs::microsecond_unit, Scalar> trefIBase;
 
     // Refresh mode according to JEDEC (eg., JESD79-4B)
     double refreshMode;
 
     // Temperature used for timings and currents calculations
-    bu::quantity<bu::celsius::temperature> temperature;
+    bu::quantity<bu::celsius::temperature, Scalar> temperature;
+
+    // Derived from the technology parameters above
+    TechnologyConstants<Scalar> technologyConstants;
+    void deriveTechnologyConstants();
 
 
 
@@ -313,21 +403,128 @@ class TechnologyValues
     string warning;
 
 
-    void technologyValuesInitialize();
+    void technologyInputsInitialize();
+};
+
+class TechnologyValues : public TechnologyInputs<double>
+{
+  public:
+
+    TechnologyValues() //Empty constructor for test proposes
+    {
+    }
+
+    TechnologyValues(const string& technologyFileName,
+                     const string& architectureFileName)
+    {
+        try {
+            readjson(technologyFileName, architectureFileName);
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+
+    }
+
+    // Technologyfile name to be read
+    string techFileName;
+
+    // Parameter file name to be read
+    string archFileName;
+
+    // Base files the input files extend, directly or indirectly
+    vector<string> baseFileNames;
 
-    double getJSONNumber(const rapidjson::Document& jsonDoc,
+    double getJSONNumber(const JSONMembers& jsonDoc,
                          const char* memberName,
                          const string& attributeType);
-    double getJSONNumber(const rapidjson::Document& jsonDoc,
+    double getJSONNumber(const JSONMembers& jsonDoc,
                          const char* memberName,
                          const string& attributeType,
                          double deafultValue);
 
-    string getJSONString(const rapidjson::Document& jsonDoc,
+    string getJSONString(const JSONMembers& jsonDoc,
                          const char* memberName,
                          const string& attributeType);
 
     void readjson(const string& t,const string& p);
+    // readjson in two steps, from techFileName and archFileName, so a
+    //  technology read once can be copied for several architectures
+    void readTechnologyFile();
+    void readArchitectureFile();
+
+    // An input file may extend a base file ("extends": "<base path>",
+    //  relative to the extending file), replacing some of its members.
+    // Bases are parsed once and kept for the process, while unchanged.
+    static void readJSONFile(const string& fileName,
+                             const string& fileType,
+                             ExtendedDocument& jsonDoc,
+                             vector<string>* baseFileNames = NULL);
+    // Same, merged into one document (copies the members of the bases,
+    //  for specification files which are read once)
+    static void readJSONFile(const string& fileName,
+                             const string& fileType,
+                             rapidjson::Document& jsonDoc,
+                             vector<string>* baseFileNames = NULL);
+    // Specification file of an analysis (e.g. -explore), which names the
+    //  "technology" and "architecture" files of its base configuration.
+    // Returns the base configuration. Error messages about the rest of
+    //  the specification start with exceptionMsgThrown, e.g.
+    //  "[ERROR] Exploration 'spec.json' ".
+    static TechnologyValues readSpecification(const string& fileName,
+                                              const string& fileType,
+                                              const string& title,
+                                              rapidjson::Document& jsonDoc,
+                                              string& exceptionMsgThrown);
+
+    // Longest chain of files extending each other
+    static const unsigned int maxExtendsDepth = 16;
+
+    // Input parameters of each document, from a file or given inline
+    void readTechnology(const JSONMembers& techDocument);
+    void readArchitecture(const JSONMembers& archDocument);
+
+    void readFields(const JSONMembers& jsonDoc,
+                    InputDocument document);
+
+    // All input parameters, in the order they are read
+    static const vector<TechnologyField>& fieldRegistry();
+    // NULL if there is no input parameter with this name
+    static const TechnologyField* findField(const string& name);
+    // Numeric input parameter which the inputs give and which takes real
+    //  numbers, not a count (nor a factor of a few values). Throws why
+    //  not, as "<use> of ..., the model takes no <taken> of it".
+    static const TechnologyField* findContinuousField(
+            const string& name, const TechnologyValues& inputs,
+            const char* use, const char* taken);
+
+    // Replaces an input parameter after reading (see -D), a number
+    //  given as text in the unit of its JSON member name
+    void overrideField(const string& name, const string& value);
+
+    // Whether a number given for an input parameter (by -D, a request or
+    //  a point of the C interface) is finite, whole for counts and in the
+    //  domain of the field
+    static bool isAllowedNumber(const TechnologyField& field, double value);
+    // Throws why it is not
+    static void checkNumber(const TechnologyField& field, double value);
+
+    // Normalized text of all input parameters (see result cache)
+    string canonicalInputs() const;
+
+  private:
+    static void parseJSONFile(const string& fileName,
+                              const string& fileType,
+                              rapidjson::Document& jsonDoc);
+    static void readExtendingJSONFile(const string& fileName,
+                                      const string& fileType,
+                                      ExtendedDocument& jsonDoc,
+                                      vector<string>& extendingFileNames,
+                                      vector<string>& baseFileNames);
+    static shared_ptr<const ExtendedDocument> getBaseDocument(
+                                      const string& fileName,
+                                      const string& fileType,
+                                      vector<string>& extendingFileNames,
+                                      vector<string>& baseFileNames);
 
 };
 #endif //TECHNOLOGYVALUES_H
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#include "ToleranceAnalyzer.h"
+
+#include <cmath>
+
+#include "../core/Interval.h"
+
+ToleranceAnalyzer::ToleranceAnalyzer(bool IOTerminationCurrentFlag) :
+    IOTerminationCurrentFlag(IOTerminationCurrentFlag)
+{
+    nEvaluations = 0;
+}
+
+void
+ToleranceAnalyzer::readSpecification(const string& specificationFileName)
+{
+    rapidjson::Document specification;
+    string exceptionMsgThrown;
+    try {
+        baseInputs = TechnologyValues::readSpecification(
+                         specificationFileName, "tolerance", "Tolerance specification",
+                         specification, exceptionMsgThrown);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    if ( !specification.HasMember("tolerances")
+         || !specification["tolerances"].IsObject()
+         || specification["tolerances"].MemberCount() == 0 ) {
+        exceptionMsgThrown.append("needs \"tolerances\", an object of ");
+        exceptionMsgThrown.append("input parameters.\n");
+        throw exceptionMsgThrown;
+    }
+    tolerances.clear();
+    const rapidjson::Value& toleranceList = specification["tolerances"];
+    for ( rapidjson::Value::ConstMemberIterator member
+                = toleranceList.MemberBegin();
+          member != toleranceList.MemberEnd(); ++member ) {
+        string name(member->name.GetString());
+        const rapidjson::Value& tolerance = member->value;
+        if ( !tolerance.IsNumber()
+             && ( !tolerance.IsObject()
+                  || !tolerance.HasMember("minimum")
+                  || !tolerance["minimum"].IsNumber()
+                  || !tolerance.HasMember("maximum")
+                  || !tolerance["maximum"].IsNumber() ) ) {
+            exceptionMsgThrown.append("gives \"");
+            exceptionMsgThrown.append(name);
+            exceptionMsgThrown.append("\" neither a relative tolerance nor ");
+            exceptionMsgThrown.append("a \"minimum\" and \"maximum\".\n");
+            throw exceptionMsgThrown;
+        }
+        try {
+            if ( tolerance.IsNumber() ) {
+                addRelativeTolerance(name, tolerance.GetDouble());
+            }
+            else {
+                addRange(name, tolerance["minimum"].GetDouble(),
+                         tolerance["maximum"].GetDouble());
+            }
+        } catch(string exceptionMsgThrown) {
+            throw exceptionMsgThrown;
+        }
+    }
+}
+
+void
+ToleranceAnalyzer::addRelativeTolerance(const string& name, double tolerance)
+{
+    Tolerance relative;
+    try {
+        relative.field = TechnologyValues::findContinuousField(
+                name, baseInputs, "Tolerance", "range");
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+    if ( tolerance < 0 ) {
+        string exceptionMsgThrown("[ERROR] ");
+        exceptionMsgThrown.append("Relative tolerance of \"");
+        exceptionMsgThrown.append(name);
+        exceptionMsgThrown.append("\" must not be negative.\n");
+        throw exceptionMsgThrown;
+    }
+    relative.isRelative = true;
+    relative.relativeTolerance = tolerance;
+    relative.minimum = 0;
+    relative.maximum = 0;
+    tolerances.push_back(relative);
+}
+
+void
+ToleranceAnalyzer::addRange(const string& name, double minimum,
+                            double maximum)
+{
+    Tolerance range;
+    try {
+        range.field = TechnologyValues::findContinuousField(
+                name, baseInputs, "Tolerance", "range");
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+    range.isRelative = false;
+    range.relativeTolerance = 0;
+    range.minimum = minimum;
+    range.maximum = maximum;
+    tolerances.push_back(range);
+}
+
+// Rejection of the tolerance box by the model
+static string
+toleranceMessage(const string& exceptionMsgThrown)
+{
+    string toleranceMsgThrown("[ERROR] ");
+    toleranceMsgThrown.append("Within the tolerances: ");
+    toleranceMsgThrown.append(exceptionMsgThrown.compare(0, 8, "[ERROR] ") == 0
+                              ? exceptionMsgThrown.substr(8)
+                              : exceptionMsgThrown);
+    return toleranceMsgThrown;
+}
+
+void
+ToleranceAnalyzer::analyze()
+{
+    TechnologyInputs<Interval> intervalInputs(baseInputs);
+    for ( unsigned int it = 0; it < tolerances.size(); it++ ) {
+        const Tolerance& tolerance = tolerances[it];
+        double value = tolerance.field->getNumber(baseInputs);
+        Interval range(tolerance.minimum, tolerance.maximum);
+        if ( tolerance.isRelative ) {
+            // Rounded outwards as the model
+            Interval deviation = Interval(tolerance.relativeTolerance)
+                                 * Interval(fabs(value));
+            range = Interval(value)
+                    + Interval(-deviation.upper, deviation.upper);
+        }
+        else if ( tolerance.minimum > value || value > tolerance.maximum ) {
+            string exceptionMsgThrown("[ERROR] ");
+            exceptionMsgThrown.append("Range of \"");
+            exceptionMsgThrown.append(tolerance.field->name);
+            exceptionMsgThrown.append("\" must hold the value of the ");
+            exceptionMsgThrown.append("configuration.\n");
+            throw exceptionMsgThrown;
+        }
+        tolerance.field->setInterval(intervalInputs, range);
+    }
+
+    // The nominal configuration is rejected as in a normal run
+    try {
+        Current dram(baseInputs, IOTerminationCurrentFlag);
+        nominalResult.collect(dram);
+    } catch(string exceptionMsgThrown) {
+        throw exceptionMsgThrown;
+    }
+
+    // One evaluation on the intervals bounds all results
+    Interval values[DramResult::N_VALUES];
+    try {
+        BasicCurrent<Interval> dram(intervalInputs, IOTerminationCurrentFlag);
+        DramResult::collectValues(dram, values);
+    } catch(string exceptionMsgThrown) {
+        throw toleranceMessage(exceptionMsgThrown);
+    }
+    nEvaluations = 2;
+
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        minimumResult.values[valueID] = values[valueID].lower;
+        maximumResult.values[valueID] = values[valueID].upper;
+    }
+}
+
+void
+ToleranceAnalyzer::writeBounds(ostream& boundFile) const
+{
+    boundFile << "Result,Nominal,Minimum,Maximum\n";
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        boundFile << DramResult::names[valueID];
+        shortestDoubleToString(nominalResult.values[valueID], buffer);
+        boundFile << "," << buffer;
+        shortestDoubleToString(minimumResult.values[valueID], buffer);
+        boundFile << "," << buffer;
+        shortestDoubleToString(maximumResult.values[valueID], buffer);
+        boundFile << "," << buffer << "\n";
+    }
+}
+
+void
+ToleranceAnalyzer::printBounds(ostream& output) const
+{
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        output << DramResult::names[valueID] << ": ";
+        shortestDoubleToString(nominalResult.values[valueID], buffer);
+        output << buffer << " [";
+        shortestDoubleToString(minimumResult.values[valueID], buffer);
+        output << buffer << ", ";
+        shortestDoubleToString(maximumResult.values[valueID], buffer);
+        output << buffer << "]" << endl;
+    }
+    output << tolerances.size() << " tolerances, " << nEvaluations
+           << " evaluations" << endl;
+}
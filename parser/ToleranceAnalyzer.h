@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef TOLERANCEANALYZER_H
+#define TOLERANCEANALYZER_H
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+#include "TechnologyValues.h"
+#include "DramResult.h"
+
+using namespace std;
+
+// Tolerance of one input parameter: relative to its value, or a range in
+//  the unit of its JSON member
+struct Tolerance
+{
+    const TechnologyField* field;
+    bool isRelative;
+    double relativeTolerance;
+    double minimum;
+    double maximum;
+};
+
+// Bounds of the results over tolerances of input parameters
+//  (-tolerance <specification>):
+//   {
+//     "technology": "<technology file>",
+//     "architecture": "<architecture file>",
+//     "tolerances": {
+//       "BitlineCapacitancePerCell[aF]": 0.1,
+//       "Temperature[C]": { "minimum": 25, "maximum": 80 }
+//     }
+//   }
+// A number is a relative tolerance (0.1: +-10%), an object an absolute
+//  range which has to hold the value of the configuration (after -D).
+//  Counts (e.g. NumberOfBanksPerChannel[]) cannot be given a tolerance.
+// The model is evaluated once on intervals (see Interval.h): every result
+//  is bounded over the whole tolerance box, also through the steps of the
+//  clock cycles and the exp temperature term, with outward rounding. The
+//  bounds hold for every configuration in the box, but may be wider than
+//  the range of the results. Tolerances which span a branch of the model
+//  (e.g. a temperature range across 85 C) are rejected.
+class ToleranceAnalyzer
+{
+public:
+    explicit ToleranceAnalyzer(bool IOTerminationCurrentFlag);
+
+    void readSpecification(const string& specificationFileName);
+
+    void addRelativeTolerance(const string& name, double tolerance);
+    void addRange(const string& name, double minimum, double maximum);
+
+    void analyze();
+
+    const DramResult& nominal() const { return nominalResult; }
+    const DramResult& minimum() const { return minimumResult; }
+    const DramResult& maximum() const { return maximumResult; }
+
+    void writeBounds(ostream& boundFile) const;
+    void printBounds(ostream& output) const;
+
+    // Base configuration, -D overrides are applied by the caller
+    TechnologyValues baseInputs;
+
+    unsigned int nEvaluations;
+
+private:
+    bool IOTerminationCurrentFlag;
+    vector<Tolerance> tolerances;
+
+    DramResult nominalResult;
+    DramResult minimumResult;
+    DramResult maximumResult;
+};
+
+#endif // TOLERANCEANALYZER_H
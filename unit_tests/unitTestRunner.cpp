@@ -49,3 +49,26 @@
 #include "unit_tests/ChannelTest.cpp"
 #include "unit_tests/TimingTest.cpp"
 #include "unit_tests/CurrentTest.cpp"
+#include "unit_tests/ResultFormatterTest.cpp"
+#include "unit_tests/OutputWriterTest.cpp"
+#include "unit_tests/ShardMergerTest.cpp"
+#include "unit_tests/CheckpointJournalTest.cpp"
+#include "unit_tests/ResultCacheTest.cpp"
+#include "unit_tests/EvaluationServiceTest.cpp"
+#include "unit_tests/StreamEvaluatorTest.cpp"
+#include "unit_tests/ConfigurationSourceTest.cpp"
+#include "unit_tests/DramSpecLibraryTest.cpp"
+#include "unit_tests/DramSpecCInterfaceTest.cpp"
+#include "unit_tests/TechnologyLibraryTest.cpp"
+#include "unit_tests/ParetoExplorerTest.cpp"
+#include "unit_tests/BatchEvaluatorTest.cpp"
+#include "unit_tests/Nsga2Test.cpp"
+#include "unit_tests/GoalSeekerTest.cpp"
+#include "unit_tests/FloorplanOptimizerTest.cpp"
+#include "unit_tests/SubarraySizerTest.cpp"
+#include "unit_tests/SensitivityAnalyzerTest.cpp"
+#include "unit_tests/ToleranceAnalyzerTest.cpp"
+#include "unit_tests/StreamingStatisticsTest.cpp"
+#include "unit_tests/MonteCarloSimulatorTest.cpp"
+#include "unit_tests/SobolAnalyzerTest.cpp"
+#include "unit_tests/DesignSamplerTest.cpp"
@@ -71,11 +71,56 @@ BOOST_AUTO_TEST_CASE( checkInputParametersParser_wrong_first_flag )
               "(Specify which technology description file should be used.)\n"
             "    -p    <path/to/architecturefile.json> "
               "(Specify which architecture description file should be used.)\n"
+            "    (Instead of file names: @<list file>, <directory> or \"<pattern>\".)\n"
             "  Optional:\n"
+            "    -cross                                "
+              "(Run every technology file with every architecture file.)\n"
+            "    -floorplan                            "
+              "(Best bank and tile placements of each configuration into results_floorplan.csv.)\n"
+            "    -sensitivity                          "
+              "(Derivatives of the results by the technology parameters into results_sensitivity.csv.)\n"
+            "    -manifest <file>                      "
+              "(Run the configurations listed in a manifest instead of -t and -p.)\n"
+            "    -techlib <library file>               "
+              "(Look up the -t technologies by name in a compiled technology library.)\n"
             "    -term                                 "
               "(Include IO termination currents for read and write operations.)\n"
             "    -internaltimings                      "
               "(Enable print out of internal timings.)\n"
+            "    -D <parameter>=<value>                "
+              "(Override an input parameter, e.g. -D Temperature[C]=45.)\n"
+            "    -stats                                "
+              "(Print out run statistics.)\n"
+            "    -shard i/n                            "
+              "(Only run the configurations of shard i out of n, i = 0..n-1.)\n"
+            "    -merge <shard result files>           "
+              "(Merge the result tables of a sharded run into results_merged.csv.)\n"
+            "    -resume                               "
+              "(Checkpoint the run, skipping the configurations completed by an interrupted run.)\n"
+            "    -cache <directory>                    "
+              "(Reuse results stored in (and store new results to) a cache directory.)\n"
+            "    -serve <socket path>                  "
+              "(Serve evaluation requests (NDJSON) on a Unix socket.)\n"
+            "    -stream                               "
+              "(Evaluate requests (NDJSON) from stdin, results to stdout.)\n"
+            "    -jobs <number>                        "
+              "(Number of parallel evaluations, e.g. of -stream, -explore or -montecarlo.)\n"
+            "    -explore <specification file>         "
+              "(Pareto front of a grid or NSGA-II search into results_pareto.csv.)\n"
+            "    -solve <specification file>           "
+              "(Solve for input parameters meeting constraints into results_goals.csv.)\n"
+            "    -subarray <specification file>        "
+              "(Smallest subarray sizes within a timing budget into results_subarray.csv.)\n"
+            "    -tolerance <specification file>       "
+              "(Bounds of the results over tolerances of inputs into results_tolerance.csv.)\n"
+            "    -montecarlo <specification file>      "
+              "(Distributions of the results under random variation into results_montecarlo.csv.)\n"
+            "    -sobol <specification file>           "
+              "(Sobol sensitivity indices over parameter ranges into results_sobol.csv.)\n"
+            "    -sample <specification file>          "
+              "(Sobol, Latin hypercube or stratified points over parameter ranges into results_sample.csv.)\n"
+            "    -compiletech <library file>           "
+              "(Compile the -t technology files into a technology library.)\n"
             "For more information, see README.md.\n";
 
     string expectedMsg("[ERROR] ");
@@ -113,11 +158,56 @@ BOOST_AUTO_TEST_CASE( checkInputParametersParser_wrong_second_flag1 )
               "(Specify which technology description file should be used.)\n"
             "    -p    <path/to/architecturefile.json> "
               "(Specify which architecture description file should be used.)\n"
+            "    (Instead of file names: @<list file>, <directory> or \"<pattern>\".)\n"
             "  Optional:\n"
+            "    -cross                                "
+              "(Run every technology file with every architecture file.)\n"
+            "    -floorplan                            "
+              "(Best bank and tile placements of each configuration into results_floorplan.csv.)\n"
+            "    -sensitivity                          "
+              "(Derivatives of the results by the technology parameters into results_sensitivity.csv.)\n"
+            "    -manifest <file>                      "
+              "(Run the configurations listed in a manifest instead of -t and -p.)\n"
+            "    -techlib <library file>               "
+              "(Look up the -t technologies by name in a compiled technology library.)\n"
             "    -term                                 "
               "(Include IO termination currents for read and write operations.)\n"
             "    -internaltimings                      "
               "(Enable print out of internal timings.)\n"
+            "    -D <parameter>=<value>                "
+              "(Override an input parameter, e.g. -D Temperature[C]=45.)\n"
+            "    -stats                                "
+              "(Print out run statistics.)\n"
+            "    -shard i/n                            "
+              "(Only run the configurations of shard i out of n, i = 0..n-1.)\n"
+            "    -merge <shard result files>           "
+              "(Merge the result tables of a sharded run into results_merged.csv.)\n"
+            "    -resume                               "
+              "(Checkpoint the run, skipping the configurations completed by an interrupted run.)\n"
+            "    -cache <directory>                    "
+              "(Reuse results stored in (and store new results to) a cache directory.)\n"
+            "    -serve <socket path>                  "
+              "(Serve evaluation requests (NDJSON) on a Unix socket.)\n"
+            "    -stream                               "
+              "(Evaluate requests (NDJSON) from stdin, results to stdout.)\n"
+            "    -jobs <number>                        "
+              "(Number of parallel evaluations, e.g. of -stream, -explore or -montecarlo.)\n"
+            "    -explore <specification file>         "
+              "(Pareto front of a grid or NSGA-II search into results_pareto.csv.)\n"
+            "    -solve <specification file>           "
+              "(Solve for input parameters meeting constraints into results_goals.csv.)\n"
+            "    -subarray <specification file>        "
+              "(Smallest subarray sizes within a timing budget into results_subarray.csv.)\n"
+            "    -tolerance <specification file>       "
+              "(Bounds of the results over tolerances of inputs into results_tolerance.csv.)\n"
+            "    -montecarlo <specification file>      "
+              "(Distributions of the results under random variation into results_montecarlo.csv.)\n"
+            "    -sobol <specification file>           "
+              "(Sobol sensitivity indices over parameter ranges into results_sobol.csv.)\n"
+            "    -sample <specification file>          "
+              "(Sobol, Latin hypercube or stratified points over parameter ranges into results_sample.csv.)\n"
+            "    -compiletech <library file>           "
+              "(Compile the -t technology files into a technology library.)\n"
             "For more information, see README.md.\n";
 
     string expectedMsg("[ERROR] ");
@@ -155,11 +245,56 @@ BOOST_AUTO_TEST_CASE( checkInputParametersParser_wrong_second_flag2 )
               "(Specify which technology description file should be used.)\n"
             "    -p    <path/to/architecturefile.json> "
               "(Specify which architecture description file should be used.)\n"
+            "    (Instead of file names: @<list file>, <directory> or \"<pattern>\".)\n"
             "  Optional:\n"
+            "    -cross                                "
+              "(Run every technology file with every architecture file.)\n"
+            "    -floorplan                            "
+              "(Best bank and tile placements of each configuration into results_floorplan.csv.)\n"
+            "    -sensitivity                          "
+              "(Derivatives of the results by the technology parameters into results_sensitivity.csv.)\n"
+            "    -manifest <file>                      "
+              "(Run the configurations listed in a manifest instead of -t and -p.)\n"
+            "    -techlib <library file>               "
+              "(Look up the -t technologies by name in a compiled technology library.)\n"
             "    -term                                 "
               "(Include IO termination currents for read and write operations.)\n"
             "    -internaltimings                      "
               "(Enable print out of internal timings.)\n"
+            "    -D <parameter>=<value>                "
+              "(Override an input parameter, e.g. -D Temperature[C]=45.)\n"
+            "    -stats                                "
+              "(Print out run statistics.)\n"
+            "    -shard i/n                            "
+              "(Only run the configurations of shard i out of n, i = 0..n-1.)\n"
+            "    -merge <shard result files>           "
+              "(Merge the result tables of a sharded run into results_merged.csv.)\n"
+            "    -resume                               "
+              "(Checkpoint the run, skipping the configurations completed by an interrupted run.)\n"
+            "    -cache <directory>                    "
+              "(Reuse results stored in (and store new results to) a cache directory.)\n"
+            "    -serve <socket path>                  "
+              "(Serve evaluation requests (NDJSON) on a Unix socket.)\n"
+            "    -stream                               "
+              "(Evaluate requests (NDJSON) from stdin, results to stdout.)\n"
+            "    -jobs <number>                        "
+              "(Number of parallel evaluations, e.g. of -stream, -explore or -montecarlo.)\n"
+            "    -explore <specification file>         "
+              "(Pareto front of a grid or NSGA-II search into results_pareto.csv.)\n"
+            "    -solve <specification file>           "
+              "(Solve for input parameters meeting constraints into results_goals.csv.)\n"
+            "    -subarray <specification file>        "
+              "(Smallest subarray sizes within a timing budget into results_subarray.csv.)\n"
+            "    -tolerance <specification file>       "
+              "(Bounds of the results over tolerances of inputs into results_tolerance.csv.)\n"
+            "    -montecarlo <specification file>      "
+              "(Distributions of the results under random variation into results_montecarlo.csv.)\n"
+            "    -sobol <specification file>           "
+              "(Sobol sensitivity indices over parameter ranges into results_sobol.csv.)\n"
+            "    -sample <specification file>          "
+              "(Sobol, Latin hypercube or stratified points over parameter ranges into results_sample.csv.)\n"
+            "    -compiletech <library file>           "
+              "(Compile the -t technology files into a technology library.)\n"
             "For more information, see README.md.\n";
 
     string expectedMsg("[ERROR] ");
@@ -603,6 +738,246 @@ BOOST_AUTO_TEST_CASE( checkInputParametersParser_flags_4 )
 }
 
 
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_shard )
+{
+    int sim_argc = 8;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-shard",
+                        "2/3",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-stats"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    std::string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE(inputFileName.shardIndex == 2
+                        && inputFileName.nShards == 3,
+                        "\nShard missmatch!"
+                        << "\nExpected: 2/3"
+                        << "\nGot:" << inputFileName.shardIndex
+                        << "/" << inputFileName.nShards);
+
+    BOOST_CHECK_MESSAGE(inputFileName.architectureFileName[0]
+                        == sim_argv[6],
+                        "\nArchitecture file name missmatch!"
+                        << "\nExpected: " << sim_argv[6]
+                        << "\nGot:" << inputFileName.architectureFileName[0]);
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_invalid_shard )
+{
+    int sim_argc = 7;
+    char* sim_argv[] = {"./executable",
+                        "-shard",
+                        "3/3", // Shard index must be smaller than the count
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("[ERROR] ");
+    expectedMsg.append("Flag -shard expects an argument i/n ");
+    expectedMsg.append("with 0 <= i < n, got \'3/3\'.\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_merge )
+{
+    int sim_argc = 5;
+    char* sim_argv[] = {"./executable",
+                        "-merge",
+                        "results_shard_0_of_2.csv",
+                        "results_shard_1_of_2.csv",
+                        "-stats"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    std::string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK_MESSAGE(inputFileName.mergeFileName.size() == 2,
+                        "\nNumber of shard files missmatch!"
+                        << "\nExpected: " << 2
+                        << "\nGot:" << inputFileName.mergeFileName.size());
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_stream )
+{
+    int sim_argc = 5;
+    char* sim_argv[] = {"./executable",
+                        "-stream",
+                        "-jobs",
+                        "4",
+                        "-term"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    std::string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK( inputFileName.streamRun );
+    BOOST_CHECK( inputFileName.IOTerminationCurrentFlag );
+    BOOST_CHECK_MESSAGE(inputFileName.nJobs == 4,
+                        "\nNumber of jobs missmatch!"
+                        << "\nExpected: " << 4
+                        << "\nGot:" << inputFileName.nJobs);
+
+    // A stream run gets its configurations from stdin only
+    int sim_argc_files = 4;
+    char* sim_argv_files[] = {"./executable",
+                              "-stream",
+                              "-t",
+                              "technology_input/test_technology.json"};
+    ArgumentsParser withFiles(sim_argc_files, sim_argv_files);
+    exceptionMsg = "Empty";
+    try {
+        withFiles.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    BOOST_CHECK( exceptionMsg.find("Flag -stream can not be combined")
+                 != string::npos );
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_cross )
+{
+    int sim_argc = 7;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-cross"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    std::string expectedMsg("Empty");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    BOOST_CHECK( inputFileName.crossRun );
+    BOOST_CHECK_MESSAGE(inputFileName.nConfigurations == 2,
+                        "\nNumber of configurations missmatch!"
+                        << "\nExpected: " << 2
+                        << "\nGot:" << inputFileName.nConfigurations);
+
+    // Both lists are needed for the product
+    int sim_argc_tech = 4;
+    char* sim_argv_tech[] = {"./executable",
+                             "-cross",
+                             "-t",
+                             "technology_input/test_technology.json"};
+    ArgumentsParser techOnly(sim_argc_tech, sim_argv_tech);
+    exceptionMsg = "Empty";
+    try {
+        techOnly.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    BOOST_CHECK( exceptionMsg.find("Flag -cross needs both technology")
+                 != string::npos );
+}
+
+BOOST_AUTO_TEST_CASE( checkInputParametersParser_floorplan )
+{
+    int sim_argc = 6;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-floorplan"};
+
+    ArgumentsParser inputFileName(sim_argc, sim_argv);
+
+    std::string exceptionMsg("Empty");
+    try {
+        inputFileName.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    BOOST_CHECK( exceptionMsg == "Empty" );
+    BOOST_CHECK( inputFileName.floorplanRun );
+    BOOST_CHECK( inputFileName.nConfigurations == 1 );
+
+    // Placements are not optimized for shards
+    int sim_argc_shard = 8;
+    char* sim_argv_shard[] = {"./executable",
+                              "-t",
+                              "technology_input/test_technology.json",
+                              "-p",
+                              "architecture_input/test_architecture.json",
+                              "-floorplan",
+                              "-shard",
+                              "0/2"};
+    ArgumentsParser sharded(sim_argc_shard, sim_argv_shard);
+    exceptionMsg = "Empty";
+    try {
+        sharded.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    BOOST_CHECK( exceptionMsg.find("Flag -floorplan can only be combined")
+                 != string::npos );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif // ARGUMENTSPARSERTEST_CPP
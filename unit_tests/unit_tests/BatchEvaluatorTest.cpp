@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+#ifndef BATCHEVALUATORTEST_CPP
+#define BATCHEVALUATORTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../parser/BatchEvaluator.h"
+#include "../../core/Current.h"
+
+BOOST_AUTO_TEST_SUITE( testBatchEvaluator )
+
+BOOST_AUTO_TEST_CASE( checkBatchEvaluator_positions )
+{
+    TechnologyValues baseInputs("technology_input/test_technology.json",
+                                "architecture_input/test_architecture.json");
+    const TechnologyField* pageSize =
+                                TechnologyValues::findField("PageSize[KB]");
+    const TechnologyField* tilesPerBank =
+                                TechnologyValues::findField("TilesPerBank[]");
+
+    // Every third configuration has 3 tiles per bank, which is invalid
+    vector<TechnologyValues> batch;
+    for ( unsigned int it = 0; it < 12; it++ ) {
+        TechnologyValues inputs(baseInputs);
+        pageSize->setNumber(inputs, 1 << (it % 3));
+        tilesPerBank->setNumber(inputs, it % 3 == 2 ? 3 : 4);
+        batch.push_back(inputs);
+    }
+
+    vector<DramResult> sequentialResults;
+    vector<string> sequentialErrors;
+    BatchEvaluator(1).evaluate(batch, false,
+                               sequentialResults, sequentialErrors);
+    vector<DramResult> parallelResults;
+    vector<string> parallelErrors;
+    BatchEvaluator parallel(4);
+    BOOST_CHECK( parallel.workers() == 4 );
+    parallel.evaluate(batch, false, parallelResults, parallelErrors);
+
+    BOOST_REQUIRE( parallelResults.size() == batch.size() );
+    BOOST_REQUIRE( parallelErrors.size() == batch.size() );
+    for ( unsigned int it = 0; it < batch.size(); it++ ) {
+        BOOST_CHECK( parallelErrors[it] == sequentialErrors[it] );
+        BOOST_CHECK( parallelErrors[it].empty() == ( it % 3 != 2 ) );
+        if ( !parallelErrors[it].empty() ) {
+            continue;
+        }
+        Current dram(batch[it], false);
+        DramResult expected;
+        expected.collect(dram);
+        for ( unsigned int value = 0; value < DramResult::N_VALUES; value++ ) {
+            BOOST_CHECK( parallelResults[it].values[value]
+                         == expected.values[value] );
+            BOOST_CHECK( sequentialResults[it].values[value]
+                         == expected.values[value] );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // BATCHEVALUATORTEST_CPP
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef CHECKPOINTJOURNALTEST_CPP
+#define CHECKPOINTJOURNALTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <sstream>
+
+#include "../../parser/CheckpointJournal.h"
+
+BOOST_AUTO_TEST_SUITE( testCheckpointJournal )
+
+BOOST_AUTO_TEST_CASE( checkCheckpointJournal_torn_last_line )
+{
+    istringstream journalFile("0,t0.json,p0.json\n"
+                              "2,t2.json,p2.json\n"
+                              "1,t1.js"); // Interrupted while writing
+
+    CheckpointJournal journal;
+    journal.load(journalFile);
+
+    BOOST_CHECK_MESSAGE( journal.nCompleted() == 2,
+                        "Wrong number of completed configurations."
+                        << "\nExpected: " << 2
+                        << "\nGot: " << journal.nCompleted());
+    BOOST_CHECK( journal.isCompleted(0, "t0.json", "p0.json") );
+    BOOST_CHECK( journal.isCompleted(2, "t2.json", "p2.json") );
+    BOOST_CHECK( !journal.isCompleted(1, "t1.json", "p1.json") );
+}
+
+BOOST_AUTO_TEST_CASE( checkCheckpointJournal_different_run )
+{
+    istringstream journalFile("0,t0.json,p0.json\n");
+
+    CheckpointJournal journal;
+    journal.load(journalFile);
+
+    std::string exceptionMsg("Empty");
+    try {
+        journal.isCompleted(0, "t0.json", "other.json");
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("[ERROR] ");
+    expectedMsg.append("Checkpoint journal does not match this run: ");
+    expectedMsg.append("configuration 0 was run with t0.json,p0.json.\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkCheckpointJournal_quoted_file_names )
+{
+    istringstream journalFile("0,\"t,0\nnext.json\",p0.json\n"
+                              "1,t1.json,\"p\"\"1\"\".json\"\n");
+
+    CheckpointJournal journal;
+    journal.load(journalFile);
+
+    BOOST_CHECK( journal.nCompleted() == 2 );
+    BOOST_CHECK( journal.isCompleted(0, "t,0\nnext.json", "p0.json") );
+    BOOST_CHECK( journal.isCompleted(1, "t1.json", "p\"1\".json") );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // CHECKPOINTJOURNALTEST_CPP
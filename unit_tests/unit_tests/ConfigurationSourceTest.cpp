@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef CONFIGURATIONSOURCETEST_CPP
+#define CONFIGURATIONSOURCETEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <cstdio>
+#include <fstream>
+
+#include "../../parser/ConfigurationSource.h"
+
+BOOST_AUTO_TEST_SUITE( testConfigurationSource )
+
+BOOST_AUTO_TEST_CASE( checkConfigurationSource_lists )
+{
+    ofstream responseFile("test_architectures.list");
+    responseFile << "# Architectures\n"
+                 << "architecture_input/test_architecture.json\n"
+                 << "\n"
+                 << "  architecture_input/test_architecture.json  # again\n";
+    responseFile.close();
+
+    int sim_argc = 7;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "technology_input/test_tech*.json",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "@test_architectures.list"};
+    ArgumentsParser arg(sim_argc, sim_argv);
+    arg.runArgParser();
+    BOOST_CHECK( arg.hasExpandableFileNames );
+
+    ConfigurationSource source(arg);
+    Configuration configuration;
+    BOOST_REQUIRE( source.next(configuration) );
+    BOOST_CHECK( configuration.configID == 0 );
+    BOOST_REQUIRE( source.next(configuration) );
+    BOOST_CHECK( configuration.configID == 1 );
+    BOOST_CHECK( configuration.technologyFileName
+                 == "technology_input/test_technology.json" );
+    BOOST_CHECK( configuration.architectureFileName
+                 == "architecture_input/test_architecture.json" );
+
+    // The technology list is longer than the architecture list
+    string exceptionMsg("Empty");
+    try {
+        source.next(configuration);
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("[ERROR] Number of technology files is different "
+                       "from the number of archtecture files, the "
+                       "architecture list ends after 2 files.\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    remove("test_architectures.list");
+}
+
+BOOST_AUTO_TEST_CASE( checkConfigurationSource_cross )
+{
+    ofstream responseFile("test_architectures.list");
+    responseFile << "architecture_input/test_architecture.json\n"
+                 << "architecture_input/test_architecture.json\n";
+    responseFile.close();
+
+    int sim_argc = 7;
+    char* sim_argv[] = {"./executable",
+                        "-cross",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "technology_input/test_tech*.json",
+                        "-p",
+                        "@test_architectures.list"};
+    ArgumentsParser arg(sim_argc, sim_argv);
+    arg.runArgParser();
+    BOOST_CHECK( arg.crossRun );
+
+    // Technology-major, the architecture list is read for every technology
+    ConfigurationSource source(arg);
+    Configuration configuration;
+    for ( unsigned int configID = 0; configID < 4; configID++ ) {
+        BOOST_REQUIRE( source.next(configuration) );
+        BOOST_CHECK( configuration.configID == configID );
+        BOOST_CHECK( configuration.architectureFileName
+                     == "architecture_input/test_architecture.json" );
+        if ( configID < 2 ) {
+            BOOST_CHECK( configuration.technologyFileName
+                         == "technology_input/test_technology.json" );
+        }
+    }
+    BOOST_CHECK( !source.next(configuration) );
+    BOOST_CHECK( source.nConfigurations() == 4 );
+
+    remove("test_architectures.list");
+}
+
+BOOST_AUTO_TEST_CASE( checkConfigurationSource_manifest )
+{
+    ofstream manifestFile("test_manifest.txt");
+    manifestFile << "technology_input/test_technology.json "
+                 << "architecture_input/test_architecture.json 7\n"
+                 << "technology_input/test_technology.json "
+                 << "architecture_input/test_architecture.json 1\n"
+                 << "technology_input/test_technology.json "
+                 << "architecture_input/test_architecture.json 7\n";
+    manifestFile.close();
+
+    int sim_argc = 3;
+    char* sim_argv[] = {"./executable",
+                        "-manifest",
+                        "test_manifest.txt"};
+    ArgumentsParser arg(sim_argc, sim_argv);
+    arg.runArgParser();
+
+    ConfigurationSource source(arg);
+    Configuration configuration;
+    BOOST_REQUIRE( source.next(configuration) );
+    BOOST_CHECK_MESSAGE( configuration.configID == 7,
+                        "Configuration number of the manifest not used."
+                        << "\nExpected: " << 7
+                        << "\nGot: " << configuration.configID);
+    BOOST_REQUIRE( source.next(configuration) );
+    BOOST_CHECK( configuration.configID == 1 );
+
+    // Number used twice
+    string exceptionMsg("Empty");
+    try {
+        source.next(configuration);
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    BOOST_CHECK( exceptionMsg.find("Line 3 of manifest") != string::npos );
+
+    remove("test_manifest.txt");
+}
+
+BOOST_AUTO_TEST_CASE( checkConfigurationSource_manifest_numbering )
+{
+    // The default of line 2 would be 1, the number given on line 3
+    ofstream manifestFile("test_manifest.txt");
+    manifestFile << "technology_input/test_technology.json "
+                 << "architecture_input/test_architecture.json\n"
+                 << "technology_input/test_technology.json "
+                 << "architecture_input/test_architecture.json\n"
+                 << "technology_input/test_technology.json "
+                 << "architecture_input/test_architecture.json 1\n";
+    manifestFile.close();
+
+    int sim_argc = 3;
+    char* sim_argv[] = {"./executable",
+                        "-manifest",
+                        "test_manifest.txt"};
+    ArgumentsParser arg(sim_argc, sim_argv);
+    arg.runArgParser();
+
+    ConfigurationSource source(arg);
+    Configuration configuration;
+    BOOST_REQUIRE( source.next(configuration) );
+    BOOST_CHECK( configuration.configID == 0 );
+    BOOST_REQUIRE( source.next(configuration) );
+    BOOST_CHECK( configuration.configID == 1 );
+
+    string exceptionMsg("Empty");
+    try {
+        source.next(configuration);
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    BOOST_CHECK_MESSAGE( exceptionMsg.find("Line 3 of manifest")
+                         != string::npos
+                         && exceptionMsg.find("gives a configuration number")
+                            != string::npos,
+                        "Manifest mixing numbered lines and lines without "
+                        "number accepted."
+                        << "\nGot: " << exceptionMsg);
+
+    remove("test_manifest.txt");
+}
+
+BOOST_AUTO_TEST_CASE( checkConfigurationSource_manifest_quoted )
+{
+    ofstream manifestFile("test_manifest.txt");
+    manifestFile << "\"technology input/test #1.json\" "
+                 << "\"architecture_input/\"\"x16\"\".json\" 4 # comment\n"
+                 << "\"technology_input/test_technology.json "
+                 << "architecture_input/test_architecture.json 5\n";
+    manifestFile.close();
+
+    int sim_argc = 3;
+    char* sim_argv[] = {"./executable",
+                        "-manifest",
+                        "test_manifest.txt"};
+    ArgumentsParser arg(sim_argc, sim_argv);
+    arg.runArgParser();
+
+    ConfigurationSource source(arg);
+    Configuration configuration;
+    BOOST_REQUIRE( source.next(configuration) );
+    BOOST_CHECK_MESSAGE( configuration.technologyFileName
+                         == "technology input/test #1.json",
+                        "Quoted technology file name not read."
+                        << "\nExpected: technology input/test #1.json"
+                        << "\nGot: " << configuration.technologyFileName);
+    BOOST_CHECK_MESSAGE( configuration.architectureFileName
+                         == "architecture_input/\"x16\".json",
+                        "Doubled quote not read as one."
+                        << "\nExpected: architecture_input/\"x16\".json"
+                        << "\nGot: " << configuration.architectureFileName);
+    BOOST_CHECK( configuration.configID == 4 );
+
+    // Quote not closed
+    string exceptionMsg("Empty");
+    try {
+        source.next(configuration);
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    BOOST_CHECK_MESSAGE( exceptionMsg.find("Line 2 of manifest")
+                         != string::npos,
+                        "Unclosed quote accepted."
+                        << "\nGot: " << exceptionMsg);
+
+    remove("test_manifest.txt");
+}
+
+BOOST_AUTO_TEST_CASE( checkConfigurationSource_manifest_bad_lines )
+{
+    ofstream manifestFile("test_manifest.txt");
+    manifestFile << "technology_input/test_technology.json "
+                 << "architecture_input/test_architecture.json 2\n"
+                 << "technology_input/test_technology.json "
+                 << "architecture_input/test_architecture.json 0\n"
+                 << "technology_input/test_technology.json "
+                 << "architecture_input/test_architecture.json 1\n"
+                 << "technology_input/test_technology.json "
+                 << "architecture_input/test_architecture.json 1\n"
+                 << "technology_input/test_technology.json\n";
+    manifestFile.close();
+
+    int sim_argc = 3;
+    char* sim_argv[] = {"./executable",
+                        "-manifest",
+                        "test_manifest.txt"};
+    ArgumentsParser arg(sim_argc, sim_argv);
+    arg.runArgParser();
+
+    ConfigurationSource source(arg);
+    Configuration configuration;
+    BOOST_REQUIRE( source.next(configuration) );
+    BOOST_REQUIRE( source.next(configuration) );
+    BOOST_REQUIRE( source.next(configuration) );
+    BOOST_CHECK( configuration.configID == 1 );
+
+    // Number used twice, between numbers used before
+    string exceptionMsg("Empty");
+    try {
+        source.next(configuration);
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    BOOST_CHECK_MESSAGE( exceptionMsg.find("Line 4 of manifest")
+                         != string::npos,
+                        "Repeated configuration number not detected."
+                        << "\nGot: " << exceptionMsg);
+
+    // Technology file only, the previous architecture must not be kept
+    exceptionMsg = "Empty";
+    try {
+        source.next(configuration);
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    BOOST_CHECK_MESSAGE( exceptionMsg.find("Line 5 of manifest")
+                         != string::npos,
+                        "Line without architecture file accepted."
+                        << "\nGot: " << exceptionMsg);
+
+    remove("test_manifest.txt");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // CONFIGURATIONSOURCETEST_CPP
@@ -127,6 +127,15 @@ BOOST_AUTO_TEST_CASE( checkCurrent_real_input )
                       << "\nExpected around: " << _mag*drs::milliamperes
                       << "\nGot: " << current.IDD3nOneACTBank);
 
+  // Rho as the model has always computed it, bit for bit (results and
+  //  cached results are kept at round-trip precision)
+  _mag = current.fullySharedResourcesCurrent.value()
+         / (current.IDD3n - current.IDD2n).value();
+  BOOST_CHECK_MESSAGE( current.rho == _mag,
+                      "Rho different from the expected."
+                      << "\nExpected: " << _mag
+                      << "\nGot: " << current.rho);
+
   _mag = 0;
   BOOST_CHECK_MESSAGE( ROUND_UP(current.IPP3nOneACTBank, 3)
                        == _mag*drs::milliamperes,
@@ -402,6 +411,49 @@ BOOST_AUTO_TEST_CASE( checkCurrent_real_input )
 
 }
 
+BOOST_AUTO_TEST_CASE( checkCurrent_evaluate_in_place )
+{
+  TechnologyValues inputs("technology_input/test_technology.json",
+                          "architecture_input/test_architecture.json");
+  Current expected(inputs, true);
+
+  // Evaluated in place after an evaluation of other inputs
+  Current current;
+  TechnologyValues& currentInputs = current;
+  currentInputs = inputs;
+  currentInputs.vdd = 1.3*si::volt;
+  BOOST_CHECK( current.inputError(true) == NO_MODEL_ERROR );
+  current.evaluate(true);
+  currentInputs = inputs;
+  current.evaluate(true);
+
+  BOOST_CHECK_MESSAGE( current.IDD0 == expected.IDD0,
+                      "IDD0 evaluated in place different from the expected."
+                      << "\nExpected: " << expected.IDD0
+                      << "\nGot: " << current.IDD0);
+  BOOST_CHECK( current.trcd == expected.trcd );
+  BOOST_CHECK( current.IDD4R == expected.IDD4R );
+
+  // The error found without evaluating is the one thrown by the evaluation
+  currentInputs.nTilesPerBank = 3;
+  ModelError error = current.inputError(true);
+  BOOST_CHECK( error == TILES_PER_BANK_ERROR );
+  string exceptionMsg("Empty");
+  try {
+      current.evaluate(true);
+  }catch (string exceptionMsgThrown){
+      exceptionMsg = exceptionMsgThrown;
+  }
+  BOOST_CHECK_MESSAGE( exceptionMsg == modelErrorMessage(error),
+                      "Error message different from the expected."
+                      << "\nExpected: " << modelErrorMessage(error)
+                      << "\nGot: " << exceptionMsg);
+
+  currentInputs = inputs;
+  currentInputs.temperature = 100*bu::celsius::degrees;
+  BOOST_CHECK( current.inputError(false) == TEMPERATURE_RANGE_ERROR );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif // CURRENTTEST_CPP
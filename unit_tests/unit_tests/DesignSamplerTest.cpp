@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+#ifndef DESIGNSAMPLERTEST_CPP
+#define DESIGNSAMPLERTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <set>
+
+#include "../../parser/DesignSampler.h"
+
+BOOST_AUTO_TEST_SUITE( testDesignSampler )
+
+// Whether each of n equal strata of every coordinate holds one point
+static bool
+isLatin(const vector<vector<double> >& points, unsigned int n)
+{
+    for ( unsigned int it = 0; it < points[0].size(); it++ ) {
+        set<unsigned int> strata;
+        for ( unsigned int pointID = 0; pointID < points.size(); pointID++ ) {
+            strata.insert(points[pointID][it] * n);
+        }
+        if ( strata.size() != n || *strata.rbegin() != n - 1 ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void
+setUpSampler(DesignSampler& sampler)
+{
+    sampler.baseInputs = TechnologyValues(
+                                "technology_input/test_technology.json",
+                                "architecture_input/test_architecture.json");
+    sampler.addRange("CellWidth[um]", 0.09, 0.11);
+    sampler.addRange("Temperature[C]", 25, 80);
+    sampler.addRange("CellsPerSubarrayColumn[]", 256, 1024);
+}
+
+BOOST_AUTO_TEST_CASE( checkDesignSampler_sequences )
+{
+    // Start of the Sobol sequence in its first two dimensions
+    const double first[] = { 0, 0.5, 0.25, 0.75 };
+    const double second[] = { 0, 0.5, 0.75, 0.25 };
+    for ( unsigned int it = 0; it < 4; it++ ) {
+        BOOST_CHECK_EQUAL( DesignSampler::sobolCoordinate(it, 0), first[it] );
+        BOOST_CHECK_EQUAL( DesignSampler::sobolCoordinate(it, 1), second[it] );
+    }
+
+    // Permutations of any length
+    const uint32_t lengths[] = { 1, 2, 7, 1000, 4096 };
+    for ( unsigned int it = 0; it < 5; it++ ) {
+        set<uint32_t> permuted;
+        for ( uint32_t index = 0; index < lengths[it]; index++ ) {
+            permuted.insert(DesignSampler::permute(index, lengths[it], 12345));
+        }
+        BOOST_CHECK_EQUAL( permuted.size(), lengths[it] );
+        BOOST_CHECK( *permuted.rbegin() < lengths[it] );
+    }
+
+    DesignSampler sampler(false, 1);
+    setUpSampler(sampler);
+    vector<vector<double> > points(64);
+
+    // The first 2^m Sobol points are Latin in every dimension
+    for ( unsigned int pointID = 0; pointID < 64; pointID++ ) {
+        sampler.unitPoint(pointID, points[pointID]);
+    }
+    BOOST_CHECK( isLatin(points, 64) );
+
+    // A Latin hypercube of any number of points
+    sampler.method = DesignSampler::LATIN_HYPERCUBE;
+    sampler.nSamples = 50;
+    points.resize(50);
+    for ( unsigned int pointID = 0; pointID < 50; pointID++ ) {
+        sampler.unitPoint(pointID, points[pointID]);
+    }
+    BOOST_CHECK( isLatin(points, 50) );
+
+    // 3 strata per parameter for 27 to 63 points, every cell with one
+    //  point in each round
+    sampler.method = DesignSampler::STRATIFIED;
+    sampler.nSamples = 60;
+    set<vector<unsigned int> > cells;
+    for ( unsigned int pointID = 0; pointID < 54; pointID++ ) {
+        vector<double> coordinates;
+        sampler.unitPoint(pointID, coordinates);
+        vector<unsigned int> cell;
+        for ( unsigned int it = 0; it < coordinates.size(); it++ ) {
+            cell.push_back(coordinates[it] * 3);
+        }
+        cells.insert(cell);
+        if ( pointID == 26 ) {
+            BOOST_CHECK_EQUAL( cells.size(), 27 );
+            cells.clear();
+        }
+    }
+    BOOST_CHECK_EQUAL( cells.size(), 27 );
+}
+
+BOOST_AUTO_TEST_CASE( checkDesignSampler_constraints )
+{
+    DesignSampler sampler(false, 1);
+    sampler.baseInputs = TechnologyValues(
+                                "technology_input/test_technology.json",
+                                "architecture_input/test_architecture.json");
+    sampler.addRange("TilesPerBank[]", 1, 8);
+    sampler.addRange("PageSpanningFactor[]", 0.1, 1);
+    sampler.addRange("NumberOfBanksPerChannel[]", 3, 16);
+    sampler.addRange("NumberOfVerticalBanksPerChannel[]", 1, 16);
+    sampler.addRange("CellsPerSubarrayRow[]", 255.5, 1024);
+
+    const vector<SampledParameter>& parameters = sampler.parameters();
+    BOOST_CHECK( parameters[0].values == vector<double>({ 1, 2, 4 }) );
+    BOOST_CHECK( parameters[1].values == vector<double>({ 0.25, 0.5, 1 }) );
+    BOOST_CHECK( parameters[2].values == vector<double>({ 4, 8, 16 }) );
+    BOOST_CHECK( parameters[4].isRange && parameters[4].isInteger );
+    BOOST_CHECK_EQUAL( parameters[4].minimum, 256 );
+
+    const DesignSampler::Method methods[] = {
+        DesignSampler::SOBOL, DesignSampler::LATIN_HYPERCUBE,
+        DesignSampler::STRATIFIED
+    };
+    sampler.nSamples = 200;
+    for ( unsigned int methodID = 0; methodID < 3; methodID++ ) {
+        sampler.method = methods[methodID];
+        set<double> pageSpanningFactors;
+        for ( unsigned long pointID = 0; pointID < sampler.nSamples;
+              pointID++ ) {
+            TechnologyValues inputs;
+            string rejectionMessage;
+            BOOST_REQUIRE( sampler.point(pointID, inputs, rejectionMessage) );
+            BOOST_CHECK( inputs.pageSpanningFactor * inputs.nTilesPerBank
+                         >= 1 );
+            BOOST_CHECK( inputs.nVerticalBanks <= inputs.nBanks );
+            BOOST_CHECK( inputs.nHorizontalBanks == INVALID_VALUE );
+            BOOST_CHECK( inputs.cellsPerLWL == floor(inputs.cellsPerLWL) );
+            pageSpanningFactors.insert(inputs.pageSpanningFactor);
+        }
+        BOOST_CHECK_EQUAL( pageSpanningFactors.size(), 3 );
+    }
+
+    // No page spanning factor of 0.25 with less than 4 tiles
+    DesignSampler tooFewTiles(false, 1);
+    tooFewTiles.baseInputs = sampler.baseInputs;
+    tooFewTiles.addValues("TilesPerBank[]", { 1, 2 });
+    tooFewTiles.addValues("PageSpanningFactor[]", { 0.25 });
+    TechnologyValues inputs;
+    string rejectionMessage;
+    BOOST_CHECK( !tooFewTiles.point(0, inputs, rejectionMessage) );
+    BOOST_CHECK_EQUAL( rejectionMessage,
+                       "[ERROR] No value of \"PageSpanningFactor[]\" fits the "
+                       "other parameters of the point.\n" );
+
+    string exceptionMsg("Empty");
+    try {
+        tooFewTiles.addValues("NumberOfBanksPerChannel[]", { 8, 12 });
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("[ERROR] Value 12 of \"NumberOfBanksPerChannel[]\" "
+                       "is not allowed by the model.\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkDesignSampler_counts )
+{
+    // Counts are the ones of the field registry
+    DesignSampler sampler(false, 1);
+    sampler.baseInputs = TechnologyValues(
+                                "technology_input/test_technology.json",
+                                "architecture_input/test_architecture.json");
+    sampler.addRange("SubarrayToPageFactor[]", 1.5, 16);
+    sampler.addRange("Interface[bit]", 8, 64);
+    BOOST_CHECK( sampler.parameters()[0].isInteger );
+    BOOST_CHECK_EQUAL( sampler.parameters()[0].minimum, 2 );
+    BOOST_CHECK( sampler.parameters()[1].isInteger );
+
+    sampler.nSamples = 100;
+    for ( unsigned long pointID = 0; pointID < sampler.nSamples;
+          pointID++ ) {
+        TechnologyValues inputs;
+        string rejectionMessage;
+        BOOST_REQUIRE( sampler.point(pointID, inputs, rejectionMessage) );
+        BOOST_CHECK( isInteger(inputs.subArrayToPageFactor) );
+        BOOST_CHECK( isInteger(inputs.interface.value()) );
+    }
+
+    string exceptionMsg("Empty");
+    try {
+        sampler.addValues("RefreshMode[]", { 1, 2.5 });
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("[ERROR] Value 2.5 of \"RefreshMode[]\" "
+                       "is not allowed by the model.\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkDesignSampler_sample )
+{
+    ofstream specificationFile("test_sample.json");
+    specificationFile
+        << "{ \"technology\": \"technology_input/test_technology.json\",\n"
+        << "  \"architecture\": \"architecture_input/test_architecture.json\",\n"
+        << "  \"method\": \"latin\",\n"
+        << "  \"samples\": 1500,\n"
+        << "  \"seed\": 7,\n"
+        << "  \"parameters\": {\n"
+        << "    \"CellWidth[um]\": { \"minimum\": 0.09, \"maximum\": 0.11 },\n"
+        << "    \"TilesPerBank[]\": [1, 2, 4],\n"
+        << "    \"Temperature[C]\": { \"minimum\": 25, \"maximum\": 80 } } }\n";
+    specificationFile.close();
+
+    DesignSampler sampler(false, 1);
+    sampler.readSpecification("test_sample.json");
+    BOOST_CHECK( sampler.method == DesignSampler::LATIN_HYPERCUBE );
+    BOOST_CHECK_EQUAL( sampler.nSamples, 1500 );
+    BOOST_CHECK_EQUAL( sampler.seed, 7 );
+
+    // Same rows whichever thread evaluates a point, one per valid point
+    DesignSampler threeJobs(false, 3);
+    threeJobs.readSpecification("test_sample.json");
+    ostringstream points;
+    ostringstream threeJobsPoints;
+    sampler.sample(points);
+    threeJobs.sample(threeJobsPoints);
+    BOOST_CHECK( points.str() == threeJobsPoints.str() );
+    BOOST_CHECK_EQUAL( threeJobs.nRejected, sampler.nRejected );
+
+    string table(points.str());
+    unsigned long nRows = count(table.begin(), table.end(), '\n') - 1;
+    BOOST_CHECK_EQUAL( nRows + sampler.nRejected, 1500 );
+    BOOST_CHECK_EQUAL( table.find("Point,CellWidth[um],TilesPerBank[],"
+                                  "Temperature[C],"), 0 );
+    remove("test_sample.json");
+
+    DesignSampler tooMany(false, 1);
+    tooMany.baseInputs = sampler.baseInputs;
+    const vector<TechnologyField>& registry = TechnologyValues::fieldRegistry();
+    for ( unsigned int it = 0; tooMany.parameters().size() < 22; it++ ) {
+        if ( !registry[it].isString
+             && string(registry[it].name) != "TilesPerBank[]"
+             && string(registry[it].name) != "PageSpanningFactor[]"
+             && string(registry[it].name).find("Banks") == string::npos ) {
+            tooMany.addRange(registry[it].name, 1, 2);
+        }
+    }
+    string exceptionMsg("Empty");
+    try {
+        ostringstream ignoredPoints;
+        tooMany.sample(ignoredPoints);
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("[ERROR] Sobol points have at most 21 parameters.\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // DESIGNSAMPLERTEST_CPP
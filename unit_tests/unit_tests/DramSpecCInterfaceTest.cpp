@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef DRAMSPECCINTERFACETEST_CPP
+#define DRAMSPECCINTERFACETEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <cmath>
+#include <cstring>
+
+#include "../../library/dramspec.h"
+#include "../../library/DramSpecLibrary.h"
+
+BOOST_AUTO_TEST_SUITE( testDramSpecCInterface )
+
+BOOST_AUTO_TEST_CASE( checkDramSpecCInterface_evaluate_batch )
+{
+    dramspec_context* context = dramspec_create();
+    BOOST_REQUIRE( context != NULL );
+
+    double doubles[3*DRAMSPEC_N_DOUBLES];
+    uint32_t clockCounts[3*DRAMSPEC_N_CLOCK_COUNTS];
+    dramspec_status pointStatus[3];
+
+    BOOST_CHECK( dramspec_evaluate_batch(context, 1, 0, NULL, NULL,
+                                         doubles, clockCounts, NULL)
+                 == DRAMSPEC_ERROR_NOT_LOADED );
+
+    BOOST_REQUIRE( dramspec_load_technology_file(context,
+                       "technology_input/test_technology.json") == DRAMSPEC_OK );
+    BOOST_REQUIRE( dramspec_load_architecture_file(context,
+                       "architecture_input/test_architecture.json") == DRAMSPEC_OK );
+
+    // The second point changes Vdd, the third one is not valid
+    const char* parameterNames[] = {"Vdd[V]", "TilesPerBank[]"};
+    double parameterValues[] = {1.1, 2,
+                                1.2, 2,
+                                1.1, 3};
+    dramspec_status status = dramspec_evaluate_batch(context, 3, 2,
+                                 parameterNames, parameterValues,
+                                 doubles, clockCounts, pointStatus);
+
+    BOOST_CHECK( pointStatus[0] == DRAMSPEC_OK );
+    BOOST_CHECK( pointStatus[1] == DRAMSPEC_OK );
+    BOOST_CHECK_MESSAGE( pointStatus[2] == DRAMSPEC_ERROR_MODEL,
+                        "Invalid point was not rejected."
+                        << "\nExpected: " << DRAMSPEC_ERROR_MODEL
+                        << "\nGot: " << pointStatus[2]);
+    BOOST_CHECK( status == pointStatus[2] );
+    BOOST_CHECK_MESSAGE( strcmp(dramspec_last_error(context),
+                    "[ERROR] Architecture must have 1, 2 or 4 tile per bank.")
+                         == 0,
+                        "Wrong error message."
+                        << "\nGot: " << dramspec_last_error(context));
+    BOOST_CHECK( std::isnan(doubles[2*DRAMSPEC_N_DOUBLES]) );
+
+    // Same results as the C++ interface
+    DramResult expected = DramSpecLibrary::evaluate(
+        TechnologyValues("technology_input/test_technology.json",
+                         "architecture_input/test_architecture.json"));
+    BOOST_CHECK( strcmp(dramspec_double_name(3), "tRCD[ns]") == 0 );
+    BOOST_CHECK_MESSAGE( doubles[3] == expected.values[DramResult::TRCD],
+                        "Wrong tRCD."
+                        << "\nExpected: " << expected.values[DramResult::TRCD]
+                        << "\nGot: " << doubles[3]);
+    BOOST_CHECK( strcmp(dramspec_clock_count_name(0), "tRCD[cc]") == 0 );
+    BOOST_CHECK( clockCounts[0] == expected.values[DramResult::TRCD_CLK] );
+    BOOST_CHECK( dramspec_double_name(DRAMSPEC_N_DOUBLES) == NULL );
+
+    // Vdd changes the currents of the second point
+    size_t idd0 = 0;
+    while ( strcmp(dramspec_double_name(idd0), "IDD0[mA]") != 0 ) {
+        idd0++;
+    }
+    BOOST_CHECK( doubles[DRAMSPEC_N_DOUBLES + idd0] != doubles[idd0] );
+
+    const char* unknownNames[] = {"Vxx[V]"};
+    BOOST_CHECK( dramspec_evaluate_batch(context, 1, 1, unknownNames,
+                                         parameterValues, doubles,
+                                         clockCounts, NULL)
+                 == DRAMSPEC_ERROR_INVALID_ARGUMENT );
+
+    // Values are checked as -D overrides are
+    const char* countNames[] = {"Prefetch[]"};
+    double fractionalCount[] = {2.5};
+    BOOST_CHECK( dramspec_evaluate_batch(context, 1, 1, countNames,
+                                         fractionalCount, doubles,
+                                         clockCounts, pointStatus)
+                 == DRAMSPEC_ERROR_INVALID_ARGUMENT );
+    BOOST_CHECK_MESSAGE( strcmp(dramspec_last_error(context),
+                    "[ERROR] Input parameter \"Prefetch[]\" expects a whole "
+                    "number, got 2.5.") == 0,
+                        "Wrong error message."
+                        << "\nGot: " << dramspec_last_error(context));
+    BOOST_CHECK( clockCounts[0] == 0 );
+
+    BOOST_CHECK( dramspec_parse_technology(context, "{ not json")
+                 == DRAMSPEC_ERROR_INPUT );
+
+    dramspec_destroy(context);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // DRAMSPECCINTERFACETEST_CPP
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef DRAMSPECLIBRARYTEST_CPP
+#define DRAMSPECLIBRARYTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "../../library/DramSpecLibrary.h"
+
+BOOST_AUTO_TEST_SUITE( testDramSpecLibrary )
+
+static string readWholeFile(const string& fileName)
+{
+    ifstream file(fileName);
+    stringstream text;
+    text << file.rdbuf();
+    return text.str();
+}
+
+BOOST_AUTO_TEST_CASE( checkDramSpecLibrary_evaluate )
+{
+    string technology = readWholeFile("technology_input/test_technology.json");
+    string architecture = readWholeFile("architecture_input/test_architecture.json");
+
+    Current dram(TechnologyValues("technology_input/test_technology.json",
+                                  "architecture_input/test_architecture.json"),
+                 false);
+    DramResult expected;
+    expected.collect(dram);
+
+    DramResult result = DramSpecLibrary::evaluate(technology, architecture);
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        BOOST_CHECK_MESSAGE( result.values[valueID] == expected.values[valueID],
+                            "Wrong value of " << DramResult::names[valueID]
+                            << "\nExpected: " << expected.values[valueID]
+                            << "\nGot: " << result.values[valueID]);
+    }
+    BOOST_CHECK( result.warning == expected.warning );
+
+    // Concurrent evaluations give the same results
+    vector<DramResult> results(4);
+    vector<thread> threads;
+    for ( size_t it = 0; it < results.size(); it++ ) {
+        threads.push_back(thread([&, it]() {
+            results[it] = DramSpecLibrary::evaluate(technology, architecture);
+        }));
+    }
+    for ( size_t it = 0; it < threads.size(); it++ ) {
+        threads[it].join();
+        BOOST_CHECK( results[it].values[DramResult::IDD0]
+                     == expected.values[DramResult::IDD0] );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( checkDramSpecLibrary_errors )
+{
+    string architecture = readWholeFile("architecture_input/test_architecture.json");
+
+    string exceptionMsgExpected("[ERROR] Could not parse ");
+    exceptionMsgExpected.append(DramSpecLibrary::technologyName);
+    exceptionMsgExpected.append(" as a JSON document.\n");
+    string exceptionMsgThrown;
+    try {
+        DramSpecLibrary::evaluate("{ not json", architecture);
+    } catch(string exceptionMsg) {
+        exceptionMsgThrown = exceptionMsg;
+    }
+    BOOST_CHECK_MESSAGE( exceptionMsgThrown == exceptionMsgExpected,
+                        "Wrong exception message."
+                        << "\nExpected: " << exceptionMsgExpected
+                        << "\nGot: " << exceptionMsgThrown);
+
+    // A missing mandatory parameter is reported as for input files
+    exceptionMsgThrown.clear();
+    try {
+        DramSpecLibrary::evaluate("{}", architecture);
+    } catch(string exceptionMsg) {
+        exceptionMsgThrown = exceptionMsg;
+    }
+    BOOST_CHECK( exceptionMsgThrown.find("TechnologyNode[nm]")
+                 != string::npos );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // DRAMSPECLIBRARYTEST_CPP
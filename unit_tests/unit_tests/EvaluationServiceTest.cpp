@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef EVALUATIONSERVICETEST_CPP
+#define EVALUATIONSERVICETEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "../../parser/EvaluationService.h"
+#include "../../parser/SocketServer.h"
+
+BOOST_AUTO_TEST_SUITE( testEvaluationService )
+
+BOOST_AUTO_TEST_CASE( checkEvaluationService_requests )
+{
+    EvaluationService service;
+    string fileRequest("{\"id\": 1,"
+                       " \"technology\": \"technology_input/test_technology.json\","
+                       " \"architecture\": \"architecture_input/test_architecture.json\"}");
+
+    rapidjson::Document response;
+    response.Parse(service.handleRequest(fileRequest).c_str());
+    BOOST_REQUIRE( response.IsObject() );
+    BOOST_CHECK( response["id"].GetInt() == 1 );
+    BOOST_CHECK( response["ok"].GetBool() );
+    BOOST_CHECK( !response["reused"].GetBool() );
+
+    // Same result as evaluating the files directly
+    Current dram(TechnologyValues("technology_input/test_technology.json",
+                                  "architecture_input/test_architecture.json"),
+                 false);
+    DramResult expected;
+    expected.collect(dram);
+    double tRCD = response["results"]["tRCD[ns]"].GetDouble();
+    BOOST_CHECK_MESSAGE( tRCD == expected.values[DramResult::TRCD],
+                        "Served tRCD differs from the evaluated one."
+                        << "\nExpected: " << expected.values[DramResult::TRCD]
+                        << "\nGot: " << tRCD);
+
+    // Second request reuses input files and result
+    response.Parse(service.handleRequest(fileRequest).c_str());
+    BOOST_CHECK( response["reused"].GetBool() );
+
+    // An override makes it a different configuration
+    string overrideRequest("{\"technology\": \"technology_input/test_technology.json\","
+                           " \"architecture\": \"architecture_input/test_architecture.json\","
+                           " \"overrides\": {\"Vpp[V]\": 2.9}}");
+    response.Parse(service.handleRequest(overrideRequest).c_str());
+    BOOST_CHECK( response["ok"].GetBool() );
+    BOOST_CHECK( !response["reused"].GetBool() );
+
+    string unknownOverrideRequest("{\"id\": \"x\","
+                       " \"technology\": \"technology_input/test_technology.json\","
+                       " \"architecture\": \"architecture_input/test_architecture.json\","
+                       " \"overrides\": {\"Vxx[V]\": 2.9}}");
+    response.Parse(service.handleRequest(unknownOverrideRequest).c_str());
+    BOOST_CHECK( string(response["id"].GetString()) == "x" );
+    BOOST_CHECK( !response["ok"].GetBool() );
+    BOOST_CHECK( string(response["error"].GetString()).find("Vxx[V]")
+                 != string::npos );
+
+    response.Parse(service.handleRequest("not json").c_str());
+    BOOST_CHECK( !response["ok"].GetBool() );
+
+    response.Parse(service.handleRequest("{\"command\": \"stats\"}").c_str());
+    BOOST_REQUIRE( response["ok"].GetBool() );
+    const rapidjson::Value& statistics = response["statistics"];
+    BOOST_CHECK_MESSAGE( statistics["requests"].GetUint64() == 5,
+                        "Wrong number of requests."
+                        << "\nExpected: 5"
+                        << "\nGot: " << statistics["requests"].GetUint64());
+    BOOST_CHECK( statistics["failed_requests"].GetUint64() == 2 );
+    BOOST_CHECK( statistics["evaluations"].GetUint64() == 2 );
+    BOOST_CHECK( statistics["reused_results"].GetUint64() == 1 );
+    BOOST_CHECK( statistics["input_cache_hits"].GetUint64() == 3 );
+
+    // A frequency of 0 would give no finite timings
+    string zeroFrequencyRequest("{\"technology\": \"technology_input/test_technology.json\","
+                       " \"architecture\": \"architecture_input/test_architecture.json\","
+                       " \"overrides\": {\"Frequency[MHz]\": 0}}");
+    response.Parse(service.handleRequest(zeroFrequencyRequest).c_str());
+    BOOST_REQUIRE( response.IsObject() );
+    BOOST_CHECK( !response["ok"].GetBool() );
+    BOOST_CHECK( string(response["error"].GetString()).find("Frequency[MHz]")
+                 != string::npos );
+
+    // Overrides are checked as -D overrides are, e.g. counts are whole
+    string fractionalCountRequest("{\"technology\": \"technology_input/test_technology.json\","
+                       " \"architecture\": \"architecture_input/test_architecture.json\","
+                       " \"overrides\": {\"Prefetch[]\": 2.5}}");
+    response.Parse(service.handleRequest(fractionalCountRequest).c_str());
+    BOOST_REQUIRE( response.IsObject() );
+    BOOST_CHECK( !response["ok"].GetBool() );
+    BOOST_CHECK( string(response["error"].GetString()).find("whole number")
+                 != string::npos );
+
+    BOOST_CHECK( !service.isShutdownRequested() );
+    service.handleRequest("{\"command\": \"shutdown\"}");
+    BOOST_CHECK( service.isShutdownRequested() );
+}
+
+BOOST_AUTO_TEST_CASE( checkSocketServer_socket_path )
+{
+    EvaluationService service;
+
+    // A file which is not a socket is never removed
+    string filePath("socket_server_test_file");
+    ofstream("socket_server_test_file") << "keep me\n";
+    {
+        SocketServer server(filePath, service);
+        std::string exceptionMsg("Empty");
+        try {
+            server.open();
+        }catch (string exceptionMsgThrown){
+            exceptionMsg = exceptionMsgThrown;
+        }
+        string expectedMsg("[ERROR] Socket path \'socket_server_test_file\' ");
+        expectedMsg.append("exists and is not a socket.\n");
+        BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                            "Error message different from what was expected."
+                            << "\nExpected: " << expectedMsg
+                            << "\nGot: " << exceptionMsg);
+    }
+    BOOST_CHECK( access(filePath.c_str(), F_OK) == 0 );
+    remove(filePath.c_str());
+
+    // A socket left behind by a stopped server is replaced
+    string socketPath("socket_server_test.sock");
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+    int staleSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+    BOOST_REQUIRE( bind(staleSocket, (struct sockaddr*) &address,
+                        sizeof(address)) == 0 );
+    close(staleSocket);
+
+    SocketServer server(socketPath, service);
+    BOOST_CHECK_NO_THROW( server.open() );
+
+    // The socket of a running server is not taken over
+    SocketServer otherServer(socketPath, service);
+    std::string exceptionMsg("Empty");
+    try {
+        otherServer.open();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("[ERROR] Socket path \'socket_server_test.sock\' ");
+    expectedMsg.append("is used by a running server.\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // EVALUATIONSERVICETEST_CPP
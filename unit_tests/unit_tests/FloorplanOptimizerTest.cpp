@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+#ifndef FLOORPLANOPTIMIZERTEST_CPP
+#define FLOORPLANOPTIMIZERTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../parser/FloorplanOptimizer.h"
+#include "../../core/Current.h"
+
+BOOST_AUTO_TEST_SUITE( testFloorplanOptimizer )
+
+static bool
+isSameResult(const DramResult& first, const DramResult& second)
+{
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        if ( first.values[valueID] != second.values[valueID] ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+BOOST_AUTO_TEST_CASE( checkFloorplanOptimizer_placements )
+{
+    TechnologyValues inputs("technology_input/test_technology.json",
+                            "architecture_input/test_architecture.json");
+    FloorplanOptimizer optimizer(false);
+    optimizer.optimize(inputs);
+
+    // 8 banks (1, 2, 4 or 8 vertically) and 2 tiles (1 or 2 vertically)
+    const vector<Floorplan>& floorplans = optimizer.floorplans();
+    BOOST_REQUIRE( floorplans.size() == 8 );
+    BOOST_CHECK( optimizer.nInvalid == 0 );
+
+    // The configured placement is the one of a normal run
+    Current configuredDram(inputs, false);
+    DramResult configuredResult;
+    configuredResult.collect(configuredDram);
+    const Floorplan& configured = floorplans[optimizer.configuredFloorplan()];
+    BOOST_CHECK( configured.nVerticalBanks == configuredDram.nVerticalBanks );
+    BOOST_CHECK( configured.nVerticalTiles == configuredDram.nVerticalTiles );
+    BOOST_CHECK( isSameResult(configured.result, configuredResult) );
+
+    // Shared stages give the results of a full run with the banks placed
+    //  in the inputs
+    for ( unsigned int it = 0; it < floorplans.size(); it++ ) {
+        BOOST_CHECK( floorplans[it].nVerticalBanks
+                     * floorplans[it].nHorizontalBanks == 8 );
+        BOOST_CHECK( floorplans[it].nVerticalTiles
+                     * floorplans[it].nHorizontalTiles == 2 );
+        if ( floorplans[it].nVerticalTiles != configured.nVerticalTiles ) {
+            continue;
+        }
+        TechnologyValues placedInputs(inputs);
+        TechnologyValues::findField("NumberOfVerticalBanksPerChannel[]")
+            ->setNumber(placedInputs, floorplans[it].nVerticalBanks);
+        TechnologyValues::findField("NumberOfHorizontalBanksPerChannel[]")
+            ->setNumber(placedInputs, floorplans[it].nHorizontalBanks);
+        Current dram(placedInputs, false);
+        DramResult result;
+        result.collect(dram);
+        BOOST_CHECK( isSameResult(floorplans[it].result, result) );
+    }
+
+    // Best placements
+    BOOST_CHECK( !optimizer.objectives().empty() );
+    for ( unsigned int it = 0; it < optimizer.objectives().size(); it++ ) {
+        int valueID = optimizer.objectives()[it];
+        double best = floorplans[optimizer.bestFloorplan(valueID)]
+                                                    .result.values[valueID];
+        for ( unsigned int other = 0; other < floorplans.size(); other++ ) {
+            double value = floorplans[other].result.values[valueID];
+            BOOST_CHECK( FloorplanOptimizer::isMaximized(valueID)
+                         ? value <= best : value >= best );
+        }
+    }
+    BOOST_CHECK( find(optimizer.objectives().begin(),
+                      optimizer.objectives().end(),
+                      int(DramResult::CHANNEL_AREA))
+                 != optimizer.objectives().end() );
+    BOOST_CHECK( find(optimizer.objectives().begin(),
+                      optimizer.objectives().end(),
+                      int(DramResult::TRCD))
+                 == optimizer.objectives().end() );
+}
+
+BOOST_AUTO_TEST_CASE( checkFloorplanOptimizer_tile_placement )
+{
+    Tile tile(TechnologyValues("technology_input/test_technology.json",
+                               "architecture_input/test_architecture.json"));
+
+    Bank bank(tile, 2);
+    BOOST_CHECK( bank.nVerticalTiles == 2 );
+    BOOST_CHECK( bank.nHorizontalTiles == 1 );
+
+    string exceptionMsg("Empty");
+    try {
+        Bank wrongBank(tile, 4);
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("[ERROR] Number of tiles in either direction must be "
+                       "a power of two and less than or equal to the number "
+                       "of tiles per bank.");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // FLOORPLANOPTIMIZERTEST_CPP
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+#ifndef GOALSEEKERTEST_CPP
+#define GOALSEEKERTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <cstdio>
+#include <fstream>
+
+#include "../../parser/GoalSeeker.h"
+
+BOOST_AUTO_TEST_SUITE( testGoalSeeker )
+
+// Constraints checked directly on the model
+static bool
+meetsConstraints(const TechnologyValues& baseInputs, const string& name,
+                 double value, const vector<GoalSeeker::Constraint>& constraints)
+{
+    TechnologyValues inputs(baseInputs);
+    TechnologyValues::findField(name)->setNumber(inputs, value);
+    DramResult result;
+    try {
+        Current dram(inputs, false);
+        result.collect(dram);
+    } catch(string exceptionMsgThrown) {
+        return false;
+    }
+    for ( unsigned int it = 0; it < constraints.size(); it++ ) {
+        double bound = ( constraints[it].boundValueID >= 0
+                         ? result.values[constraints[it].boundValueID]
+                         : constraints[it].bound );
+        if ( result.values[constraints[it].valueID] > bound ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+BOOST_AUTO_TEST_CASE( checkGoalSeeker_frequency )
+{
+    GoalSeeker seeker;
+    seeker.baseInputs = TechnologyValues(
+                                "technology_input/test_technology.json",
+                                "architecture_input/test_architecture.json");
+
+    // Closed forms only
+    seeker.addRangeGoal("Frequency[MHz]", true, 100, 4000);
+    seeker.addConstraint("CoreFrequency[MHz] <= MaxCoreFrequency[MHz]");
+    seeker.addConstraint("tRCD[cc] <= 14");
+    // tRL depends on the frequency, bisected
+    seeker.addRangeGoal("Frequency[MHz]", true, 100, 4000, 0.01);
+    seeker.addConstraint("tRL[cc] <= 20");
+    seeker.solve();
+
+    const GoalSeeker::Goal& closedForm = seeker.goals()[0];
+    BOOST_REQUIRE( closedForm.isFound );
+    BOOST_CHECK( closedForm.isNarrowedInClosedForm );
+    BOOST_CHECK( closedForm.nEvaluations <= 3 );
+    BOOST_CHECK( meetsConstraints(seeker.baseInputs, "Frequency[MHz]",
+                                  closedForm.value, closedForm.constraints) );
+    BOOST_CHECK( !meetsConstraints(seeker.baseInputs, "Frequency[MHz]",
+                                   closedForm.value + 2*closedForm.tolerance,
+                                   closedForm.constraints) );
+
+    const GoalSeeker::Goal& bisected = seeker.goals()[1];
+    BOOST_REQUIRE( bisected.isFound );
+    BOOST_CHECK( !bisected.isNarrowedInClosedForm );
+    // Both ends of the range and log2(3900 / 0.01) bisections
+    BOOST_CHECK( bisected.nEvaluations <= 21 );
+    BOOST_CHECK( meetsConstraints(seeker.baseInputs, "Frequency[MHz]",
+                                  bisected.value, bisected.constraints) );
+    BOOST_CHECK( !meetsConstraints(seeker.baseInputs, "Frequency[MHz]",
+                                   bisected.value + 0.01,
+                                   bisected.constraints) );
+}
+
+BOOST_AUTO_TEST_CASE( checkGoalSeeker_counts )
+{
+    ofstream specificationFile("test_goals.json");
+    specificationFile
+        << "{ \"technology\": \"technology_input/test_technology.json\",\n"
+        << "  \"architecture\": \"architecture_input/test_architecture.json\",\n"
+        << "  \"goals\": [\n"
+        << "    { \"maximize\": \"CellsPerSubarrayColumn[]\",\n"
+        << "      \"minimum\": 64, \"maximum\": 2048,\n"
+        << "      \"constraints\": [ \"tRCD[ns] <= 14\" ] },\n"
+        << "    { \"minimize\": \"SubarrayToPageFactor[]\",\n"
+        << "      \"values\": [16, 1, 4, 2, 8],\n"
+        << "      \"constraints\": [ \"CoreFrequency[MHz] <= "
+        <<                            "MaxCoreFrequency[MHz]\" ] },\n"
+        << "    { \"minimize\": \"PageSize[KB]\", \"values\": [1, 2],\n"
+        << "      \"constraints\": [ \"ChannelArea[mm^2] < 1\" ] } ] }\n";
+    specificationFile.close();
+
+    GoalSeeker seeker;
+    seeker.readSpecification("test_goals.json");
+    remove("test_goals.json");
+    TechnologyValues::findField("Frequency[MHz]")->setNumber(
+                                                    seeker.baseInputs, 1300);
+    seeker.solve();
+
+    // Every count up to the answer meets the constraint, bisected instead
+    //  of run through
+    const GoalSeeker::Goal& cells = seeker.goals()[0];
+    BOOST_REQUIRE( cells.isFound );
+    BOOST_CHECK( cells.nEvaluations <= 14 );
+    BOOST_CHECK( meetsConstraints(seeker.baseInputs, "CellsPerSubarrayColumn[]",
+                                  cells.value, cells.constraints) );
+    BOOST_CHECK( !meetsConstraints(seeker.baseInputs,
+                                   "CellsPerSubarrayColumn[]",
+                                   cells.value + 1, cells.constraints) );
+
+    const GoalSeeker::Goal& factor = seeker.goals()[1];
+    BOOST_REQUIRE( factor.isFound );
+    unsigned int smallest = 0;
+    for ( unsigned int value = 1; value <= 16 && smallest == 0; value *= 2 ) {
+        if ( meetsConstraints(seeker.baseInputs, "SubarrayToPageFactor[]",
+                              value, factor.constraints) ) {
+            smallest = value;
+        }
+    }
+    BOOST_CHECK( smallest > 1 );
+    BOOST_CHECK( factor.value == smallest );
+
+    BOOST_CHECK( !seeker.goals()[2].isFound );
+
+    // A factor without unit is not a count, its bounds are kept
+    BOOST_CHECK( cells.isInteger );
+    seeker.addRangeGoal("PageSpanningFactor[]", true, 0.25, 1, 0);
+    BOOST_CHECK( !seeker.goals().back().isInteger );
+    BOOST_CHECK( seeker.goals().back().minimum == 0.25 );
+
+    // Malformed constraint
+    string exceptionMsg("Empty");
+    try {
+        seeker.addConstraint("tRCD[ns] = 14");
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("[ERROR] Constraint \"tRCD[ns] = 14\" is not of the "
+                       "form \"<result> <= <number or result>\" "
+                       "(also <, >= or >).\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // GOALSEEKERTEST_CPP
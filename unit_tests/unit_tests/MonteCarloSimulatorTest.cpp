@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+#ifndef MONTECARLOSIMULATORTEST_CPP
+#define MONTECARLOSIMULATORTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "../../parser/MonteCarloSimulator.h"
+
+BOOST_AUTO_TEST_SUITE( testMonteCarloSimulator )
+
+static void
+setUpSimulator(MonteCarloSimulator& simulator)
+{
+    simulator.baseInputs = TechnologyValues(
+                                "technology_input/test_technology.json",
+                                "architecture_input/test_architecture.json");
+    simulator.addNormalVariation("BitlineCapacitancePerCell[aF]", 0.05);
+    simulator.addNormalVariation("WordlineResistancePerCell[Ohm]", 0.05);
+    simulator.addUniformVariation("Temperature[C]", 25, 80);
+    simulator.nSamples = 3000;
+    simulator.seed = 5;
+}
+
+BOOST_AUTO_TEST_CASE( checkMonteCarloSimulator_reproducible )
+{
+    MonteCarloSimulator oneJob(false, 1);
+    MonteCarloSimulator fourJobs(false, 4);
+    setUpSimulator(oneJob);
+    setUpSimulator(fourJobs);
+
+    // Same samples whichever order they are drawn in
+    TechnologyValues sample = oneJob.sample(1234);
+    oneJob.sample(7);
+    BOOST_CHECK( oneJob.sample(1234).canonicalInputs()
+                 == sample.canonicalInputs() );
+    BOOST_CHECK( oneJob.sample(1235).canonicalInputs()
+                 != sample.canonicalInputs() );
+
+    // Same statistics whichever thread evaluates a sample
+    oneJob.simulate();
+    fourJobs.simulate();
+    ostringstream oneJobStatistics;
+    ostringstream fourJobsStatistics;
+    oneJob.writeStatistics(oneJobStatistics);
+    fourJobs.writeStatistics(fourJobsStatistics);
+    BOOST_CHECK( oneJobStatistics.str() == fourJobsStatistics.str() );
+    ostringstream oneJobHistograms;
+    ostringstream fourJobsHistograms;
+    oneJob.writeHistograms(oneJobHistograms);
+    fourJobs.writeHistograms(fourJobsHistograms);
+    BOOST_CHECK( oneJobHistograms.str() == fourJobsHistograms.str() );
+
+    // Every sample evaluated is counted once per clock cycle histogram
+    BOOST_CHECK_EQUAL( oneJob.nRejected, 0 );
+    unsigned long nCounted = 0;
+    const map<double, unsigned long>& histogram
+            = oneJob.histogram(DramResult::TRCD_CLK);
+    for ( map<double, unsigned long>::const_iterator bin = histogram.begin();
+          bin != histogram.end(); ++bin ) {
+        nCounted += bin->second;
+    }
+    BOOST_CHECK_EQUAL( nCounted, 3000 );
+    BOOST_CHECK( histogram.size() > 1 );
+    BOOST_CHECK( oneJob.histogram(DramResult::TRCD).empty() );
+}
+
+BOOST_AUTO_TEST_CASE( checkMonteCarloSimulator_distributions )
+{
+    ofstream specificationFile("test_montecarlo.json");
+    specificationFile
+        << "{ \"technology\": \"technology_input/test_technology.json\",\n"
+        << "  \"architecture\": \"architecture_input/test_architecture.json\",\n"
+        << "  \"samples\": 5000,\n"
+        << "  \"variations\": { \"CellCapacitance[fF]\": { \"normal\": 0.1 },\n"
+        << "    \"Temperature[C]\": { \"uniform\": [30, 60] } } }\n";
+    specificationFile.close();
+
+    MonteCarloSimulator simulator(false, 2);
+    simulator.readSpecification("test_montecarlo.json");
+    BOOST_CHECK_EQUAL( simulator.nSamples, 5000 );
+
+    // Drawn parameters
+    const TechnologyField* capacitance
+            = TechnologyValues::findField("CellCapacitance[fF]");
+    const TechnologyField* temperature
+            = TechnologyValues::findField("Temperature[C]");
+    double nominal = capacitance->getNumber(simulator.baseInputs);
+    StreamingStatistics capacitances;
+    StreamingStatistics temperatures;
+    for ( unsigned long it = 0; it < simulator.nSamples; it++ ) {
+        TechnologyValues sample = simulator.sample(it);
+        capacitances.add(capacitance->getNumber(sample));
+        temperatures.add(temperature->getNumber(sample));
+    }
+    BOOST_CHECK_CLOSE( capacitances.mean(), nominal, 1 );
+    BOOST_CHECK_CLOSE( sqrt(capacitances.variance()), 0.1 * nominal, 5 );
+    BOOST_CHECK( temperatures.minimum() >= 30 );
+    BOOST_CHECK( temperatures.maximum() <= 60 );
+    BOOST_CHECK_CLOSE( temperatures.mean(), 45, 1 );
+
+    simulator.simulate();
+    const StreamingStatistics& trcd = simulator.statistics(DramResult::TRCD);
+    BOOST_CHECK_EQUAL( trcd.count(), 5000 );
+    BOOST_CHECK( trcd.minimum() <= trcd.quantiles()[0].quantile() );
+    BOOST_CHECK( trcd.quantiles()[0].quantile()
+                 < trcd.quantiles()[1].quantile() );
+    BOOST_CHECK( trcd.quantiles()[1].quantile()
+                 < trcd.quantiles()[2].quantile() );
+    BOOST_CHECK( trcd.quantiles()[2].quantile() <= trcd.maximum() );
+
+    // Variation of a string parameter
+    string exceptionMsg("Empty");
+    try {
+        simulator.addNormalVariation("DRAMType[-]", 0.1);
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("[ERROR] Variation of \"DRAMType[-]\", which is no "
+                       "numeric input parameter of the configuration.\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    // Variation of a count
+    exceptionMsg = "Empty";
+    try {
+        simulator.addUniformVariation("NumberOfBanksPerChannel[]", 6, 10);
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    expectedMsg = "[ERROR] Variation of \"NumberOfBanksPerChannel[]\", which "
+                  "is a count, the model takes no distribution of it.\n";
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    // Quantities in whole clock cycles are counts as well
+    exceptionMsg = "Empty";
+    try {
+        simulator.addNormalVariation("AdditionalTRLLatency[cc]", 0.1);
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    expectedMsg = "[ERROR] Variation of \"AdditionalTRLLatency[cc]\", which "
+                  "is a count, the model takes no distribution of it.\n";
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+    remove("test_montecarlo.json");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // MONTECARLOSIMULATORTEST_CPP
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+#ifndef NSGA2TEST_CPP
+#define NSGA2TEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <cmath>
+
+#include "../../parser/Nsga2.h"
+
+BOOST_AUTO_TEST_SUITE( testNsga2 )
+
+// Two objectives, x and 1 - x + y, whose Pareto front is y = 0.
+//  Configurations with x + y > 1.5 are infeasible.
+static void
+evaluateIndividuals(vector<Nsga2::Individual>& individuals)
+{
+    for ( unsigned int it = 0; it < individuals.size(); it++ ) {
+        Nsga2::Individual& individual = individuals[it];
+        double x = individual.genes[0];
+        double y = individual.genes[1] / 4.0 + individual.genes[2];
+        individual.isFeasible = ( x + y <= 1.5 );
+        individual.objectiveValues.clear();
+        individual.objectiveValues.push_back(x);
+        individual.objectiveValues.push_back(1.0 - x + y);
+    }
+}
+
+static vector<Nsga2::Individual>
+runSearch(unsigned long long seed)
+{
+    // x continuous, y a discrete quarter and a continuous remainder
+    vector<Nsga2::Gene> genes(3);
+    genes[0].nValues = 0;
+    genes[0].minimum = 0;
+    genes[0].maximum = 1;
+    genes[1].nValues = 5;
+    genes[1].minimum = 0;
+    genes[1].maximum = 0;
+    genes[2].nValues = 0;
+    genes[2].minimum = 0;
+    genes[2].maximum = 0.25;
+
+    Nsga2 search(genes, 20, seed);
+    vector<Nsga2::Individual> candidates = search.initialPopulation();
+    evaluateIndividuals(candidates);
+    search.select(candidates);
+    for ( unsigned int generation = 0; generation < 40; generation++ ) {
+        candidates = search.makeOffspring();
+        BOOST_REQUIRE( candidates.size() == 20 );
+        evaluateIndividuals(candidates);
+        search.select(candidates);
+    }
+    return search.population();
+}
+
+BOOST_AUTO_TEST_CASE( checkNsga2_convergence )
+{
+    vector<Nsga2::Individual> population = runSearch(7);
+    BOOST_REQUIRE( population.size() == 20 );
+
+    double smallestX = 1;
+    double largestX = 0;
+    for ( unsigned int it = 0; it < population.size(); it++ ) {
+        const Nsga2::Individual& individual = population[it];
+        BOOST_CHECK( individual.isFeasible );
+        BOOST_CHECK( individual.rank == 0 );
+        BOOST_CHECK( individual.genes[1] == 0 );
+        BOOST_CHECK( individual.genes[2] < 0.025 );
+        smallestX = min(smallestX, individual.genes[0]);
+        largestX = max(largestX, individual.genes[0]);
+    }
+    // Spread along the front by the crowding distance
+    BOOST_CHECK( smallestX < 0.1 );
+    BOOST_CHECK( largestX > 0.9 );
+}
+
+BOOST_AUTO_TEST_CASE( checkNsga2_reproducible )
+{
+    vector<Nsga2::Individual> first = runSearch(3);
+    vector<Nsga2::Individual> second = runSearch(3);
+    vector<Nsga2::Individual> other = runSearch(4);
+
+    bool isSame = ( first.size() == second.size() );
+    bool isOtherSame = ( first.size() == other.size() );
+    for ( unsigned int it = 0; isSame && it < first.size(); it++ ) {
+        isSame = ( first[it].genes == second[it].genes );
+    }
+    for ( unsigned int it = 0; isOtherSame && it < first.size(); it++ ) {
+        isOtherSame = ( first[it].genes == other[it].genes );
+    }
+    BOOST_CHECK( isSame );
+    BOOST_CHECK( !isOtherSame );
+}
+
+BOOST_AUTO_TEST_CASE( checkNsga2_constrained_domination )
+{
+    Nsga2::Individual feasible;
+    feasible.isFeasible = true;
+    feasible.objectiveValues.push_back(10);
+    feasible.objectiveValues.push_back(10);
+
+    Nsga2::Individual infeasible;
+    infeasible.isFeasible = false;
+    infeasible.objectiveValues.push_back(1);
+    infeasible.objectiveValues.push_back(1);
+
+    Nsga2::Individual better(feasible);
+    better.objectiveValues[0] = 9;
+
+    BOOST_CHECK( Nsga2::dominates(feasible, infeasible) );
+    BOOST_CHECK( !Nsga2::dominates(infeasible, feasible) );
+    BOOST_CHECK( !Nsga2::dominates(infeasible, infeasible) );
+    BOOST_CHECK( Nsga2::dominates(better, feasible) );
+    BOOST_CHECK( !Nsga2::dominates(feasible, better) );
+    BOOST_CHECK( !Nsga2::dominates(feasible, feasible) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // NSGA2TEST_CPP
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef OUTPUTWRITERTEST_CPP
+#define OUTPUTWRITERTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../utils/BoundedQueue.h"
+
+BOOST_AUTO_TEST_SUITE( testOutputWriter )
+
+BOOST_AUTO_TEST_CASE( checkBoundedQueue_full_and_empty )
+{
+    BoundedQueue<int> queue(2);
+    int item = 0;
+
+    BOOST_CHECK( !queue.tryPop(item) );
+
+    int first = 1, second = 2, third = 3;
+    BOOST_CHECK( queue.tryPush(first) );
+    BOOST_CHECK( queue.tryPush(second) );
+    BOOST_CHECK_MESSAGE( !queue.tryPush(third),
+                        "Queue accepted more items than its capacity."
+                        << "\nExpected: " << queue.capacity() << " items");
+    BOOST_CHECK( queue.highWaterMark() == 2 );
+
+    BOOST_CHECK( queue.tryPop(item) && item == 1 );
+    BOOST_CHECK( queue.tryPush(third) );
+    BOOST_CHECK( queue.tryPop(item) && item == 2 );
+    BOOST_CHECK( queue.tryPop(item) && item == 3 );
+    BOOST_CHECK( !queue.tryPop(item) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // OUTPUTWRITERTEST_CPP
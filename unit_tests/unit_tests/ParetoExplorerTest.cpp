@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef PARETOEXPLORERTEST_CPP
+#define PARETOEXPLORERTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+#include "../../parser/ParetoExplorer.h"
+
+BOOST_AUTO_TEST_SUITE( testParetoExplorer )
+
+// Objective values of the Pareto front of the whole grid, sorted
+static vector<vector<double>>
+bruteForceFront(const TechnologyValues& baseInputs,
+                const vector<string>& parameterNames,
+                const vector<vector<double>>& parameterValues,
+                const vector<string>& objectiveNames)
+{
+    vector<vector<double>> points;
+    vector<unsigned int> valueIDs(parameterNames.size(), 0);
+    while ( true ) {
+        TechnologyValues inputs(baseInputs);
+        for ( unsigned int it = 0; it < parameterNames.size(); it++ ) {
+            TechnologyValues::findField(parameterNames[it])->setNumber(
+                inputs, parameterValues[it][valueIDs[it]]);
+        }
+        try {
+            Current dram(inputs, false);
+            DramResult result;
+            result.collect(dram);
+            vector<double> objectiveValues;
+            for ( unsigned int it = 0; it < objectiveNames.size(); it++ ) {
+                objectiveValues.push_back(
+                    result.values[DramResult::findValue(objectiveNames[it])]);
+            }
+            points.push_back(objectiveValues);
+        } catch(string exceptionMsgThrown) {
+        }
+
+        unsigned int level = 0;
+        while ( level < valueIDs.size()
+                && ++valueIDs[level] == parameterValues[level].size() ) {
+            valueIDs[level++] = 0;
+        }
+        if ( level == valueIDs.size() ) {
+            break;
+        }
+    }
+
+    vector<vector<double>> front;
+    for ( unsigned int point = 0; point < points.size(); point++ ) {
+        bool isDominated = false;
+        for ( unsigned int other = 0;
+              !isDominated && other < points.size(); other++ ) {
+            bool isBetterOrEqual = true;
+            bool isBetter = false;
+            for ( unsigned int it = 0; it < objectiveNames.size(); it++ ) {
+                isBetterOrEqual = isBetterOrEqual
+                                  && points[other][it] <= points[point][it];
+                isBetter = isBetter || points[other][it] < points[point][it];
+            }
+            isDominated = isBetterOrEqual && isBetter;
+        }
+        if ( !isDominated ) {
+            front.push_back(points[point]);
+        }
+    }
+    sort(front.begin(), front.end());
+    front.erase(unique(front.begin(), front.end()), front.end());
+    return front;
+}
+
+static vector<vector<double>>
+explorerFront(const ParetoExplorer& explorer)
+{
+    vector<vector<double>> front;
+    for ( unsigned int it = 0; it < explorer.front().size(); it++ ) {
+        front.push_back(explorer.front()[it].objectiveValues);
+    }
+    sort(front.begin(), front.end());
+    return front;
+}
+
+BOOST_AUTO_TEST_CASE( checkParetoExplorer_front )
+{
+    vector<string> parameterNames;
+    vector<vector<double>> parameterValues;
+    parameterNames.push_back("PageSize[KB]");
+    parameterValues.push_back({1, 2, 4});
+    parameterNames.push_back("TilesPerBank[]");
+    parameterValues.push_back({2, 4});
+    parameterNames.push_back("CellsPerSubarrayColumn[]");
+    parameterValues.push_back({1036, 268, 524});
+    parameterNames.push_back("CellsPerSubarrayRow[]");
+    parameterValues.push_back({268, 524});
+
+    // Objectives without known relationships: the whole grid is run
+    vector<string> objectiveNames;
+    objectiveNames.push_back("ChannelArea[mm^2]");
+    objectiveNames.push_back("tRC[ns]");
+    objectiveNames.push_back("IDD0[mA]");
+
+    ParetoExplorer explorer;
+    explorer.baseInputs = TechnologyValues(
+                                "technology_input/test_technology.json",
+                                "architecture_input/test_architecture.json");
+    for ( unsigned int it = 0; it < parameterNames.size(); it++ ) {
+        explorer.addParameter(parameterNames[it], parameterValues[it]);
+    }
+    for ( unsigned int it = 0; it < objectiveNames.size(); it++ ) {
+        explorer.addObjective(objectiveNames[it], false);
+    }
+    explorer.explore();
+
+    BOOST_CHECK( explorer.nGridPoints() == 36 );
+    BOOST_CHECK( explorer.nEvaluated == 36 );
+    BOOST_CHECK( explorer.nSkipped == 0 );
+    BOOST_CHECK( explorerFront(explorer)
+                 == bruteForceFront(explorer.baseInputs, parameterNames,
+                                    parameterValues, objectiveNames) );
+}
+
+BOOST_AUTO_TEST_CASE( checkParetoExplorer_pruning )
+{
+    ofstream specificationFile("test_exploration.json");
+    specificationFile
+        << "{ \"technology\": \"technology_input/test_technology.json\",\n"
+        << "  \"architecture\": \"architecture_input/test_architecture.json\",\n"
+        << "  \"parameters\": { \"PageSize[KB]\": [1, 2, 4],\n"
+        << "                    \"CellsPerSubarrayColumn[]\": [1036, 268, 524],\n"
+        << "                    \"Temperature[C]\": [27, 45] },\n"
+        << "  \"objectives\": [ \"tRCD[ns]\", \"SubarrayHeight[um]\",\n"
+        << "                    \"max:tRP[ns]\" ],\n"
+        << "  \"monotonic\": { \"Temperature[C]\": \"increasing\" } }\n";
+    specificationFile.close();
+
+    ParetoExplorer explorer;
+    explorer.readSpecification("test_exploration.json");
+    remove("test_exploration.json");
+
+    // A maximized objective against the known direction: no pruning
+    //  along CellsPerSubarrayColumn, only along the declared Temperature
+    explorer.explore();
+    BOOST_CHECK( explorer.nEvaluated + explorer.nSkipped == 18 );
+
+    vector<string> parameterNames;
+    vector<vector<double>> parameterValues;
+    parameterNames.push_back("PageSize[KB]");
+    parameterValues.push_back({1, 2, 4});
+    parameterNames.push_back("CellsPerSubarrayColumn[]");
+    parameterValues.push_back({1036, 268, 524});
+
+    vector<string> objectiveNames;
+    objectiveNames.push_back("tRCD[ns]");
+    objectiveNames.push_back("SubarrayHeight[um]");
+    objectiveNames.push_back("tRP[ns]");
+
+    // All objectives grow with CellsPerSubarrayColumn: its larger values
+    //  are skipped once they are dominated, the front stays the same
+    ParetoExplorer pruningExplorer;
+    pruningExplorer.baseInputs = explorer.baseInputs;
+    for ( unsigned int it = 0; it < parameterNames.size(); it++ ) {
+        pruningExplorer.addParameter(parameterNames[it],
+                                     parameterValues[it]);
+    }
+    for ( unsigned int it = 0; it < objectiveNames.size(); it++ ) {
+        pruningExplorer.addObjective(objectiveNames[it], false);
+    }
+    pruningExplorer.explore();
+    BOOST_CHECK( pruningExplorer.nSkipped > 0 );
+    BOOST_CHECK( pruningExplorer.nEvaluated + pruningExplorer.nSkipped == 9 );
+    BOOST_CHECK( explorerFront(pruningExplorer)
+                 == bruteForceFront(pruningExplorer.baseInputs,
+                                    parameterNames, parameterValues,
+                                    objectiveNames) );
+
+    // Unknown names
+    string exceptionMsg("Empty");
+    try {
+        pruningExplorer.addObjective("tRCD", false);
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("[ERROR] Unknown result \"tRCD\" "
+                       "can not be an objective.\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkParetoExplorer_nsga2 )
+{
+    ofstream specificationFile("test_evolution.json");
+    specificationFile
+        << "{ \"technology\": \"technology_input/test_technology.json\",\n"
+        << "  \"architecture\": \"architecture_input/test_architecture.json\",\n"
+        << "  \"parameters\": { \"PageSize[KB]\": [1, 2, 4],\n"
+        << "                    \"TilesPerBank[]\": [2, 3, 4],\n"
+        << "                    \"CellsPerSubarrayColumn[]\": [1036, 268, 524],\n"
+        << "                    \"CellsPerSubarrayRow[]\": [268, 524] },\n"
+        << "  \"objectives\": [ \"ChannelArea[mm^2]\", \"tRC[ns]\",\n"
+        << "                    \"IDD0[mA]\" ],\n"
+        << "  \"search\": { \"method\": \"nsga2\", \"population\": 12,\n"
+        << "              \"generations\": 8, \"seed\": 5 } }\n";
+    specificationFile.close();
+
+    // The same front whatever the number of parallel evaluations
+    ParetoExplorer explorer;
+    explorer.readSpecification("test_evolution.json");
+    explorer.nJobs = 1;
+    explorer.explore();
+    ParetoExplorer parallelExplorer;
+    parallelExplorer.readSpecification("test_evolution.json");
+    remove("test_evolution.json");
+    parallelExplorer.nJobs = 4;
+    parallelExplorer.explore();
+
+    BOOST_CHECK( explorer.isEvolutionary );
+    BOOST_CHECK( explorer.nEvaluated <= 12 * (8 + 1) );
+    BOOST_CHECK( explorer.nEvaluated <= 54 );
+    // 3 tiles per bank is an invalid configuration
+    BOOST_CHECK( explorer.nInvalid > 0 );
+    BOOST_CHECK( explorer.nEvaluated == parallelExplorer.nEvaluated );
+    BOOST_REQUIRE( explorer.front().size()
+                   == parallelExplorer.front().size() );
+    for ( unsigned int it = 0; it < explorer.front().size(); it++ ) {
+        BOOST_CHECK( explorer.front()[it].parameterValues
+                     == parallelExplorer.front()[it].parameterValues );
+        BOOST_CHECK( explorer.front()[it].objectiveValues
+                     == parallelExplorer.front()[it].objectiveValues );
+    }
+
+    // Every point found is on the front of the whole grid
+    vector<string> parameterNames;
+    vector<vector<double>> parameterValues;
+    parameterNames.push_back("PageSize[KB]");
+    parameterValues.push_back({1, 2, 4});
+    parameterNames.push_back("TilesPerBank[]");
+    parameterValues.push_back({2, 3, 4});
+    parameterNames.push_back("CellsPerSubarrayColumn[]");
+    parameterValues.push_back({1036, 268, 524});
+    parameterNames.push_back("CellsPerSubarrayRow[]");
+    parameterValues.push_back({268, 524});
+    vector<string> objectiveNames;
+    objectiveNames.push_back("ChannelArea[mm^2]");
+    objectiveNames.push_back("tRC[ns]");
+    objectiveNames.push_back("IDD0[mA]");
+    vector<vector<double>> gridFront =
+        bruteForceFront(explorer.baseInputs, parameterNames,
+                        parameterValues, objectiveNames);
+    vector<vector<double>> front = explorerFront(explorer);
+    BOOST_CHECK( !front.empty() );
+    for ( unsigned int it = 0; it < front.size(); it++ ) {
+        BOOST_CHECK( find(gridFront.begin(), gridFront.end(), front[it])
+                     != gridFront.end() );
+    }
+
+    // Ranges are only searched by NSGA-II
+    ParetoExplorer gridExplorer;
+    gridExplorer.baseInputs = explorer.baseInputs;
+    gridExplorer.addParameterRange("Temperature[C]", 25, 75);
+    gridExplorer.addObjective("tRC[ns]", false);
+    string exceptionMsg("Empty");
+    try {
+        gridExplorer.explore();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("[ERROR] Parameter \"Temperature[C]\" is a range, "
+                       "which only the \"nsga2\" search can explore.\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // PARETOEXPLORERTEST_CPP
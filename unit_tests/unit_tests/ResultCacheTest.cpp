@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef RESULTCACHETEST_CPP
+#define RESULTCACHETEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <cstdio>
+
+#include "../../parser/ResultCache.h"
+
+BOOST_AUTO_TEST_SUITE( testResultCache )
+
+BOOST_AUTO_TEST_CASE( checkResultCache_input_key )
+{
+    TechnologyValues inputs("technology_input/test_technology.json",
+                            "architecture_input/test_architecture.json");
+    TechnologyValues sameInputs("technology_input/test_technology.json",
+                                "architecture_input/test_architecture.json");
+
+    BOOST_CHECK_MESSAGE( ResultCache::inputKey(inputs, false)
+                         == ResultCache::inputKey(sameInputs, false),
+                        "Same inputs gave different input keys.");
+    BOOST_CHECK_MESSAGE( ResultCache::inputKey(inputs, false)
+                         != ResultCache::inputKey(inputs, true),
+                        "IO termination flag not part of the input key.");
+
+    // A value in a different (but equal) notation gives the same key
+    sameInputs.vpp = 2.80*si::volt;
+    BOOST_CHECK( ResultCache::inputKey(inputs, false)
+                 == ResultCache::inputKey(sameInputs, false) );
+    sameInputs.vpp = 2.9*si::volt;
+    BOOST_CHECK( ResultCache::inputKey(inputs, false)
+                 != ResultCache::inputKey(sameInputs, false) );
+}
+
+BOOST_AUTO_TEST_CASE( checkResultCache_store_and_find )
+{
+    ResultCache cache;
+    cache.setDirectory(".");
+
+    DramResult result;
+    result.inputKey = "ModelVersion=test\nOnly=for testing\n";
+    result.values[DramResult::TRCD] = 0.1 + 0.2;
+    result.values[DramResult::IDD0] = 45.49696688376609;
+    result.warning = "[WARNING] Test warning.\n";
+
+    DramResult found;
+    found.inputKey = result.inputKey;
+    BOOST_CHECK( !cache.findInRun(found) );
+
+    cache.insertInRun(result);
+    BOOST_CHECK( cache.findInRun(found) );
+    BOOST_CHECK( found.values[DramResult::IDD0]
+                 == result.values[DramResult::IDD0] );
+
+    // Another key is not mistaken for it
+    DramResult other;
+    other.inputKey = "ModelVersion=test\nOnly=for other tests\n";
+    BOOST_CHECK( !cache.findInRun(other) );
+
+    cache.storeOnDisk(result);
+    ResultCache otherRun;
+    otherRun.setDirectory(".");
+    DramResult foundOnDisk;
+    foundOnDisk.inputKey = result.inputKey;
+    BOOST_CHECK( otherRun.findOnDisk(foundOnDisk) );
+    BOOST_CHECK_MESSAGE( foundOnDisk.values[DramResult::TRCD]
+                         == result.values[DramResult::TRCD],
+                        "Value did not read back to the same double."
+                        << "\nExpected: " << result.values[DramResult::TRCD]
+                        << "\nGot: " << foundOnDisk.values[DramResult::TRCD]);
+    BOOST_CHECK( foundOnDisk.warning == result.warning );
+
+    remove(cache.entryFileName(result.inputKey).c_str());
+}
+
+BOOST_AUTO_TEST_CASE( checkResultCache_run_results_bounded )
+{
+    ResultCache cache;
+
+    DramResult result;
+    for ( size_t it = 0; it <= ResultCache::maxRunResults; it++ ) {
+        result.inputKey = "ModelVersion=test\nPoint=" + to_string(it) + "\n";
+        cache.insertInRun(result);
+    }
+    BOOST_CHECK( cache.nRunResults() <= ResultCache::maxRunResults );
+    BOOST_CHECK( cache.findInRun(result) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // RESULTCACHETEST_CPP
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef RESULTFORMATTERTEST_CPP
+#define RESULTFORMATTERTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../../parser/ResultFormatter.h"
+
+BOOST_AUTO_TEST_SUITE( testResultFormatter )
+
+BOOST_AUTO_TEST_CASE( checkShortestDoubleToString_round_trip )
+{
+    double values[] = {800, 0.1, 0.1 + 0.2, 223.44518960093516,
+                       7812.5, 1e-20, 1.0/3.0, -45.49696688376609};
+
+    for ( unsigned int it = 0; it < sizeof(values)/sizeof(double); it++ ) {
+        char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+        shortestDoubleToString(values[it], buffer);
+        BOOST_CHECK_MESSAGE( strtod(buffer, NULL) == values[it],
+                            "Value did not read back to the same double."
+                            << "\nExpected: " << values[it]
+                            << "\nGot: " << buffer);
+    }
+
+    char buffer[SHORTEST_DOUBLE_BUFFER_SIZE];
+    shortestDoubleToString(800, buffer);
+    BOOST_CHECK_MESSAGE( string(buffer) == "800",
+                        "Integer value not printed in its shortest form."
+                        << "\nExpected: 800"
+                        << "\nGot: " << buffer);
+
+    shortestDoubleToString(0.1, buffer);
+    BOOST_CHECK_MESSAGE( string(buffer) == "0.1",
+                        "Value not printed in its shortest form."
+                        << "\nExpected: 0.1"
+                        << "\nGot: " << buffer);
+}
+
+BOOST_AUTO_TEST_CASE( checkResultFormatter_both_tables )
+{
+    ResultFormatter formatter;
+    formatter.appendLine("tRCD                 [ns]", 10.5);
+    formatter.appendLine("tRCD                 [cc]", 9);
+
+    string expectedCsv("tRCD                 [ns],10.5\n"
+                       "tRCD                 [cc],9\n");
+    BOOST_CHECK_MESSAGE( formatter.csvTable() == expectedCsv,
+                        "CSV table different from what was expected."
+                        << "\nExpected: " << expectedCsv
+                        << "\nGot: " << formatter.csvTable());
+
+    string expectedStdout("tRCD                 [ns]     10.5\n"
+                          "tRCD                 [cc]     9\n");
+    BOOST_CHECK_MESSAGE( formatter.stdoutTable() == expectedStdout,
+                        "Stdout table different from what was expected."
+                        << "\nExpected: " << expectedStdout
+                        << "\nGot: " << formatter.stdoutTable());
+
+    formatter.clear();
+    BOOST_CHECK( formatter.csvTable().empty() );
+    BOOST_CHECK( formatter.stdoutTable().empty() );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // RESULTFORMATTERTEST_CPP
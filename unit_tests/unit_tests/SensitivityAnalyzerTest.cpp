@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+#ifndef SENSITIVITYANALYZERTEST_CPP
+#define SENSITIVITYANALYZERTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <cmath>
+#include <sstream>
+
+#include "../../parser/SensitivityAnalyzer.h"
+
+BOOST_AUTO_TEST_SUITE( testSensitivityAnalyzer )
+
+static const Sensitivity*
+findSensitivity(const SensitivityAnalyzer& analyzer, const string& name)
+{
+    for ( unsigned int it = 0; it < analyzer.sensitivities().size(); it++ ) {
+        if ( name == analyzer.sensitivities()[it].field->name ) {
+            return &analyzer.sensitivities()[it];
+        }
+    }
+    return NULL;
+}
+
+BOOST_AUTO_TEST_CASE( checkSensitivityAnalyzer_jacobian )
+{
+    TechnologyValues inputs("technology_input/test_technology.json",
+                            "architecture_input/test_architecture.json");
+    SensitivityAnalyzer analyzer(false);
+    analyzer.analyze(inputs);
+
+    // Every technology parameter which is not a count, in one evaluation
+    //  on dual numbers besides the nominal one
+    unsigned int nParameters = 0;
+    const vector<TechnologyField>& fields = TechnologyValues::fieldRegistry();
+    for ( unsigned int it = 0; it < fields.size(); it++ ) {
+        if ( fields[it].document == TECHNOLOGY_DOCUMENT
+             && fields[it].setDual != NULL
+             && fields[it].getNumber(inputs) != INVALID_VALUE ) {
+            nParameters++;
+        }
+    }
+    BOOST_CHECK( nParameters > 0 );
+    BOOST_CHECK_EQUAL( analyzer.sensitivities().size(), nParameters );
+    BOOST_CHECK_EQUAL( analyzer.nEvaluations, 2 );
+
+    Current dram(inputs, false);
+    BOOST_CHECK_EQUAL( analyzer.nominal().values[DramResult::TRCD],
+                       dram.trcd.value() );
+
+    // Derivative against a difference of a larger step
+    const char* name = "BitlineResistancePerCell[Ohm]";
+    const Sensitivity* sensitivity = findSensitivity(analyzer, name);
+    BOOST_REQUIRE( sensitivity != NULL );
+    double step = 1e-3 * sensitivity->value;
+    TechnologyValues lowerInputs(inputs);
+    TechnologyValues upperInputs(inputs);
+    sensitivity->field->setNumber(lowerInputs, sensitivity->value - step);
+    sensitivity->field->setNumber(upperInputs, sensitivity->value + step);
+    Current lower(lowerInputs, false);
+    Current upper(upperInputs, false);
+    double derivative = ( upper.trcd.value() - lower.trcd.value() ) / (2*step);
+    BOOST_CHECK( derivative > 0 );
+    BOOST_CHECK_CLOSE( sensitivity->derivatives[DramResult::TRCD],
+                       derivative, 0.1 );
+
+    // Clock cycles: derivative of tRCD / clock period instead of a step
+    BOOST_CHECK_CLOSE( sensitivity->derivatives[DramResult::TRCD_CLK],
+                       sensitivity->derivatives[DramResult::TRCD]
+                       * analyzer.nominal().values[DramResult::DRAM_FREQ]
+                       / 1000, 1e-6 );
+    BOOST_CHECK_CLOSE( analyzer.elasticity(*sensitivity, DramResult::TRCD_CLK),
+                       analyzer.elasticity(*sensitivity, DramResult::TRCD),
+                       1e-4 );
+
+    // The currents follow the relaxed cycle counts: IDD0 falls as the
+    //  cycles of tRC grow
+    BOOST_CHECK( sensitivity->derivatives[DramResult::TRC_CLK] > 0 );
+    BOOST_CHECK( sensitivity->derivatives[DramResult::IDD0] < 0 );
+
+    // The geometry does not depend on the bitline resistance
+    BOOST_CHECK_EQUAL( sensitivity->derivatives[DramResult::CHANNEL_AREA], 0 );
+
+    ostringstream sensitivityFile;
+    SensitivityAnalyzer::writeHeader(sensitivityFile);
+    analyzer.writeSensitivities(sensitivityFile, 3, "tech,1.json", "arch.json");
+    BOOST_CHECK( sensitivityFile.str().find(
+                     "\n3,\"tech,1.json\",arch.json,"
+                     "BitlineResistancePerCell[Ohm],")
+                 != string::npos );
+    // Results which do not depend on the parameter are left out
+    istringstream rows(sensitivityFile.str());
+    string row;
+    while ( getline(rows, row) ) {
+        BOOST_CHECK( row.find(",BitlineResistancePerCell[Ohm],") == string::npos
+                     || row.find(",ChannelArea[mm^2],") == string::npos );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( checkSensitivityAnalyzer_steps )
+{
+    TechnologyValues inputs("technology_input/test_technology.json",
+                            "architecture_input/test_architecture.json");
+    SensitivityAnalyzer analyzer(false);
+    vector<const TechnologyField*> parameters;
+    parameters.push_back(TechnologyValues::findField("RetentionTime[ms]"));
+    BOOST_REQUIRE( parameters.back() != NULL );
+    analyzer.setParameters(parameters);
+    analyzer.analyze(inputs);
+
+    // tRFC depends on the retention time only through the rows refreshed
+    //  per command, a step, so it has no derivative
+    BOOST_REQUIRE_EQUAL( analyzer.sensitivities().size(), 1 );
+    const Sensitivity& sensitivity = analyzer.sensitivities()[0];
+    BOOST_CHECK_EQUAL( sensitivity.derivatives[DramResult::TRFC], 0 );
+    BOOST_CHECK_EQUAL( sensitivity.derivatives[DramResult::TRFC_CLK], 0 );
+}
+
+BOOST_AUTO_TEST_CASE( checkSensitivityAnalyzer_count )
+{
+    TechnologyValues inputs("technology_input/test_technology.json",
+                            "architecture_input/test_architecture.json");
+    inputs.nBanksPerSemiSharedResource = 2;
+    SensitivityAnalyzer analyzer(false);
+    vector<const TechnologyField*> parameters;
+    parameters.push_back(
+            TechnologyValues::findField("nBanksPerSemiSharedResource[]"));
+    BOOST_REQUIRE( parameters.back() != NULL );
+    analyzer.setParameters(parameters);
+
+    string exceptionMsg("Empty");
+    try {
+        analyzer.analyze(inputs);
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("[ERROR] nBanksPerSemiSharedResource[] is a count, "
+                       "the results have no derivative with respect to "
+                       "it.\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // SENSITIVITYANALYZERTEST_CPP
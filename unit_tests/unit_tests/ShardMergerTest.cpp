@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef SHARDMERGERTEST_CPP
+#define SHARDMERGERTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <sstream>
+
+#include "../../parser/ShardMerger.h"
+#include "../../utils/utils.h"
+
+BOOST_AUTO_TEST_SUITE( testShardMerger )
+
+BOOST_AUTO_TEST_CASE( checkShardMerger_sorted_by_configuration )
+{
+    istringstream shard0("Configuration,Value\n0,a\n2,c\n10,k\n");
+    istringstream shard1("Configuration,Value\n1,b\n3,d\n");
+
+    ShardMerger merger;
+    merger.readShard(shard1, "shard1");
+    merger.readShard(shard0, "shard0");
+
+    ostringstream merged;
+    merger.writeMerged(merged);
+
+    string expected("Configuration,Value\n0,a\n1,b\n2,c\n3,d\n10,k\n");
+    BOOST_CHECK_MESSAGE( merged.str() == expected,
+                        "Merged table different from what was expected."
+                        << "\nExpected: " << expected
+                        << "\nGot: " << merged.str());
+    BOOST_CHECK( merger.nConfigurations() == 5 );
+}
+
+BOOST_AUTO_TEST_CASE( checkShardMerger_quoted_file_names )
+{
+    string row0("0,");
+    appendCsvField(row0, "tech,\"a\".json");
+    row0.append(",arch.json,1");
+    string row1("1,");
+    appendCsvField(row1, "tech\nb.json");
+    row1.append(",arch.json,2");
+
+    BOOST_CHECK( row0 == "0,\"tech,\"\"a\"\".json\",arch.json,1" );
+
+    istringstream shard0("Configuration,Technology,Parameter,Value\n"
+                         + row1 + "\n");
+    istringstream shard1("Configuration,Technology,Parameter,Value\n"
+                         + row0 + "\n");
+
+    ShardMerger merger;
+    merger.readShard(shard0, "shard0");
+    merger.readShard(shard1, "shard1");
+
+    ostringstream merged;
+    merger.writeMerged(merged);
+
+    string expected("Configuration,Technology,Parameter,Value\n"
+                    + row0 + "\n" + row1 + "\n");
+    BOOST_CHECK_MESSAGE( merged.str() == expected,
+                        "Merged table different from what was expected."
+                        << "\nExpected: " << expected
+                        << "\nGot: " << merged.str());
+    BOOST_CHECK( merger.nConfigurations() == 2 );
+}
+
+BOOST_AUTO_TEST_CASE( checkShardMerger_duplicated_configuration )
+{
+    istringstream shard0("Configuration,Value\n0,a\n1,b\n");
+    istringstream shard1("Configuration,Value\n1,b\n");
+
+    ShardMerger merger;
+    merger.readShard(shard0, "shard0");
+
+    std::string exceptionMsg("Empty");
+    try {
+        merger.readShard(shard1, "shard1");
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("[ERROR] ");
+    expectedMsg.append("Configuration 1 found more than once ");
+    expectedMsg.append("(last in \'shard1\').\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_CASE( checkShardMerger_different_header )
+{
+    istringstream shard0("Configuration,Value\n0,a\n");
+    istringstream shard1("Configuration,Other\n1,b\n");
+
+    ShardMerger merger;
+    merger.readShard(shard0, "shard0");
+
+    std::string exceptionMsg("Empty");
+    try {
+        merger.readShard(shard1, "shard1");
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+
+    string expectedMsg("[ERROR] ");
+    expectedMsg.append("Shard result file \'shard1\' has a different ");
+    expectedMsg.append("table header than the previous shards.\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // SHARDMERGERTEST_CPP
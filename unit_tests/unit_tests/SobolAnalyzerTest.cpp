@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+#ifndef SOBOLANALYZERTEST_CPP
+#define SOBOLANALYZERTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "../../parser/SobolAnalyzer.h"
+
+BOOST_AUTO_TEST_SUITE( testSobolAnalyzer )
+
+static void
+setUpAnalyzer(SobolAnalyzer& analyzer)
+{
+    analyzer.baseInputs = TechnologyValues(
+                                "technology_input/test_technology.json",
+                                "architecture_input/test_architecture.json");
+    analyzer.addRelativeRange("CellWidth[um]", 0.1);
+    analyzer.addRelativeRange("BitlineResistancePerCell[Ohm]", 0.2);
+    analyzer.addRelativeRange("WordlineResistancePerCell[Ohm]", 0.2);
+    analyzer.addRange("Temperature[C]", 25, 80);
+    analyzer.nSamples = 2000;
+}
+
+BOOST_AUTO_TEST_CASE( checkSobolAnalyzer_indices )
+{
+    SobolAnalyzer analyzer(false, 1);
+    setUpAnalyzer(analyzer);
+    analyzer.analyze();
+    BOOST_CHECK_EQUAL( analyzer.nRejected, 0 );
+    // Results of A and B shared by the parameters, and the base
+    BOOST_CHECK_EQUAL( analyzer.nEvaluations, 2000 * (4 + 2) + 1 );
+
+    // The area depends on the cell width alone
+    BOOST_CHECK( analyzer.variance(DramResult::CHANNEL_AREA) > 0 );
+    BOOST_CHECK_CLOSE( analyzer.firstOrder(0, DramResult::CHANNEL_AREA),
+                       1, 10 );
+    BOOST_CHECK_CLOSE( analyzer.totalEffect(0, DramResult::CHANNEL_AREA),
+                       1, 10 );
+    for ( unsigned int it = 1; it < analyzer.parameters().size(); it++ ) {
+        BOOST_CHECK_EQUAL( analyzer.firstOrder(it, DramResult::CHANNEL_AREA),
+                           0 );
+        BOOST_CHECK_EQUAL( analyzer.totalEffect(it,
+                                                DramResult::CHANNEL_AREA), 0 );
+    }
+
+    // tRCD is almost additive in the resistances and the cell width
+    double firstOrderSum = 0;
+    for ( unsigned int it = 0; it < analyzer.parameters().size(); it++ ) {
+        double firstOrder = analyzer.firstOrder(it, DramResult::TRCD);
+        double totalEffect = analyzer.totalEffect(it, DramResult::TRCD);
+        BOOST_CHECK( firstOrder > -0.05 );
+        BOOST_CHECK( totalEffect >= 0 );
+        BOOST_CHECK( firstOrder < totalEffect + 0.05 );
+        firstOrderSum += firstOrder;
+    }
+    BOOST_CHECK_CLOSE( firstOrderSum, 1, 10 );
+    BOOST_CHECK( analyzer.totalEffect(2, DramResult::TRCD) > 0.1 );
+
+    // No variance, no indices
+    BOOST_CHECK_EQUAL( analyzer.variance(DramResult::DRAM_FREQ), 0 );
+    BOOST_CHECK_EQUAL( analyzer.totalEffect(0, DramResult::DRAM_FREQ), 0 );
+
+    // Same sums whichever thread evaluates a row
+    SobolAnalyzer threeJobs(false, 3);
+    setUpAnalyzer(threeJobs);
+    threeJobs.analyze();
+    ostringstream indices;
+    ostringstream threeJobsIndices;
+    analyzer.writeIndices(indices);
+    threeJobs.writeIndices(threeJobsIndices);
+    BOOST_CHECK( indices.str() == threeJobsIndices.str() );
+    BOOST_CHECK( indices.str().find("\nDRAMFrequency[MHz],") == string::npos );
+}
+
+BOOST_AUTO_TEST_CASE( checkSobolAnalyzer_specification )
+{
+    ofstream specificationFile("test_sobol.json");
+    specificationFile
+        << "{ \"technology\": \"technology_input/test_technology.json\",\n"
+        << "  \"architecture\": \"architecture_input/test_architecture.json\",\n"
+        << "  \"samples\": 16,\n"
+        << "  \"parameters\": { \"Vdd[V]\": 0.1,\n"
+        << "    \"Temperature[C]\": [30, 30] } }\n";
+    specificationFile.close();
+
+    SobolAnalyzer analyzer(false, 1);
+    string exceptionMsg("Empty");
+    try {
+        analyzer.readSpecification("test_sobol.json");
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("[ERROR] Range of \"Temperature[C]\" must not be "
+                       "empty.\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+    BOOST_CHECK_EQUAL( analyzer.nSamples, 16 );
+    BOOST_REQUIRE_EQUAL( analyzer.parameters().size(), 1 );
+    BOOST_CHECK_CLOSE( analyzer.parameters()[0].maximum,
+                       1.1 * analyzer.baseInputs.vdd.value(), 1e-9 );
+    remove("test_sobol.json");
+
+    // Range of a count
+    exceptionMsg = "Empty";
+    try {
+        analyzer.addRange("CellsPerSubarrayColumn[]", 256, 1024);
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    expectedMsg = "[ERROR] Range of \"CellsPerSubarrayColumn[]\", which is "
+                  "a count, the model takes no range of it.\n";
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+    BOOST_CHECK_EQUAL( analyzer.parameters().size(), 1 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // SOBOLANALYZERTEST_CPP
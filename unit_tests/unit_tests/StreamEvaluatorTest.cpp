@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef STREAMEVALUATORTEST_CPP
+#define STREAMEVALUATORTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <set>
+#include <sstream>
+
+#include "../../parser/StreamEvaluator.h"
+
+BOOST_AUTO_TEST_SUITE( testStreamEvaluator )
+
+BOOST_AUTO_TEST_CASE( checkStreamEvaluator_answers )
+{
+    stringstream requests;
+    for ( int id = 0; id < 6; id++ ) {
+        requests << "{\"id\": " << id << ","
+                 << " \"technology\": \"technology_input/test_technology.json\","
+                 << " \"architecture\": \"architecture_input/test_architecture.json\","
+                 << " \"overrides\": {\"Vdd[V]\": " << 1.0 + 0.1*(id%3) << "}}\n";
+        // Blank lines are skipped
+        requests << "\n";
+    }
+    requests << "{\"id\": 6, \"technology\": \"missing.json\","
+             << " \"architecture\": \"missing.json\"}\n";
+
+    EvaluationService service;
+    StreamEvaluator evaluator(service, 3, 2);
+    ostringstream answers;
+    evaluator.run(requests, answers);
+
+    // One answer per request, in any order
+    istringstream answerLines(answers.str());
+    string answerLine;
+    set<int> answeredIDs;
+    int nFailed = 0;
+    while ( getline(answerLines, answerLine) ) {
+        rapidjson::Document answer;
+        answer.Parse(answerLine.c_str());
+        BOOST_REQUIRE( answer.IsObject() );
+        answeredIDs.insert(answer["id"].GetInt());
+        if ( !answer["ok"].GetBool() ) {
+            nFailed++;
+        }
+    }
+    BOOST_CHECK_MESSAGE( answeredIDs.size() == 7,
+                        "Wrong number of answered requests."
+                        << "\nExpected: 7"
+                        << "\nGot: " << answeredIDs.size());
+    BOOST_CHECK( nFailed == 1 );
+}
+
+BOOST_AUTO_TEST_CASE( checkStreamEvaluator_line_number_ids )
+{
+    // Requests without id are answered with their line number
+    stringstream requests;
+    requests << "{\"technology\": \"technology_input/test_technology.json\","
+             << " \"architecture\": \"architecture_input/test_architecture.json\"}\n"
+             << "\n"
+             << "not json\n"
+             << "{\"id\": \"named\", \"technology\": \"missing.json\","
+             << " \"architecture\": \"missing.json\"}\n";
+
+    EvaluationService service;
+    StreamEvaluator evaluator(service, 2, 2);
+    ostringstream answers;
+    evaluator.run(requests, answers);
+
+    istringstream answerLines(answers.str());
+    string answerLine;
+    set<string> answeredIDs;
+    while ( getline(answerLines, answerLine) ) {
+        rapidjson::Document answer;
+        answer.Parse(answerLine.c_str());
+        BOOST_REQUIRE( answer.IsObject() );
+        BOOST_REQUIRE( answer.HasMember("id") );
+        if ( answer["id"].IsString() ) {
+            answeredIDs.insert(answer["id"].GetString());
+            BOOST_CHECK( !answer["ok"].GetBool() );
+        }
+        else {
+            answeredIDs.insert(to_string(answer["id"].GetUint64()));
+            BOOST_CHECK( answer["ok"].GetBool()
+                         == (answer["id"].GetUint64() == 1) );
+        }
+    }
+    set<string> expectedIDs = {"1", "3", "named"};
+    BOOST_CHECK( answeredIDs == expectedIDs );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // STREAMEVALUATORTEST_CPP
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+#ifndef STREAMINGSTATISTICSTEST_CPP
+#define STREAMINGSTATISTICSTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <algorithm>
+#include <random>
+
+#include "../../parser/StreamingStatistics.h"
+
+BOOST_AUTO_TEST_SUITE( testStreamingStatistics )
+
+BOOST_AUTO_TEST_CASE( checkStreamingStatistics_moments )
+{
+    StreamingStatistics statistics;
+    BOOST_CHECK_EQUAL( statistics.count(), 0 );
+    BOOST_CHECK_EQUAL( statistics.variance(), 0 );
+
+    double values[] = { 2, 4, 4, 4, 5, 5, 7, 9 };
+    for ( unsigned int it = 0; it < 8; it++ ) {
+        statistics.add(values[it]);
+    }
+    BOOST_CHECK_EQUAL( statistics.count(), 8 );
+    BOOST_CHECK_CLOSE( statistics.mean(), 5, 1e-12 );
+    BOOST_CHECK_CLOSE( statistics.variance(), 32.0 / 7, 1e-12 );
+    BOOST_CHECK_EQUAL( statistics.minimum(), 2 );
+    BOOST_CHECK_EQUAL( statistics.maximum(), 9 );
+
+    // Constant values
+    StreamingStatistics constant;
+    for ( unsigned int it = 0; it < 100; it++ ) {
+        constant.add(3.5);
+    }
+    BOOST_CHECK_EQUAL( constant.mean(), 3.5 );
+    BOOST_CHECK_EQUAL( constant.variance(), 0 );
+    for ( unsigned int it = 0; it < constant.quantiles().size(); it++ ) {
+        BOOST_CHECK_EQUAL( constant.quantiles()[it].quantile(), 3.5 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( checkStreamingStatistics_quantiles )
+{
+    // Fewer values than markers: nearest rank
+    QuantileEstimator few(0.5);
+    few.add(3);
+    few.add(1);
+    few.add(2);
+    BOOST_CHECK_EQUAL( few.quantile(), 2 );
+
+    // 0 .. 9999 in random order
+    vector<double> values;
+    for ( unsigned int it = 0; it < 10000; it++ ) {
+        values.push_back(it);
+    }
+    mt19937_64 generator(3);
+    shuffle(values.begin(), values.end(), generator);
+
+    vector<double> probabilities = { 0.05, 0.5, 0.95, 0.99 };
+    StreamingStatistics statistics(probabilities);
+    for ( unsigned int it = 0; it < values.size(); it++ ) {
+        statistics.add(values[it]);
+    }
+    BOOST_REQUIRE_EQUAL( statistics.quantiles().size(), 4 );
+    for ( unsigned int it = 0; it < probabilities.size(); it++ ) {
+        // Within 1% of the range
+        BOOST_CHECK_SMALL( statistics.quantiles()[it].quantile()
+                           - probabilities[it] * 9999, 100.0 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // STREAMINGSTATISTICSTEST_CPP
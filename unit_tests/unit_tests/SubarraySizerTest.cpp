@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+#ifndef SUBARRAYSIZERTEST_CPP
+#define SUBARRAYSIZERTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <cstdio>
+#include <fstream>
+
+#include "../../parser/SubarraySizer.h"
+#include "../../core/Timing.h"
+
+BOOST_AUTO_TEST_SUITE( testSubarraySizer )
+
+BOOST_AUTO_TEST_CASE( checkSubarraySizer_grid )
+{
+    SubarraySizer sizer;
+    sizer.baseInputs = TechnologyValues(
+                                "technology_input/test_technology.json",
+                                "architecture_input/test_architecture.json");
+    sizer.baseInputs.channelSize = 8 * drs::gibibits;
+    vector<double> rows = { 128, 256, 512 };
+    vector<double> columns = { 64, 96, 128, 192, 256, 320, 384, 448, 512,
+                               640, 768, 896, 1024, 1536, 2048 };
+    sizer.setCandidates(rows, columns);
+    double trcdBudget = 9.5;
+    double trasBudget = 130;
+    sizer.setBudget(trcdBudget, trasBudget);
+    sizer.solve();
+
+    // Smallest area of the whole grid
+    double smallestArea = INVALID_VALUE;
+    unsigned int nRowsMeetingBudget = 0;
+    for ( unsigned int row = 0; row < rows.size(); row++ ) {
+        bool isRowMeetingBudget = false;
+        for ( unsigned int column = 0; column < columns.size(); column++ ) {
+            TechnologyValues inputs(sizer.baseInputs);
+            inputs.cellsPerLWL = rows[row] + inputs.cellsPerLWLRedundancy;
+            inputs.cellsPerLBL = columns[column]
+                                 + inputs.cellsPerLBLRedundancy;
+            try {
+                Timing dram(inputs);
+                if ( dram.trcd.value() <= trcdBudget
+                     && dram.tras.value() <= trasBudget ) {
+                    smallestArea = min(smallestArea,
+                                       dram.channelArea.value());
+                    isRowMeetingBudget = true;
+                }
+            } catch(string exceptionMsgThrown) {
+            }
+        }
+        nRowsMeetingBudget += ( isRowMeetingBudget ? 1 : 0 );
+    }
+
+    BOOST_REQUIRE( nRowsMeetingBudget > 0 );
+    BOOST_REQUIRE_EQUAL( sizer.sizes().size(), nRowsMeetingBudget );
+    BOOST_CHECK_EQUAL( sizer.sizes()[0].channelArea, smallestArea );
+    BOOST_CHECK( sizer.sizes()[0].trcd <= trcdBudget );
+    BOOST_CHECK( sizer.sizes()[0].tras <= trasBudget );
+    for ( unsigned int it = 1; it < sizer.sizes().size(); it++ ) {
+        BOOST_CHECK( sizer.sizes()[it-1].channelArea
+                     <= sizer.sizes()[it].channelArea );
+    }
+    BOOST_CHECK( sizer.nTimingEvaluations < rows.size() * columns.size() / 2 );
+    BOOST_CHECK( sizer.nGeometryEvaluations < rows.size() * columns.size() );
+}
+
+BOOST_AUTO_TEST_CASE( checkSubarraySizer_specification )
+{
+    ofstream specificationFile("test_subarray.json");
+    specificationFile
+        << "{ \"technology\": \"technology_input/test_technology.json\",\n"
+        << "  \"architecture\": \"architecture_input/test_architecture.json\",\n"
+        << "  \"RedundantCellsPerSubarrayColumn[]\": 8,\n"
+        << "  \"budget\": { \"tRCD[ns]\": 14 },\n"
+        << "  \"CellsPerSubarrayRow[]\": [512] }\n";
+    specificationFile.close();
+
+    SubarraySizer sizer;
+    sizer.readSpecification("test_subarray.json");
+    BOOST_CHECK_EQUAL( sizer.baseInputs.cellsPerLBLRedundancy, 8 );
+    BOOST_CHECK_EQUAL( sizer.baseInputs.cellsPerLWLRedundancy, 12 );
+    sizer.solve();
+    BOOST_REQUIRE_EQUAL( sizer.sizes().size(), 1 );
+    BOOST_CHECK_EQUAL( sizer.sizes()[0].cellsPerRow, 512 );
+
+    ostringstream sizeFile;
+    sizer.writeSizes(sizeFile);
+    BOOST_CHECK( sizeFile.str().find("\n512,")
+                 != string::npos );
+
+    // No budget
+    specificationFile.open("test_subarray.json");
+    specificationFile
+        << "{ \"technology\": \"technology_input/test_technology.json\",\n"
+        << "  \"architecture\": \"architecture_input/test_architecture.json\",\n"
+        << "  \"budget\": { } }\n";
+    specificationFile.close();
+    string exceptionMsg("Empty");
+    try {
+        sizer.readSpecification("test_subarray.json");
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("[ERROR] Subarray specification \'test_subarray.json\' "
+                       "needs a \"budget\" of \"tRCD[ns]\" "
+                       "and/or \"tRAS[ns]\".\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    // A channel of size 0
+    specificationFile.open("test_subarray.json");
+    specificationFile
+        << "{ \"technology\": \"technology_input/test_technology.json\",\n"
+        << "  \"architecture\": \"architecture_input/test_architecture.json\",\n"
+        << "  \"ChannelSize[Gb]\": 0,\n"
+        << "  \"budget\": { \"tRCD[ns]\": 14 } }\n";
+    specificationFile.close();
+    exceptionMsg = "Empty";
+    try {
+        sizer.readSpecification("test_subarray.json");
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    expectedMsg = "[ERROR] Subarray specification \'test_subarray.json\' "
+                  "gives no positive number as \"ChannelSize[Gb]\".\n";
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+    remove("test_subarray.json");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // SUBARRAYSIZERTEST_CPP
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef TECHNOLOGYLIBRARYTEST_CPP
+#define TECHNOLOGYLIBRARYTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <cstdio>
+#include <fstream>
+
+#include "../../parser/TechnologyLibrary.h"
+
+BOOST_AUTO_TEST_SUITE( testTechnologyLibrary )
+
+BOOST_AUTO_TEST_CASE( checkTechnologyLibrary_compile_and_find )
+{
+    vector<string> technologyFileNames;
+    technologyFileNames.push_back("technology_input/techddr3_5x.json");
+    technologyFileNames.push_back("technology_input/test_technology.json");
+    BOOST_CHECK( TechnologyLibrary::compile(technologyFileNames,
+                                            "test_technologies.lib") == 2 );
+
+    TechnologyLibrary library;
+    library.open("test_technologies.lib");
+    BOOST_REQUIRE( library.isOpen() );
+    BOOST_CHECK( library.nTechnologies() == 2 );
+
+    // Same technology parameters as read from the JSON file
+    TechnologyValues fromLibrary;
+    BOOST_REQUIRE( library.find("test_technology", fromLibrary) );
+    TechnologyValues fromFile("technology_input/test_technology.json",
+                              "architecture_input/test_architecture.json");
+    const vector<TechnologyField>& registry = TechnologyValues::fieldRegistry();
+    for ( unsigned int it = 0; it < registry.size(); it++ ) {
+        if ( registry[it].document != TECHNOLOGY_DOCUMENT ) {
+            continue;
+        }
+        BOOST_CHECK_MESSAGE( registry[it].getNumber(fromLibrary)
+                             == registry[it].getNumber(fromFile),
+                             "Technology parameter " << registry[it].name
+                             << " differs from the technology file.");
+    }
+    BOOST_CHECK( fromLibrary.technologyConstants.isValid );
+    BOOST_CHECK( fromLibrary.technologyConstants.cellDelay
+                 == fromFile.technologyConstants.cellDelay );
+
+    TechnologyValues unknown;
+    BOOST_CHECK( !library.find("test", unknown) );
+    BOOST_CHECK( !library.find("test_technology.json", unknown) );
+    BOOST_CHECK( library.find("techddr3_5x", unknown) );
+
+    remove("test_technologies.lib");
+}
+
+BOOST_AUTO_TEST_CASE( checkTechnologyLibrary_errors )
+{
+    // Two technologies of the same name
+    vector<string> technologyFileNames;
+    technologyFileNames.push_back("technology_input/test_technology.json");
+    technologyFileNames.push_back("./technology_input/test_technology.json");
+    string exceptionMsg("Empty");
+    try {
+        TechnologyLibrary::compile(technologyFileNames,
+                                   "test_technologies.lib");
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("[ERROR] Technology files "
+                       "\'technology_input/test_technology.json\' and "
+                       "\'./technology_input/test_technology.json\' "
+                       "have the same name \'test_technology\'.\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    // Not a technology library
+    ofstream textFile("test_technologies.lib");
+    textFile << "{ \"extends\": \"technology_input/test_technology.json\" }"
+             << "\n";
+    textFile.close();
+    TechnologyLibrary library;
+    exceptionMsg = "Empty";
+    try {
+        library.open("test_technologies.lib");
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    expectedMsg = "[ERROR] \'test_technologies.lib\' is not a technology "
+                  "library of this DRAMSpec version, compile it again "
+                  "with -compiletech.\n";
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+    BOOST_CHECK( !library.isOpen() );
+
+    remove("test_technologies.lib");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // TECHNOLOGYLIBRARYTEST_CPP
@@ -1251,6 +1251,199 @@ BOOST_AUTO_TEST_CASE( checkInputTechnologyValues_bad_arch_file )
                         << "\nGot: " << exceptionMsg);
 }
 
+BOOST_AUTO_TEST_CASE( checkInputTechnologyValues_override )
+{
+    int sim_argc = 9;
+    char* sim_argv[] = {"./executable",
+                        "-t",
+                        "technology_input/test_technology.json",
+                        "-p",
+                        "architecture_input/test_architecture.json",
+                        "-D",
+                        "Vdd[V]=1.2",
+                        "-DDRAMType[-]=DDR4",
+                        "-D"};
+
+    // Missing override after the last -D
+    ArgumentsParser incompleteArguments(sim_argc, sim_argv);
+    string exceptionMsg("Empty");
+    try {
+        incompleteArguments.runArgParser();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("[ERROR] Flag -D expects an override name=value.\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    ArgumentsParser inputFileName(sim_argc - 1, sim_argv);
+    inputFileName.runArgParser();
+    BOOST_REQUIRE( inputFileName.parameterOverrides.size() == 2 );
+
+    TechnologyValues techValues(inputFileName.technologyFileName[0],
+                                inputFileName.architectureFileName[0]);
+    for ( unsigned int it = 0;
+          it < inputFileName.parameterOverrides.size(); it++ ) {
+        techValues.overrideField(inputFileName.parameterOverrides[it].first,
+                                 inputFileName.parameterOverrides[it].second);
+    }
+    BOOST_CHECK_MESSAGE( techValues.vdd.value() == 1.2,
+                        "Override of Vdd[V] not applied."
+                        << "\nExpected: " << 1.2
+                        << "\nGot: " << techValues.vdd.value());
+    BOOST_CHECK( techValues.dramType == "DDR4" );
+
+    exceptionMsg = "Empty";
+    try {
+        techValues.overrideField("Vdd[V]", "1.2V");
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    expectedMsg = "[ERROR] Input parameter \"Vdd[V]\" expects a number, got \'1.2V\'.\n";
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    exceptionMsg = "Empty";
+    try {
+        techValues.overrideField("Vdd", "1.2");
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    expectedMsg = "[ERROR] Unknown input parameter \"Vdd\" can not be overridden.\n";
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    // Values are checked against the field registry
+    const char* const rejectedOverrides[][3] = {
+        { "Vdd[V]", "nan",
+          "[ERROR] Input parameter \"Vdd[V]\" expects a number, got 'nan'.\n" },
+        { "Vdd[V]", "0x1p0",
+          "[ERROR] Input parameter \"Vdd[V]\" expects a number, got '0x1p0'.\n" },
+        { "Vdd[V]", "1e400",
+          "[ERROR] Input parameter \"Vdd[V]\" expects a finite number, got inf.\n" },
+        { "Prefetch[]", "2.5",
+          "[ERROR] Input parameter \"Prefetch[]\" expects a whole number, got 2.5.\n" },
+        { "Frequency[MHz]", "0",
+          "[ERROR] Input parameter \"Frequency[MHz]\" expects a positive number, got 0.\n" },
+        { "CoreFrequency[MHz]", "-1",
+          "[ERROR] Input parameter \"CoreFrequency[MHz]\" expects a non-negative number, got -1.\n" }
+    };
+    for ( unsigned int it = 0; it < 6; it++ ) {
+        exceptionMsg = "Empty";
+        try {
+            techValues.overrideField(rejectedOverrides[it][0],
+                                     rejectedOverrides[it][1]);
+        }catch (string exceptionMsgThrown){
+            exceptionMsg = exceptionMsgThrown;
+        }
+        expectedMsg = rejectedOverrides[it][2];
+        BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                            "Error message different from what was expected."
+                            << "\nExpected: " << expectedMsg
+                            << "\nGot: " << exceptionMsg);
+    }
+    techValues.overrideField("CoreFrequency[MHz]", "0");
+    BOOST_CHECK_EQUAL( techValues.vdd.value(), 1.2 );
+}
+
+BOOST_AUTO_TEST_CASE( checkInputTechnologyValues_technology_constants )
+{
+    TechnologyValues techValues("technology_input/test_technology.json",
+                                "architecture_input/test_architecture.json");
+    BOOST_REQUIRE( techValues.technologyConstants.isValid );
+
+    double cellDelay = timeToPercentage(90)
+                       * techValues.capacitancePerCell.value() * 1e-6
+                       * techValues.resistancePerCell.value() * 1e3;
+    BOOST_CHECK_CLOSE( techValues.technologyConstants.cellDelay.value(),
+                       cellDelay, 1e-9 );
+    BOOST_CHECK_CLOSE(
+        techValues.technologyConstants.wireCapacitancePerMillimeter.value(),
+        techValues.wireCapacitance.value() * 1e-6, 1e-9 );
+
+    // Architecture parameters leave the technology constants as they are
+    techValues.overrideField("Temperature[C]", "45");
+    BOOST_CHECK( techValues.technologyConstants.isValid );
+
+    techValues.overrideField("CellCapacitance[fF]", "30");
+    BOOST_CHECK( !techValues.technologyConstants.isValid );
+    techValues.deriveTechnologyConstants();
+    BOOST_CHECK( techValues.technologyConstants.isValid );
+    BOOST_CHECK_CLOSE( techValues.technologyConstants.cellDelay.value(),
+                       timeToPercentage(90) * 30e-6
+                       * techValues.resistancePerCell.value() * 1e3, 1e-9 );
+}
+
+BOOST_AUTO_TEST_CASE( checkInputTechnologyValues_extends )
+{
+    // Deltas next to the test files, extending them by relative paths
+    ofstream deltaFile("architecture_input/test_extends_architecture.json");
+    deltaFile << "{ \"extends\": \"test_architecture.json\",\n"
+              << "  \"Temperature[C]\": 45 }\n";
+    deltaFile.close();
+    ofstream deltaOfDeltaFile("architecture_input/test_extends_extends.json");
+    deltaOfDeltaFile << "{ \"extends\": \"test_extends_architecture.json\",\n"
+                     << "  \"TilesPerBank[]\": 4 }\n";
+    deltaOfDeltaFile.close();
+
+    TechnologyValues baseValues("technology_input/test_technology.json",
+                                "architecture_input/test_architecture.json");
+    TechnologyValues deltaValues("technology_input/test_technology.json",
+                                 "architecture_input/test_extends_extends.json");
+
+    BOOST_CHECK_MESSAGE( deltaValues.temperature.value() == 45,
+                        "Member of the delta file not applied."
+                        << "\nExpected: " << 45
+                        << "\nGot: " << deltaValues.temperature.value());
+    BOOST_CHECK( deltaValues.nTilesPerBank == 4 );
+    BOOST_CHECK( deltaValues.dramType == baseValues.dramType );
+    BOOST_CHECK( deltaValues.pageStorage == baseValues.pageStorage );
+    BOOST_CHECK( deltaValues.baseFileNames.size() == 2 );
+
+    // Deltas of the same base share it instead of copying it
+    ExtendedDocument firstDelta, secondDelta;
+    TechnologyValues::readJSONFile("architecture_input/test_extends_extends.json",
+                                   "architecture", firstDelta);
+    TechnologyValues::readJSONFile("architecture_input/test_extends_extends.json",
+                                   "architecture", secondDelta);
+    BOOST_CHECK( firstDelta.base && firstDelta.base == secondDelta.base );
+    BOOST_CHECK( firstDelta.base->findMember("Temperature[C]")
+                 == firstDelta.findMember("Temperature[C]") );
+
+    // Merged into one document, the nearest member wins
+    rapidjson::Document mergedDoc;
+    TechnologyValues::readJSONFile("architecture_input/test_extends_extends.json",
+                                   "architecture", mergedDoc);
+    BOOST_CHECK( !mergedDoc.HasMember("extends") );
+    BOOST_CHECK( mergedDoc["TilesPerBank[]"].GetDouble() == 4 );
+    BOOST_CHECK( mergedDoc["Temperature[C]"].GetDouble() == 45 );
+    BOOST_CHECK( mergedDoc.HasMember("PageSize[KB]") );
+
+    // Files extending each other
+    ofstream loopFile("architecture_input/test_extends_architecture.json");
+    loopFile << "{ \"extends\": \"test_extends_extends.json\" }\n";
+    loopFile.close();
+    string exceptionMsg("Empty");
+    try {
+        TechnologyValues loopValues("technology_input/test_technology.json",
+                                    "architecture_input/test_extends_extends.json");
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    BOOST_CHECK_MESSAGE( exceptionMsg.find("it extends itself") != string::npos,
+                        "Files extending each other not detected."
+                        << "\nGot: " << exceptionMsg);
+
+    remove("architecture_input/test_extends_architecture.json");
+    remove("architecture_input/test_extends_extends.json");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+#ifndef TOLERANCEANALYZERTEST_CPP
+#define TOLERANCEANALYZERTEST_CPP
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <cstdio>
+#include <fstream>
+
+#include "../../parser/ToleranceAnalyzer.h"
+
+BOOST_AUTO_TEST_SUITE( testToleranceAnalyzer )
+
+BOOST_AUTO_TEST_CASE( checkToleranceAnalyzer_bounds )
+{
+    ToleranceAnalyzer analyzer(false);
+    analyzer.baseInputs = TechnologyValues(
+                                "technology_input/test_technology.json",
+                                "architecture_input/test_architecture.json");
+    const char* names[] = { "BitlineCapacitancePerCell[aF]",
+                            "WordlineResistancePerCell[Ohm]",
+                            "WireCapacitance[fF/mm]",
+                            "CellWidth[um]" };
+    const unsigned int nTolerances = 4;
+    for ( unsigned int it = 0; it < nTolerances; it++ ) {
+        analyzer.addRelativeTolerance(names[it], 0.1);
+    }
+    analyzer.analyze();
+    // The nominal evaluation and one on intervals
+    BOOST_CHECK_EQUAL( analyzer.nEvaluations, 2u );
+
+    // Corners, centers of the faces and the center of the tolerance box
+    unsigned int nPoints = 1;
+    for ( unsigned int it = 0; it < nTolerances; it++ ) {
+        nPoints *= 3;
+    }
+    for ( unsigned int point = 0; point < nPoints; point++ ) {
+        TechnologyValues inputs(analyzer.baseInputs);
+        unsigned int position = point;
+        for ( unsigned int it = 0; it < nTolerances; it++ ) {
+            const TechnologyField* field = TechnologyValues::findField(
+                                                                names[it]);
+            double value = field->getNumber(analyzer.baseInputs);
+            double deviation = 0.1 * value;
+            field->setNumber(inputs, value + ( int(position % 3) - 1 )
+                                             * deviation);
+            position /= 3;
+        }
+        Current dram(inputs, false);
+        DramResult result;
+        result.collect(dram);
+        for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+            BOOST_CHECK_MESSAGE( analyzer.minimum().values[valueID]
+                                 <= result.values[valueID]
+                                 && result.values[valueID]
+                                 <= analyzer.maximum().values[valueID],
+                                 DramResult::names[valueID]
+                                 << " out of its bounds at point " << point );
+        }
+    }
+    for ( int valueID = 0; valueID < DramResult::N_VALUES; valueID++ ) {
+        BOOST_CHECK( analyzer.minimum().values[valueID]
+                     <= analyzer.nominal().values[valueID] );
+        BOOST_CHECK( analyzer.nominal().values[valueID]
+                     <= analyzer.maximum().values[valueID] );
+    }
+    BOOST_CHECK( analyzer.minimum().values[DramResult::TRCD]
+                 < analyzer.nominal().values[DramResult::TRCD] );
+    BOOST_CHECK( analyzer.maximum().values[DramResult::TRCD]
+                 > analyzer.nominal().values[DramResult::TRCD] );
+    // Results which do not depend on the tolerances keep their value
+    BOOST_CHECK_EQUAL( analyzer.minimum().values[DramResult::DRAM_FREQ],
+                       analyzer.nominal().values[DramResult::DRAM_FREQ] );
+    BOOST_CHECK_EQUAL( analyzer.maximum().values[DramResult::DRAM_FREQ],
+                       analyzer.nominal().values[DramResult::DRAM_FREQ] );
+}
+
+BOOST_AUTO_TEST_CASE( checkToleranceAnalyzer_specification )
+{
+    ofstream specificationFile("test_tolerance.json");
+    specificationFile
+        << "{ \"technology\": \"technology_input/test_technology.json\",\n"
+        << "  \"architecture\": \"architecture_input/test_architecture.json\",\n"
+        << "  \"tolerances\": { \"CellCapacitance[fF]\": 0.05,\n"
+        << "    \"Temperature[C]\": { \"minimum\": 10, \"maximum\": 40 } } }\n";
+    specificationFile.close();
+
+    ToleranceAnalyzer analyzer(false);
+    analyzer.readSpecification("test_tolerance.json");
+    analyzer.analyze();
+    ostringstream boundFile;
+    analyzer.writeBounds(boundFile);
+    BOOST_CHECK( boundFile.str().find("Result,Nominal,Minimum,Maximum\n"
+                                      "DRAMFrequency[MHz],800,800,800\n")
+                 == 0 );
+
+    // The range has to hold the configured temperature
+    analyzer.baseInputs.overrideField("Temperature[C]", "50");
+    string exceptionMsg("Empty");
+    try {
+        analyzer.analyze();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("[ERROR] Range of \"Temperature[C]\" must hold the "
+                       "value of the configuration.\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    // Not an input parameter
+    exceptionMsg = "Empty";
+    try {
+        analyzer.addRelativeTolerance("tRCD[ns]", 0.1);
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    expectedMsg = "[ERROR] Tolerance of \"tRCD[ns]\", which is no numeric "
+                  "input parameter of the configuration.\n";
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+
+    // A count
+    exceptionMsg = "Empty";
+    try {
+        analyzer.addRelativeTolerance("NumberOfBanksPerChannel[]", 0.1);
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    expectedMsg = "[ERROR] Tolerance of \"NumberOfBanksPerChannel[]\", "
+                  "which is a count, the model takes no range of it.\n";
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+    remove("test_tolerance.json");
+}
+
+BOOST_AUTO_TEST_CASE( checkToleranceAnalyzer_branch )
+{
+    // The refresh of the model changes at 85 C
+    ToleranceAnalyzer analyzer(false);
+    analyzer.baseInputs = TechnologyValues(
+                                "technology_input/test_technology.json",
+                                "architecture_input/test_architecture.json");
+    analyzer.addRange("Temperature[C]", 20, 90);
+    string exceptionMsg("Empty");
+    try {
+        analyzer.analyze();
+    }catch (string exceptionMsgThrown){
+        exceptionMsg = exceptionMsgThrown;
+    }
+    string expectedMsg("[ERROR] Within the tolerances: A branch of the "
+                       "model is taken for part of the intervals only, "
+                       "split them at it.\n");
+    BOOST_CHECK_MESSAGE( exceptionMsg == expectedMsg,
+                        "Error message different from what was expected."
+                        << "\nExpected: " << expectedMsg
+                        << "\nGot: " << exceptionMsg);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // TOLERANCEANALYZERTEST_CPP
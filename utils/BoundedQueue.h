@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2017, University of Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors: Omar Naji,
+ *          Matthias Jung,
+ *          Christian Weis,
+ *          Kamal Haddad,
+ *          Andre Lucas Chinazzo
+ */
+
+
+
+#ifndef BOUNDEDQUEUE_H
+#define BOUNDEDQUEUE_H
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+#include <utility>
+
+// Lock-free bounded queue for exactly one producer and one consumer thread.
+// Neither side ever blocks: tryPush() fails when the queue is full and
+//  tryPop() fails when it is empty, leaving the waiting policy to the caller.
+template<typename T>
+class BoundedQueue
+{
+public:
+    explicit BoundedQueue(size_t capacity) :
+        slots(capacity + 1), // One slot is kept free to tell full from empty
+        head(0),
+        tail(0),
+        maxSize(0)
+    {
+    }
+
+    // Producer side. The item is moved into the queue on success.
+    bool tryPush(T& item)
+    {
+        size_t currentTail = tail.load(std::memory_order_relaxed);
+        size_t nextTail = increment(currentTail);
+        if ( nextTail == head.load(std::memory_order_acquire) ) {
+            return false; // Full
+        }
+        slots[currentTail] = std::move(item);
+        tail.store(nextTail, std::memory_order_release);
+
+        // Track how full the queue ever got
+        size_t currentSize = sizeBetween(head.load(std::memory_order_acquire),
+                                         nextTail);
+        if ( currentSize > maxSize.load(std::memory_order_relaxed) ) {
+            maxSize.store(currentSize, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    // Consumer side
+    bool tryPop(T& item)
+    {
+        size_t currentHead = head.load(std::memory_order_relaxed);
+        if ( currentHead == tail.load(std::memory_order_acquire) ) {
+            return false; // Empty
+        }
+        item = std::move(slots[currentHead]);
+        head.store(increment(currentHead), std::memory_order_release);
+        return true;
+    }
+
+    size_t capacity() const { return slots.size() - 1; }
+
+    // Largest number of items ever waiting in the queue
+    size_t highWaterMark() const
+    {
+        return maxSize.load(std::memory_order_relaxed);
+    }
+
+private:
+    size_t increment(size_t index) const
+    {
+        return ( index + 1 == slots.size() ) ? 0 : index + 1;
+    }
+
+    size_t sizeBetween(size_t from, size_t to) const
+    {
+        return ( to >= from ) ? to - from : to + slots.size() - from;
+    }
+
+    std::vector<T> slots;
+    std::atomic<size_t> head; // Next slot to be popped (consumer owned)
+    std::atomic<size_t> tail; // Next slot to be pushed (producer owned)
+    std::atomic<size_t> maxSize;
+};
+
+#endif // BOUNDEDQUEUE_H
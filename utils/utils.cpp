@@ -42,6 +42,10 @@
 #include <stdio.h>
 #include <iostream>
 #include <limits>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
 
 bool isInteger( double dn )
 {
@@ -64,3 +68,115 @@ double timeToPercentage(double percentage)
     //  The returned amount is given in terms of number of tau's.
     return -log(1.0 - percentage/100.0);
 }
+
+int shortestDoubleToString(double value, char* buffer)
+{
+    // Writes the shortest decimal representation of value which reads
+    //  back to the very same double. Returns the number of characters written.
+    // If a 15 digits representation reads back correctly it is already the
+    //  shortest one (%g drops trailing zeros), otherwise 16 or at most 17
+    //  significant digits are needed.
+    int length = 0;
+    for ( int precision = 15; precision <= 17; precision++ ) {
+        length = snprintf(buffer, SHORTEST_DOUBLE_BUFFER_SIZE,
+                          "%.*g", precision, value);
+        if ( strtod(buffer, NULL) == value ) {
+            break;
+        }
+    }
+    return length;
+}
+
+bool syncFileToDisk(const char* fileName)
+{
+    // Forces the already written content of a file (possibly written
+    //  through another stream) out of the page cache onto the disk.
+    int fd = open(fileName, O_RDONLY);
+    if ( fd < 0 ) {
+        return false;
+    }
+    bool isSynced = ( fsync(fd) == 0 );
+    close(fd);
+    return isSynced;
+}
+
+bool getFileModification(const char* fileName, long long& modificationTime,
+                         long& modificationTimeNs, long long& size)
+{
+    struct stat fileStat;
+    if ( stat(fileName, &fileStat) != 0 ) {
+        return false;
+    }
+#ifdef __APPLE__
+    modificationTime = fileStat.st_mtimespec.tv_sec;
+    modificationTimeNs = fileStat.st_mtimespec.tv_nsec;
+#else
+    modificationTime = fileStat.st_mtim.tv_sec;
+    modificationTimeNs = fileStat.st_mtim.tv_nsec;
+#endif
+    size = fileStat.st_size;
+    return true;
+}
+
+unsigned long long fnv1aHash(const std::string& data)
+{
+    // 64 bit FNV-1a
+    unsigned long long hash = 14695981039346656037ULL;
+    for ( size_t it = 0; it < data.size(); it++ ) {
+        hash ^= (unsigned char) data[it];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+void appendCsvField(std::string& row, const std::string& field)
+{
+    if ( field.find_first_of(",\"\r\n") == std::string::npos ) {
+        row.append(field);
+        return;
+    }
+
+    row.push_back('"');
+    for ( size_t it = 0; it < field.size(); it++ ) {
+        if ( field[it] == '"' ) {
+            row.push_back('"');
+        }
+        row.push_back(field[it]);
+    }
+    row.push_back('"');
+}
+
+void appendCsvFileNames(std::string& row,
+                        const std::string& technologyFileName,
+                        const std::string& architectureFileName)
+{
+    appendCsvField(row, technologyFileName);
+    row.push_back(',');
+    appendCsvField(row, architectureFileName);
+}
+
+bool getCsvRecord(std::istream& input, std::string& record)
+{
+    if ( !std::getline(input, record) ) {
+        return false;
+    }
+
+    // An odd number of quotes means a quoted field is still open
+    size_t nQuotes = 0;
+    std::string line(record);
+    std::string nextLine;
+    while ( true ) {
+        for ( size_t it = 0; it < line.size(); it++ ) {
+            if ( line[it] == '"' ) {
+                nQuotes++;
+            }
+        }
+        if ( nQuotes % 2 == 0 || !std::getline(input, nextLine) ) {
+            break;
+        }
+        record.push_back('\n');
+        record.append(nextLine);
+        line.swap(nextLine);
+    }
+    return true;
+}
@@ -42,6 +42,8 @@
 #define UTILS_H
 
 #include <cmath>
+#include <string>
+#include <iosfwd>
 
 #define INVALID_VALUE std::numeric_limits<double>::max()
 
@@ -49,6 +51,35 @@ bool isInteger( double dn );
 bool isPowerOfTwo( double n );
 
 double timeToPercentage(double percentage);
+
+// Buffer size large enough for any double written by shortestDoubleToString
+#define SHORTEST_DOUBLE_BUFFER_SIZE 32
+
+int shortestDoubleToString(double value, char* buffer);
+
+bool syncFileToDisk(const char* fileName);
+
+// Modification time (seconds and nanoseconds) and size of a file.
+// Returns false if the file can not be found.
+bool getFileModification(const char* fileName, long long& modificationTime,
+                         long& modificationTimeNs, long long& size);
+
+unsigned long long fnv1aHash(const std::string& data);
+
+// Appends a field to a csv row. Fields containing a separator, a quote or
+//  a line break are quoted, with their quotes doubled.
+void appendCsvField(std::string& row, const std::string& field);
+// Appends the technology and architecture file names of a configuration
+//  as two fields. File names may contain separators, quotes or line
+//  breaks.
+void appendCsvFileNames(std::string& row,
+                        const std::string& technologyFileName,
+                        const std::string& architectureFileName);
+
+// Reads one csv record, which spans several lines when a quoted field
+//  contains line breaks. Returns false if nothing could be read.
+bool getCsvRecord(std::istream& input, std::string& record);
+
 #define PRINT_VAR(varName) \
     do{std::cout << #varName " = " << varName << std::endl;} while(false)
 